@@ -0,0 +1,725 @@
+ /******************************************************************************
+ *
+ * Module: BENCHMARK
+ *
+ * File Name: benchmark.c
+ *
+ * Description: Source file for the kernel micro-benchmarks.
+ *              Every sample is the difference of two reads of the DWT cycle
+ *              counter around one kernel call, the kernel objects are created
+ *              for the run and deleted at its end. The SIMULATION build reads
+ *              the monotonic clock of the host instead, in ns.
+ *
+ *******************************************************************************/
+
+#include "benchmark.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "timers.h"
+#include "buffer_pool.h"
+#include "spsc_ring.h"
+
+/* APP includes. */
+#include "APP/SIGNALS/signals.h"
+
+/* MCAL includes. */
+#include "uart0.h"
+#include "DWT/dwt.h"
+
+#ifdef SIMULATION
+#include <time.h>
+#endif
+
+#if ( configAPP_KERNEL_BENCHMARK == 1 )
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+#ifdef SIMULATION
+/* The DWT of the host build follows the virtual clock, which stands still while
+ * a task runs, the host clock times the kernel calls instead */
+#define BENCHMARK_CYCLES()              Benchmark_HostClockRead()
+#define BENCHMARK_UNIT                  "ns"
+#else
+#define BENCHMARK_CYCLES()              DWT_CycleCounterRead()
+#define BENCHMARK_UNIT                  "cycles"
+#endif
+
+/* Back to back reads of the counter used to find its own cost */
+#define BENCHMARK_OVERHEAD_SAMPLES      16
+
+/* Bits of the wake benchmarks, one from the benchmark task to the partner, one back */
+#define BENCHMARK_PING_BIT              0x01
+#define BENCHMARK_PONG_BIT              0x02
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 Count;
+    uint32 Min;
+    uint32 Max;
+    uint64 Total;
+} BenchmarkResult_t;
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+static uint32 g_Overhead = 0;
+
+/* Item sizes and report names of the copy and buffer queue benchmarks */
+static const uint32 g_ItemSizes[BENCHMARK_ITEM_SIZES] = {4, 16, 64, BENCHMARK_MAX_ITEM_SIZE};
+static const char * const g_CopyQueueNames[BENCHMARK_ITEM_SIZES] =
+{
+    "queue_copy_4", "queue_copy_16", "queue_copy_64", "queue_copy_256"
+};
+static const char * const g_BufferQueueNames[BENCHMARK_ITEM_SIZES] =
+{
+    "queue_buffer_4", "queue_buffer_16", "queue_buffer_64", "queue_buffer_256"
+};
+
+/* Items sent and received by the copy queue benchmark */
+static uint8 g_ItemIn[BENCHMARK_MAX_ITEM_SIZE];
+static uint8 g_ItemOut[BENCHMARK_MAX_ITEM_SIZE];
+
+/* Ring of the SPSC ring benchmark, it holds a single item */
+static SpscRing_t g_Ring;
+static uint32 g_RingStorage[1];
+
+/* Handles of the timer benchmark, kept off the stack of the calling task */
+static TimerHandle_t g_Timers[BENCHMARK_TIMERS];
+
+/* Objects shared with the partner task of the wake benchmarks */
+static EventGroupHandle_t g_WakeEventGroup;
+static SemaphoreHandle_t g_PingSemaphore;
+static SemaphoreHandle_t g_PongSemaphore;
+static TaskHandle_t g_BenchmarkTask;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+static StaticTask_t g_PartnerTaskBuffer;
+static StackType_t g_PartnerTaskStack[BENCHMARK_PARTNER_STACK_DEPTH];
+static StaticQueue_t g_QueueBuffer;
+static uint8 g_QueueStorage[sizeof(uint32)];
+static StaticSemaphore_t g_SemaphoreBuffer;
+static StaticSemaphore_t g_PongSemaphoreBuffer;
+static StaticEventGroup_t g_EventGroupBuffer;
+static uint8 g_ItemQueueStorage[BENCHMARK_MAX_ITEM_SIZE];
+static uint8 g_BufferQueueStorage[sizeof(void *)];
+static StaticBufferPool_t g_BufferPoolBuffer;
+static uint64 g_BufferPoolStorage[BENCHMARK_MAX_ITEM_SIZE / sizeof(uint64)]; /* Aligned to portBYTE_ALIGNMENT */
+static StaticTimer_t g_TimerBuffers[BENCHMARK_TIMERS];
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+
+#ifdef SIMULATION
+static uint32 Benchmark_HostClockRead(void);
+#endif
+static void Benchmark_CycleCounterInit(void);
+static void Benchmark_ResultInit(BenchmarkResult_t *pResult);
+static void Benchmark_ResultAdd(BenchmarkResult_t *pResult, uint32 uCycles);
+static void Benchmark_Report(const char *pName, const BenchmarkResult_t *pResult);
+static void Benchmark_PartnerTask(void *pvParameters);
+static TaskHandle_t Benchmark_PartnerCreate(TaskFunction_t pxPartnerCode);
+static void Benchmark_EventGroupPartnerTask(void *pvParameters);
+static void Benchmark_SemaphorePartnerTask(void *pvParameters);
+static void Benchmark_SignalPartnerTask(void *pvParameters);
+
+static void Benchmark_TaskSwitch(void);
+static void Benchmark_TickIncrement(void);
+static void Benchmark_Queue(void);
+static void Benchmark_CopyQueue(uint32 uSizeIndex);
+static void Benchmark_BufferQueue(uint32 uSizeIndex);
+static void Benchmark_SpscRing(void);
+static void Benchmark_Semaphore(void);
+static void Benchmark_EventGroup(void);
+static void Benchmark_EventGroupWake(void);
+static void Benchmark_SemaphoreWake(void);
+static void Benchmark_SignalWake(void);
+static void Benchmark_TimerReset(void);
+static void Benchmark_TimerCallback(TimerHandle_t xTimer);
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Benchmark_Run(void)
+{
+    uint32 uIndex;
+
+    Benchmark_CycleCounterInit();
+
+    UART0_SendString((const uint8 *)"benchmark,iterations,min_" BENCHMARK_UNIT ",avg_" BENCHMARK_UNIT
+                                    ",max_" BENCHMARK_UNIT "\r\n");
+    Benchmark_TaskSwitch();
+    Benchmark_TickIncrement();
+    Benchmark_Queue();
+    for (uIndex = 0; uIndex < BENCHMARK_ITEM_SIZES; uIndex++)
+    {
+        Benchmark_CopyQueue(uIndex);
+        Benchmark_BufferQueue(uIndex);
+    }
+    Benchmark_SpscRing();
+    Benchmark_Semaphore();
+    Benchmark_EventGroup();
+    Benchmark_EventGroupWake();
+    Benchmark_SemaphoreWake();
+    Benchmark_SignalWake();
+    Benchmark_TimerReset();
+}
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+#ifdef SIMULATION
+/* Low 32 bits of the host monotonic clock in ns, the samples are differences */
+static uint32 Benchmark_HostClockRead(void)
+{
+    struct timespec xNow;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &xNow);
+    return (uint32)(((uint64)xNow.tv_sec * 1000000000ULL) + (uint64)xNow.tv_nsec);
+}
+#endif
+
+static void Benchmark_CycleCounterInit(void)
+{
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#ifndef SIMULATION
+    /* Already running when it is the run time clock of the kernel statistics */
+    DWT_CycleCounterInit();
+#endif
+
+    g_Overhead = 0xFFFFFFFFUL;
+    for (uIndex = 0; uIndex < BENCHMARK_OVERHEAD_SAMPLES; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        if (uCycles < g_Overhead)
+        {
+            g_Overhead = uCycles;
+        }
+    }
+}
+
+static void Benchmark_ResultInit(BenchmarkResult_t *pResult)
+{
+    pResult->Count = 0;
+    pResult->Min = 0xFFFFFFFFUL;
+    pResult->Max = 0;
+    pResult->Total = 0;
+}
+
+static void Benchmark_ResultAdd(BenchmarkResult_t *pResult, uint32 uCycles)
+{
+    uCycles = (uCycles > g_Overhead) ? (uCycles - g_Overhead) : 0;
+
+    pResult->Count++;
+    pResult->Total += uCycles;
+    if (uCycles < pResult->Min)
+    {
+        pResult->Min = uCycles;
+    }
+    if (uCycles > pResult->Max)
+    {
+        pResult->Max = uCycles;
+    }
+}
+
+static void Benchmark_Report(const char *pName, const BenchmarkResult_t *pResult)
+{
+    UART0_SendString((const uint8 *)pName);
+    UART0_SendByte(',');
+    UART0_SendInteger(pResult->Count);
+    UART0_SendByte(',');
+    UART0_SendInteger((pResult->Count != 0) ? pResult->Min : 0);
+    UART0_SendByte(',');
+    UART0_SendInteger((pResult->Count != 0) ? (sint64)(pResult->Total / pResult->Count) : 0);
+    UART0_SendByte(',');
+    UART0_SendInteger(pResult->Max);
+    UART0_SendString((const uint8 *)"\r\n");
+}
+
+/* Runs at the priority of the benchmark task and gives the CPU straight back */
+static void Benchmark_PartnerTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        taskYIELD();
+    }
+}
+
+/* One partner at a time, at the priority of the benchmark task, deleted by the benchmark that created it */
+static TaskHandle_t Benchmark_PartnerCreate(TaskFunction_t pxPartnerCode)
+{
+    TaskHandle_t xPartner;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    xPartner = xTaskCreateStatic(pxPartnerCode, "Bench", BENCHMARK_PARTNER_STACK_DEPTH, NULL,
+                                 uxTaskPriorityGet(NULL), g_PartnerTaskStack, &g_PartnerTaskBuffer);
+#else
+    if (xTaskCreate(pxPartnerCode, "Bench", BENCHMARK_PARTNER_STACK_DEPTH, NULL,
+                    uxTaskPriorityGet(NULL), &xPartner) != pdPASS)
+    {
+        xPartner = NULL;
+    }
+#endif
+    configASSERT(xPartner != NULL);
+
+    return xPartner;
+}
+
+static void Benchmark_TaskSwitch(void)
+{
+    BenchmarkResult_t xResult;
+    TaskHandle_t xPartner;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+    xPartner = Benchmark_PartnerCreate(Benchmark_PartnerTask);
+
+    /* Let the partner run once so that its first switch in is not timed */
+    taskYIELD();
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        /* Switch to the partner and back: two context switches */
+        uStart = BENCHMARK_CYCLES();
+        taskYIELD();
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles / 2);
+    }
+
+    vTaskDelete(xPartner);
+    Benchmark_Report("task_switch", &xResult);
+}
+
+static void Benchmark_TickIncrement(void)
+{
+    BenchmarkResult_t xResult;
+    BaseType_t xSwitchRequired;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        /* Called as the SysTick handler calls it, with the kernel interrupts masked */
+        taskENTER_CRITICAL();
+        uStart = BENCHMARK_CYCLES();
+        xSwitchRequired = xTaskIncrementTick();
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        taskEXIT_CRITICAL();
+
+        Benchmark_ResultAdd(&xResult, uCycles);
+        if (xSwitchRequired != pdFALSE)
+        {
+            taskYIELD();
+        }
+    }
+
+    Benchmark_Report("tick_increment", &xResult);
+}
+
+static void Benchmark_Queue(void)
+{
+    BenchmarkResult_t xSend;
+    BenchmarkResult_t xReceive;
+    QueueHandle_t xQueue;
+    uint32 uItem = 0;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    xQueue = xQueueCreateStatic(1, sizeof(uint32), g_QueueStorage, &g_QueueBuffer);
+#else
+    xQueue = xQueueCreate(1, sizeof(uint32));
+#endif
+    configASSERT(xQueue != NULL);
+
+    Benchmark_ResultInit(&xSend);
+    Benchmark_ResultInit(&xReceive);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xQueueSend(xQueue, &uIndex, 0);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xSend, uCycles);
+
+        uStart = BENCHMARK_CYCLES();
+        (void)xQueueReceive(xQueue, &uItem, 0);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xReceive, uCycles);
+    }
+
+    vQueueDelete(xQueue);
+    Benchmark_Report("queue_send", &xSend);
+    Benchmark_Report("queue_receive", &xReceive);
+}
+
+static void Benchmark_CopyQueue(uint32 uSizeIndex)
+{
+    BenchmarkResult_t xResult;
+    QueueHandle_t xQueue;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    xQueue = xQueueCreateStatic(1, g_ItemSizes[uSizeIndex], g_ItemQueueStorage, &g_QueueBuffer);
+#else
+    xQueue = xQueueCreate(1, g_ItemSizes[uSizeIndex]);
+#endif
+    configASSERT(xQueue != NULL);
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xQueueSend(xQueue, g_ItemIn, 0);
+        (void)xQueueReceive(xQueue, g_ItemOut, 0);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles);
+    }
+
+    vQueueDelete(xQueue);
+    Benchmark_Report(g_CopyQueueNames[uSizeIndex], &xResult);
+}
+
+static void Benchmark_BufferQueue(uint32 uSizeIndex)
+{
+    BenchmarkResult_t xResult;
+    BufferPoolHandle_t xPool;
+    QueueHandle_t xQueue;
+    void *pvBuffer;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    xPool = xBufferPoolCreateStatic(g_ItemSizes[uSizeIndex], 1, (uint8 *)g_BufferPoolStorage, &g_BufferPoolBuffer);
+    xQueue = xBufferQueueCreateStatic(1, g_BufferQueueStorage, &g_QueueBuffer);
+#else
+    xPool = xBufferPoolCreate(g_ItemSizes[uSizeIndex], 1);
+    xQueue = xBufferQueueCreate(1);
+#endif
+    configASSERT((xPool != NULL) && (xQueue != NULL));
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        /* The writer fills the buffer in place and the reader uses it in place, not timed */
+        uStart = BENCHMARK_CYCLES();
+        pvBuffer = pvBufferPoolTake(xPool);
+        (void)xBufferQueueSend(xQueue, pvBuffer, 0);
+        (void)xBufferQueueReceive(xQueue, &pvBuffer, 0);
+        vBufferPoolGive(xPool, pvBuffer);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles);
+    }
+
+    vQueueDelete(xQueue);
+    vBufferPoolDelete(xPool);
+    Benchmark_Report(g_BufferQueueNames[uSizeIndex], &xResult);
+}
+
+static void Benchmark_SpscRing(void)
+{
+    BenchmarkResult_t xResult;
+    uint32 uItem = 0;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+    vSpscRingInitialise(&g_Ring, g_RingStorage, sizeof(uint32), 1);
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xSpscRingPush(&g_Ring, &uIndex);
+        (void)xSpscRingPop(&g_Ring, &uItem);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles);
+    }
+
+    configASSERT(uItem == (BENCHMARK_ITERATIONS - 1));
+    Benchmark_Report("spsc_ring", &xResult);
+}
+
+static void Benchmark_Semaphore(void)
+{
+    BenchmarkResult_t xGive;
+    BenchmarkResult_t xTake;
+    SemaphoreHandle_t xSemaphore;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    xSemaphore = xSemaphoreCreateBinaryStatic(&g_SemaphoreBuffer);
+#else
+    xSemaphore = xSemaphoreCreateBinary();
+#endif
+    configASSERT(xSemaphore != NULL);
+
+    Benchmark_ResultInit(&xGive);
+    Benchmark_ResultInit(&xTake);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xSemaphoreGive(xSemaphore);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xGive, uCycles);
+
+        uStart = BENCHMARK_CYCLES();
+        (void)xSemaphoreTake(xSemaphore, 0);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xTake, uCycles);
+    }
+
+    vSemaphoreDelete(xSemaphore);
+    Benchmark_Report("semaphore_give", &xGive);
+    Benchmark_Report("semaphore_take", &xTake);
+}
+
+static void Benchmark_EventGroup(void)
+{
+    BenchmarkResult_t xResult;
+    EventGroupHandle_t xEventGroup;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    xEventGroup = xEventGroupCreateStatic(&g_EventGroupBuffer);
+#else
+    xEventGroup = xEventGroupCreate();
+#endif
+    configASSERT(xEventGroup != NULL);
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xEventGroupSetBits(xEventGroup, 0x01);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles);
+
+        (void)xEventGroupClearBits(xEventGroup, 0x01);
+    }
+
+    vEventGroupDelete(xEventGroup);
+    Benchmark_Report("event_group_set", &xResult);
+}
+
+/*
+ * The wake benchmarks pass a ping from the benchmark task to a partner task blocked on
+ * it, and a pong back, the old way (event group bits, binary semaphores) and with the
+ * signals of APP/SIGNALS. The partner has the priority of the benchmark task, so each
+ * round trip is two wakes of a blocked task and two context switches, and a sample is
+ * half of it: one wake of a waiting task, from the call to the waiter running.
+ */
+static void Benchmark_EventGroupPartnerTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        (void)xEventGroupWaitBits(g_WakeEventGroup, BENCHMARK_PING_BIT, pdTRUE, pdFALSE, portMAX_DELAY);
+        (void)xEventGroupSetBits(g_WakeEventGroup, BENCHMARK_PONG_BIT);
+    }
+}
+
+static void Benchmark_SemaphorePartnerTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        (void)xSemaphoreTake(g_PingSemaphore, portMAX_DELAY);
+        (void)xSemaphoreGive(g_PongSemaphore);
+    }
+}
+
+static void Benchmark_SignalPartnerTask(void *pvParameters)
+{
+    (void)pvParameters;
+
+    for (;;)
+    {
+        (void)Signal_WaitAny(BENCHMARK_PING_BIT, portMAX_DELAY);
+        Signal_Send(g_BenchmarkTask, BENCHMARK_PONG_BIT);
+    }
+}
+
+static void Benchmark_EventGroupWake(void)
+{
+    BenchmarkResult_t xResult;
+    TaskHandle_t xPartner;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    g_WakeEventGroup = xEventGroupCreateStatic(&g_EventGroupBuffer);
+#else
+    g_WakeEventGroup = xEventGroupCreate();
+#endif
+    configASSERT(g_WakeEventGroup != NULL);
+
+    /* The partner runs first and blocks on the ping */
+    xPartner = Benchmark_PartnerCreate(Benchmark_EventGroupPartnerTask);
+    taskYIELD();
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xEventGroupSetBits(g_WakeEventGroup, BENCHMARK_PING_BIT);
+        (void)xEventGroupWaitBits(g_WakeEventGroup, BENCHMARK_PONG_BIT, pdTRUE, pdFALSE, portMAX_DELAY);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles / 2);
+    }
+
+    vTaskDelete(xPartner);
+    vEventGroupDelete(g_WakeEventGroup);
+    Benchmark_Report("event_group_wake", &xResult);
+}
+
+static void Benchmark_SemaphoreWake(void)
+{
+    BenchmarkResult_t xResult;
+    TaskHandle_t xPartner;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    g_PingSemaphore = xSemaphoreCreateBinaryStatic(&g_SemaphoreBuffer);
+    g_PongSemaphore = xSemaphoreCreateBinaryStatic(&g_PongSemaphoreBuffer);
+#else
+    g_PingSemaphore = xSemaphoreCreateBinary();
+    g_PongSemaphore = xSemaphoreCreateBinary();
+#endif
+    configASSERT((g_PingSemaphore != NULL) && (g_PongSemaphore != NULL));
+
+    xPartner = Benchmark_PartnerCreate(Benchmark_SemaphorePartnerTask);
+    taskYIELD();
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        (void)xSemaphoreGive(g_PingSemaphore);
+        (void)xSemaphoreTake(g_PongSemaphore, portMAX_DELAY);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles / 2);
+    }
+
+    vTaskDelete(xPartner);
+    vSemaphoreDelete(g_PingSemaphore);
+    vSemaphoreDelete(g_PongSemaphore);
+    Benchmark_Report("semaphore_wake", &xResult);
+}
+
+static void Benchmark_SignalWake(void)
+{
+    BenchmarkResult_t xResult;
+    TaskHandle_t xPartner;
+    uint32 uIndex;
+    uint32 uStart;
+    uint32 uCycles;
+
+    g_BenchmarkTask = xTaskGetCurrentTaskHandle();
+    xPartner = Benchmark_PartnerCreate(Benchmark_SignalPartnerTask);
+    taskYIELD();
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        uStart = BENCHMARK_CYCLES();
+        Signal_Send(xPartner, BENCHMARK_PING_BIT);
+        (void)Signal_WaitAny(BENCHMARK_PONG_BIT, portMAX_DELAY);
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles / 2);
+    }
+
+    vTaskDelete(xPartner);
+    Benchmark_Report("signal_wake", &xResult);
+}
+
+/* The periods are far longer than the run, the timers never expire */
+static void Benchmark_TimerCallback(TimerHandle_t xTimer)
+{
+    (void)xTimer;
+}
+
+static void Benchmark_TimerReset(void)
+{
+    BenchmarkResult_t xResult;
+    uint32 uIndex;
+    uint32 uTimer = 0;
+    uint32 uStart;
+    uint32 uCycles;
+
+    for (uIndex = 0; uIndex < BENCHMARK_TIMERS; uIndex++)
+    {
+        /* Spread the expiry times so that the active timers are not all in one place */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+        g_Timers[uIndex] = xTimerCreateStatic("Bench", BENCHMARK_TIMER_PERIOD + (uIndex * 37), pdTRUE, NULL,
+                                              Benchmark_TimerCallback, &g_TimerBuffers[uIndex]);
+#else
+        g_Timers[uIndex] = xTimerCreate("Bench", BENCHMARK_TIMER_PERIOD + (uIndex * 37), pdTRUE, NULL,
+                                        Benchmark_TimerCallback);
+#endif
+        configASSERT(g_Timers[uIndex] != NULL);
+        (void)xTimerStart(g_Timers[uIndex], portMAX_DELAY);
+        taskYIELD();
+    }
+
+    Benchmark_ResultInit(&xResult);
+    for (uIndex = 0; uIndex < BENCHMARK_ITERATIONS; uIndex++)
+    {
+        /* Not in the order the timers expire */
+        uTimer = (uTimer + 13) % BENCHMARK_TIMERS;
+
+        /* The timer task has the priority of this task, the yield lets it take the command */
+        uStart = BENCHMARK_CYCLES();
+        (void)xTimerReset(g_Timers[uTimer], 0);
+        taskYIELD();
+        uCycles = BENCHMARK_CYCLES() - uStart;
+        Benchmark_ResultAdd(&xResult, uCycles);
+    }
+
+    for (uIndex = 0; uIndex < BENCHMARK_TIMERS; uIndex++)
+    {
+        (void)xTimerDelete(g_Timers[uIndex], portMAX_DELAY);
+        taskYIELD();
+    }
+
+    Benchmark_Report("timer_reset", &xResult);
+}
+
+#endif /* configAPP_KERNEL_BENCHMARK == 1 */
@@ -0,0 +1,80 @@
+ /******************************************************************************
+ *
+ * Module: BENCHMARK
+ *
+ * File Name: benchmark.h
+ *
+ * Description: Header file for the kernel micro-benchmarks. Each benchmark times
+ *              one kernel hot path with the DWT cycle counter and reports the
+ *              min, avg and max CPU cycles per operation as a CSV line on UART0.
+ *              The SIMULATION build reports host ns (tests/test_benchmark.c).
+ *              Built only when configAPP_KERNEL_BENCHMARK is 1 (FreeRTOSConfig.h).
+ *
+ *******************************************************************************/
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Operations timed by each benchmark */
+#define BENCHMARK_ITERATIONS            1000
+
+/* Stack of the task the context switch benchmark yields to, in words */
+#define BENCHMARK_PARTNER_STACK_DEPTH   128
+
+/* Active timers of the timer benchmark, and the shortest of their periods in ticks */
+#define BENCHMARK_TIMERS                32
+#define BENCHMARK_TIMER_PERIOD          10000
+
+/* Item sizes of the copy and buffer queue benchmarks, in bytes */
+#define BENCHMARK_ITEM_SIZES            4
+#define BENCHMARK_MAX_ITEM_SIZE         256
+
+/*
+ * CSV report, one header line then one line per benchmark:
+ *   benchmark,iterations,min_cycles,avg_cycles,max_cycles
+ *   (min_ns,avg_ns,max_ns in the SIMULATION build)
+ *   task_switch        one context switch (vTaskSwitchContext and the PendSV handler),
+ *                      half of a taskYIELD() round trip between two tasks
+ *   tick_increment     xTaskIncrementTick() with no task to unblock
+ *   queue_send         xQueueGenericSend() to an empty queue, no waiting task
+ *   queue_receive      xQueueReceive() from a full queue, no waiting task
+ *   semaphore_give     xSemaphoreGive() of a binary semaphore
+ *   semaphore_take     xQueueSemaphoreTake() of a given binary semaphore
+ *   queue_copy_<n>     xQueueSend() then xQueueReceive() of an n byte item, n = 4, 16,
+ *                      64 and 256, the queue copies the item in and out
+ *   queue_buffer_<n>   the same n bytes passed by pointer: pvBufferPoolTake(),
+ *                      xBufferQueueSend(), xBufferQueueReceive() then vBufferPoolGive()
+ *   spsc_ring          xSpscRingPush() then xSpscRingPop() of a 4 byte item, no consumer
+ *                      task to notify, to compare with queue_copy_4
+ *   event_group_set    xEventGroupSetBits() with no waiting task
+ *   event_group_wake   xEventGroupSetBits() waking a task blocked in xEventGroupWaitBits(),
+ *                      half of a ping pong round trip between two tasks
+ *   semaphore_wake     xSemaphoreGive() waking a task blocked in xSemaphoreTake(), the same way
+ *   signal_wake        Signal_Send() waking a task blocked in Signal_WaitAny(), the same way
+ *   timer_reset        xTimerReset() of one of BENCHMARK_TIMERS active timers and the
+ *                      timer task taking the command, two context switches included
+ * The cost of reading the cycle counter is removed from every sample. The min
+ * is the cost of the path itself, an interrupt inside a sample only shows in the
+ * avg and max.
+ */
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Runs every benchmark and sends the CSV report, takes a few ms.
+ * Must be called once, from a task running at the highest application priority
+ * before the other tasks blocked on a delay, as the tick benchmark moves the tick
+ * count forward by BENCHMARK_ITERATIONS ticks.
+ */
+void Benchmark_Run(void);
+
+#endif /* BENCHMARK_H_ */
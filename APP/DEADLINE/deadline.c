@@ -0,0 +1,222 @@
+ /******************************************************************************
+ *
+ * Module: DEADLINE
+ *
+ * File Name: deadline.c
+ *
+ * Description: Source file for the deadline monitor.
+ *              The ready hook runs inside the kernel, with its interrupts masked or
+ *              the scheduler suspended, and only stores the time of the task. The
+ *              job marks and the report task update the entry inside a critical
+ *              section. Times are the low 32 bits of the WTimer0 microsecond
+ *              timestamp, a job may last up to ~71 minutes.
+ *
+ *******************************************************************************/
+
+#include "deadline.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* MCAL includes. */
+#include "GPTM.h"
+
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    const void *Task;
+    uint32 DeadlineUs;
+    uint32 QuarterUs;           /* Width of a histogram bin, at least 1 */
+    boolean bReady;             /* LastReady is valid */
+    uint32 LastReady;           /* Last time the kernel moved the task to the ready list */
+    boolean bReleased;          /* A job is pending, LastRelease is valid */
+    uint32 LastRelease;
+    uint32 LastCompletion;
+    sint32 LastLatenessUs;
+    DeadlineStats_t Window;
+} DeadlineTask_t;
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+/* Kept in RAM for the debugger, the last job of each task is in its entry */
+static DeadlineTask_t g_Tasks[DEADLINE_MAX_TASKS];
+static uint32 g_TaskCount = 0;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+
+static DeadlineTask_t *Deadline_Find(const void *pTask);
+static void Deadline_ResetWindow(DeadlineStats_t *pStats);
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+boolean Deadline_Register(const void *pTask, uint32 uDeadlineUs)
+{
+    DeadlineTask_t *pEntry;
+    boolean bRegistered = TRUE;
+
+    taskENTER_CRITICAL();
+    {
+        pEntry = Deadline_Find(pTask);
+        if ((pEntry == NULL_PTR) && (g_TaskCount < DEADLINE_MAX_TASKS))
+        {
+            /* Filled before it is counted, the hooks never see a half written entry */
+            pEntry = &g_Tasks[g_TaskCount];
+            pEntry->Task = pTask;
+            pEntry->bReady = FALSE;
+            pEntry->bReleased = FALSE;
+            Deadline_ResetWindow(&pEntry->Window);
+            g_TaskCount++;
+        }
+
+        if (pEntry != NULL_PTR)
+        {
+            pEntry->DeadlineUs = uDeadlineUs;
+            pEntry->QuarterUs = (uDeadlineUs < 4) ? 1 : (uDeadlineUs / 4);
+        }
+        else
+        {
+            bRegistered = FALSE;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return bRegistered;
+}
+
+void Deadline_JobStarted(void)
+{
+    DeadlineTask_t *pEntry = Deadline_Find(xTaskGetCurrentTaskHandle());
+
+    if (pEntry == NULL_PTR)
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    {
+        /* The first job of a task, started before it was registered, has no release */
+        pEntry->LastRelease = pEntry->LastReady;
+        pEntry->bReleased = pEntry->bReady;
+    }
+    taskEXIT_CRITICAL();
+}
+
+void Deadline_JobCompleted(void)
+{
+    DeadlineTask_t *pEntry = Deadline_Find(xTaskGetCurrentTaskHandle());
+    uint32 uResponse;
+    uint32 uBin;
+
+    if (pEntry == NULL_PTR)
+    {
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    if (pEntry->bReleased)
+    {
+        pEntry->LastCompletion = (uint32)GPTM_WTimer0ReadUs();
+        pEntry->bReleased = FALSE;
+
+        uResponse = pEntry->LastCompletion - pEntry->LastRelease;
+        pEntry->LastLatenessUs = (sint32)(uResponse - pEntry->DeadlineUs);
+
+        pEntry->Window.Jobs++;
+        if (uResponse > pEntry->DeadlineUs)
+        {
+            pEntry->Window.Misses++;
+        }
+        if ((pEntry->Window.Jobs == 1) || (pEntry->LastLatenessUs > pEntry->Window.MaxLatenessUs))
+        {
+            pEntry->Window.MaxLatenessUs = pEntry->LastLatenessUs;
+        }
+
+        uBin = (uResponse == 0) ? 0 : ((uResponse - 1) / pEntry->QuarterUs);
+        if (uBin >= DEADLINE_HISTOGRAM_BINS)
+        {
+            uBin = DEADLINE_HISTOGRAM_BINS - 1;
+        }
+        pEntry->Window.Histogram[uBin]++;
+    }
+    taskEXIT_CRITICAL();
+}
+
+void Deadline_TaskReady(const void *pTask)
+{
+    DeadlineTask_t *pEntry = Deadline_Find(pTask);
+
+    /* Every wake is kept, the job takes the last one before it started */
+    if (pEntry != NULL_PTR)
+    {
+        pEntry->LastReady = (uint32)GPTM_WTimer0ReadUs();
+        pEntry->bReady = TRUE;
+    }
+}
+
+boolean Deadline_TakeWindow(const void *pTask, DeadlineStats_t *pStats)
+{
+    DeadlineTask_t *pEntry;
+
+    taskENTER_CRITICAL();
+    {
+        pEntry = Deadline_Find(pTask);
+        if (pEntry != NULL_PTR)
+        {
+            *pStats = pEntry->Window;
+            Deadline_ResetWindow(&pEntry->Window);
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if (pEntry == NULL_PTR)
+    {
+        Deadline_ResetWindow(pStats);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+static DeadlineTask_t *Deadline_Find(const void *pTask)
+{
+    uint32 uIndex;
+
+    for (uIndex = 0; uIndex < g_TaskCount; uIndex++)
+    {
+        if (g_Tasks[uIndex].Task == pTask)
+        {
+            return &g_Tasks[uIndex];
+        }
+    }
+    return NULL_PTR;
+}
+
+static void Deadline_ResetWindow(DeadlineStats_t *pStats)
+{
+    uint32 uIndex;
+
+    pStats->Jobs = 0;
+    pStats->Misses = 0;
+    pStats->MaxLatenessUs = 0;
+    for (uIndex = 0; uIndex < DEADLINE_HISTOGRAM_BINS; uIndex++)
+    {
+        pStats->Histogram[uIndex] = 0;
+    }
+}
+
+#endif /* configAPP_DEADLINE_MONITOR == 1 */
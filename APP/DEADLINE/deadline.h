@@ -0,0 +1,99 @@
+ /******************************************************************************
+ *
+ * Module: DEADLINE
+ *
+ * File Name: deadline.h
+ *
+ * Description: Header file for the deadline monitor. Each monitored task marks the
+ *              start and the end of its jobs with Deadline_JobStarted() and
+ *              Deadline_JobCompleted(). A job is released the last time the kernel
+ *              moved the task to the ready list before it started, seen by the
+ *              kernel trace hook (FreeRTOSConfig.h), so a task that blocks more
+ *              than once per job, or delays after it, still counts one job. The
+ *              response time of each job is compared with the deadline of the
+ *              task, the statistics of a window are sent with the profiler report.
+ *
+ *******************************************************************************/
+
+#ifndef DEADLINE_H_
+#define DEADLINE_H_
+
+#include "std_types.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Tasks that can be registered */
+#define DEADLINE_MAX_TASKS              8
+
+/*
+ * Response time histogram, in quarters of the deadline:
+ *   bins 0..3    met, response time up to 1/4, 1/2, 3/4 and 4/4 of the deadline
+ *   bins 4..6    missed by up to 1/4, 1/2 and 3/4 of the deadline
+ *   bin  7       missed by more
+ */
+#define DEADLINE_HISTOGRAM_BINS         8
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 Jobs;                /* Completed jobs */
+    uint32 Misses;              /* Completed after the deadline */
+    sint32 MaxLatenessUs;       /* Completion - deadline of the latest job, negative when all met it */
+    uint32 Histogram[DEADLINE_HISTOGRAM_BINS];
+} DeadlineStats_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+
+/*
+ * Description :
+ * Monitor the jobs of a task against a deadline relative to their release, in us.
+ * Called once per task after it is created, usually before the scheduler starts.
+ * Returns FALSE when DEADLINE_MAX_TASKS tasks are already monitored.
+ */
+boolean Deadline_Register(const void *pTask, uint32 uDeadlineUs);
+
+/*
+ * Description :
+ * Called by the calling task when its job starts, once what released it has been
+ * received, and when the job ends. Only the jobs between the two are counted, the
+ * calls of a task that is not monitored are ignored.
+ */
+void Deadline_JobStarted(void);
+void Deadline_JobCompleted(void);
+
+/*
+ * Description :
+ * Trace hook, called by the kernel from traceMOVED_TASK_TO_READY_STATE
+ * (FreeRTOSConfig.h) with the interrupts masked or the scheduler suspended.
+ * Must not be called from the application.
+ */
+void Deadline_TaskReady(const void *pTask);
+
+/*
+ * Description :
+ * Copy the statistics of the task since the previous call and start a new window.
+ * Returns FALSE, with the statistics cleared, when the task is not monitored.
+ */
+boolean Deadline_TakeWindow(const void *pTask, DeadlineStats_t *pStats);
+
+#else
+
+/* The task bodies mark their jobs whether or not they are monitored */
+#define Deadline_JobStarted()
+#define Deadline_JobCompleted()
+
+#endif /* configAPP_DEADLINE_MONITOR == 1 */
+
+#endif /* DEADLINE_H_ */
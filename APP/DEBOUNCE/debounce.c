@@ -0,0 +1,204 @@
+ /******************************************************************************
+ *
+ * Module: DEBOUNCE
+ *
+ * File Name: debounce.c
+ *
+ * Description: Source file for the debouncing of the Port F buttons.
+ *              The state is only used by the Port F and the WTimer0A interrupts,
+ *              both at priority 5 so one never preempts the other. A pin stays
+ *              masked during its window, the bounces after the first edge do not
+ *              interrupt, and its flag is cleared before the level is read so an
+ *              edge that comes after the read is raised when the pin is unmasked.
+ *
+ *******************************************************************************/
+
+#include "debounce.h"
+
+/* MCAL includes. */
+#include "gpio.h"
+#include "GPTM.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 PinMask;
+    uint8 (*GetState)(void);
+    boolean bPressed;           /* Settled level */
+    boolean bSettling;          /* Pin masked until EdgeUs + DEBOUNCE_WINDOW_US */
+    boolean bLongPressDue;      /* Pressed and its long press event not sent yet */
+    uint64 EdgeUs;              /* Last edge */
+    uint64 PressUs;             /* Edge of the current press */
+} DebounceState_t;
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+static const DebounceButton_t *g_Buttons = NULL_PTR;
+static DebounceState_t g_States[DEBOUNCE_BUTTONS] =
+{
+    { GPIO_SW1_PIN_MASK, GPIO_SW1GetState, FALSE, FALSE, FALSE, 0, 0 },
+    { GPIO_SW2_PIN_MASK, GPIO_SW2GetState, FALSE, FALSE, FALSE, 0, 0 }
+};
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+
+static void Debounce_Service(uint64 uNowUs, BaseType_t *pxHigherPriorityTaskWoken);
+static void Debounce_Arm(BaseType_t *pxHigherPriorityTaskWoken);
+static void Debounce_CompareExpired(void);
+static void Debounce_Send(uint32 uButton, Signals_t uSignals, BaseType_t *pxHigherPriorityTaskWoken);
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Debounce_Init(const DebounceButton_t *pButtons)
+{
+    uint32 uButton;
+
+    g_Buttons = pButtons;
+    for (uButton = 0; uButton < DEBOUNCE_BUTTONS; uButton++)
+    {
+        g_States[uButton].bPressed = (g_States[uButton].GetState() == PRESSED) ? TRUE : FALSE;
+        g_States[uButton].bSettling = FALSE;
+        g_States[uButton].bLongPressDue = FALSE;
+    }
+
+    GPIO_SW1EdgeTriggeredInterruptInit();
+    GPIO_SW2EdgeTriggeredInterruptInit();
+}
+
+void GPIOPortF_Handler(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    uint32 uPins = GPIO_SWInterruptStatus();
+    uint64 uNowUs = GPTM_WTimer0ReadUs();
+    uint32 uButton;
+
+    GPIO_SWInterruptDisable(uPins);
+    for (uButton = 0; uButton < DEBOUNCE_BUTTONS; uButton++)
+    {
+        if (uPins & g_States[uButton].PinMask)
+        {
+            g_States[uButton].EdgeUs = uNowUs;
+            g_States[uButton].bSettling = TRUE;
+        }
+    }
+
+    Debounce_Arm(&xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Reads the buttons whose window ended and raises the events that are due */
+static void Debounce_Service(uint64 uNowUs, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    DebounceState_t *pState;
+    boolean bPressed;
+    uint32 uButton;
+
+    for (uButton = 0; uButton < DEBOUNCE_BUTTONS; uButton++)
+    {
+        pState = &g_States[uButton];
+
+        if (pState->bSettling && (uNowUs >= (pState->EdgeUs + DEBOUNCE_WINDOW_US)))
+        {
+            GPIO_SWInterruptClear(pState->PinMask);
+            bPressed = (pState->GetState() == PRESSED) ? TRUE : FALSE;
+            pState->bSettling = FALSE;
+            GPIO_SWInterruptEnable(pState->PinMask);
+
+            /* A bounce back to the settled level is not an event */
+            if (bPressed != pState->bPressed)
+            {
+                pState->bPressed = bPressed;
+                if (bPressed)
+                {
+                    pState->PressUs = pState->EdgeUs;
+                    pState->bLongPressDue = (g_Buttons[uButton].LongPress != 0) ? TRUE : FALSE;
+                    Debounce_Send(uButton, g_Buttons[uButton].Press, pxHigherPriorityTaskWoken);
+                }
+                else
+                {
+                    pState->bLongPressDue = FALSE;
+                    Debounce_Send(uButton, g_Buttons[uButton].Release, pxHigherPriorityTaskWoken);
+                }
+            }
+        }
+
+        if (pState->bLongPressDue && (uNowUs >= (pState->PressUs + DEBOUNCE_LONG_PRESS_US)))
+        {
+            pState->bLongPressDue = FALSE;
+            Debounce_Send(uButton, g_Buttons[uButton].LongPress, pxHigherPriorityTaskWoken);
+        }
+    }
+}
+
+/* Sets the compare to the next window end or long press, whichever comes first */
+static void Debounce_Arm(BaseType_t *pxHigherPriorityTaskWoken)
+{
+    uint64 uDueUs;
+    boolean bDue;
+    uint32 uButton;
+
+    for (;;)
+    {
+        bDue = FALSE;
+        uDueUs = 0;
+        for (uButton = 0; uButton < DEBOUNCE_BUTTONS; uButton++)
+        {
+            if (g_States[uButton].bSettling && ((!bDue) || ((g_States[uButton].EdgeUs + DEBOUNCE_WINDOW_US) < uDueUs)))
+            {
+                uDueUs = g_States[uButton].EdgeUs + DEBOUNCE_WINDOW_US;
+                bDue = TRUE;
+            }
+            if (g_States[uButton].bLongPressDue && ((!bDue) || ((g_States[uButton].PressUs + DEBOUNCE_LONG_PRESS_US) < uDueUs)))
+            {
+                uDueUs = g_States[uButton].PressUs + DEBOUNCE_LONG_PRESS_US;
+                bDue = TRUE;
+            }
+        }
+
+        if (!bDue)
+        {
+            GPTM_WTimer0CancelCompare();
+            return;
+        }
+        if (GPTM_WTimer0SetCompare(uDueUs, Debounce_CompareExpired))
+        {
+            return;
+        }
+
+        /* Already due, it is served here and the next one is armed */
+        Debounce_Service(GPTM_WTimer0ReadUs(), pxHigherPriorityTaskWoken);
+    }
+}
+
+/* Compare callback, runs in the WTimer0A interrupt */
+static void Debounce_CompareExpired(void)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    Debounce_Service(GPTM_WTimer0ReadUs(), &xHigherPriorityTaskWoken);
+    Debounce_Arm(&xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+static void Debounce_Send(uint32 uButton, Signals_t uSignals, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    TaskHandle_t *pReceiver = g_Buttons[uButton].Receiver;
+
+    if ((uSignals != 0) && (pReceiver != NULL_PTR) && (*pReceiver != NULL))
+    {
+        Signal_SendFromISR(*pReceiver, uSignals, pxHigherPriorityTaskWoken);
+    }
+}
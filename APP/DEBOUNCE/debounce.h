@@ -0,0 +1,73 @@
+ /******************************************************************************
+ *
+ * Module: DEBOUNCE
+ *
+ * File Name: debounce.h
+ *
+ * Description: Header file for the debouncing of the Port F buttons. The port
+ *              interrupt only timestamps an edge and masks the pin, the level is
+ *              read once the contacts had DEBOUNCE_WINDOW_US to settle, from the
+ *              WTimer0 compare interrupt (GPTM). A settled change of the level gives
+ *              a press or a release event, a press held for DEBOUNCE_LONG_PRESS_US
+ *              also gives a long press event. The events are sent as signals.
+ *
+ *******************************************************************************/
+
+#ifndef DEBOUNCE_H_
+#define DEBOUNCE_H_
+
+#include "std_types.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Application includes. */
+#include "APP/SIGNALS/signals.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Buttons, index in the table given to Debounce_Init */
+#define DEBOUNCE_SW1                    0
+#define DEBOUNCE_SW2                    1
+#define DEBOUNCE_BUTTONS                2
+
+/* Time from an edge to the read of the level, longer than the bounce of the buttons */
+#define DEBOUNCE_WINDOW_US              20000UL
+
+/* Time from the press edge to the long press event */
+#define DEBOUNCE_LONG_PRESS_US          1000000UL
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    TaskHandle_t *Receiver;     /* Task signalled with the events, read at each event, nothing is sent while NULL */
+    Signals_t Press;            /* Signal bits of each event, 0 when the event is not wanted */
+    Signals_t LongPress;
+    Signals_t Release;
+} DebounceButton_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Takes the buttons from the table (DEBOUNCE_BUTTONS entries, kept by reference) and
+ * enables their interrupt on both edges. The WTimer0 timestamp must be started and
+ * the debouncing owns its compare. Called once, before the scheduler starts.
+ */
+void Debounce_Init(const DebounceButton_t *pButtons);
+
+/*
+ * Description :
+ * Port F interrupt, takes the edge of each button and starts its window.
+ */
+void GPIOPortF_Handler(void);
+
+#endif /* DEBOUNCE_H_ */
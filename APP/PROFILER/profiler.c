@@ -0,0 +1,258 @@
+ /******************************************************************************
+ *
+ * Module: PROFILER
+ *
+ * File Name: profiler.c
+ *
+ * Description: Source file for the per-task execution profiler.
+ *              The task switch hooks run inside the context switch with the kernel
+ *              interrupts masked, the report task copies and resets their statistics
+ *              inside a critical section.
+ *
+ *******************************************************************************/
+
+#include "profiler.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* MCAL includes. */
+#include "uart0.h"
+
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+#include "APP/DEADLINE/deadline.h"
+#endif
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef struct
+{
+    uint32 LastSwitchIn;        /* Run time counter at the last switch in */
+    boolean bSwitchedIn;        /* LastSwitchIn is valid */
+    uint32 Bursts;
+    uint32 TotalBurst;
+    uint32 MinBurst;
+    uint32 MaxBurst;
+    uint32 Intervals;
+    uint32 MinInterval;         /* Intervals between two consecutive switch ins */
+    uint32 MaxInterval;
+} ProfilerTaskStats_t;
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+/* Written by the trace hooks, indexed by task number */
+static ProfilerTaskStats_t g_Stats[PROFILER_MAX_TASKS];
+
+/* Only used by the report task */
+static configRUN_TIME_COUNTER_TYPE g_PrevRunTime[PROFILER_MAX_TASKS];
+static configRUN_TIME_COUNTER_TYPE g_PrevTotalRunTime = 0;
+static UBaseType_t g_NextTaskNumber = 1;
+static TaskStatus_t g_TaskStatus[PROFILER_MAX_TASKS];
+static ProfilerTaskStats_t g_Window[PROFILER_MAX_TASKS];
+static uint8 g_Frame[PROFILER_FRAME_HEADER_SIZE + (PROFILER_MAX_TASKS * PROFILER_FRAME_RECORD_SIZE) + 1];
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+
+static void Profiler_ResetWindow(ProfilerTaskStats_t *pStats);
+static uint16 Profiler_Saturate16(uint32 uValue);
+static uint8 *Profiler_PutUint16(uint8 *pFrame, uint16 uValue);
+static uint8 *Profiler_PutUint32(uint8 *pFrame, uint32 uValue);
+
+#define PROFILER_SLOT(uTaskNumber)  (((uTaskNumber) < PROFILER_MAX_TASKS) ? (uTaskNumber) : 0)
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Profiler_TaskSwitchedIn(uint32 uTaskNumber)
+{
+    ProfilerTaskStats_t *pStats = &g_Stats[PROFILER_SLOT(uTaskNumber)];
+    uint32 uNow = (uint32)portGET_RUN_TIME_COUNTER_VALUE();
+    uint32 uInterval;
+
+    if (pStats->bSwitchedIn)
+    {
+        uInterval = uNow - pStats->LastSwitchIn;
+        pStats->Intervals++;
+        if ((pStats->Intervals == 1) || (uInterval < pStats->MinInterval))
+        {
+            pStats->MinInterval = uInterval;
+        }
+        if (uInterval > pStats->MaxInterval)
+        {
+            pStats->MaxInterval = uInterval;
+        }
+    }
+    pStats->LastSwitchIn = uNow;
+    pStats->bSwitchedIn = TRUE;
+}
+
+void Profiler_TaskSwitchedOut(uint32 uTaskNumber)
+{
+    ProfilerTaskStats_t *pStats = &g_Stats[PROFILER_SLOT(uTaskNumber)];
+    uint32 uBurst;
+
+    if (pStats->bSwitchedIn)
+    {
+        uBurst = (uint32)portGET_RUN_TIME_COUNTER_VALUE() - pStats->LastSwitchIn;
+        pStats->Bursts++;
+        pStats->TotalBurst += uBurst;
+        if ((pStats->Bursts == 1) || (uBurst < pStats->MinBurst))
+        {
+            pStats->MinBurst = uBurst;
+        }
+        if (uBurst > pStats->MaxBurst)
+        {
+            pStats->MaxBurst = uBurst;
+        }
+    }
+}
+
+void Profiler_SendReport(void)
+{
+    configRUN_TIME_COUNTER_TYPE uTotalRunTime;
+    configRUN_TIME_COUNTER_TYPE uWindow;
+    UBaseType_t uxTasks;
+    UBaseType_t uxIndex;
+    UBaseType_t uxTaskNumber;
+    uint8 *pFrame;
+    uint8 uRecords = 0;
+    uint8 uChecksum = 0;
+    uint8 uNameIndex;
+    uint32 uIndex;
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+    DeadlineStats_t xDeadline;
+#endif
+
+    uxTasks = uxTaskGetSystemState(g_TaskStatus, PROFILER_MAX_TASKS, &uTotalRunTime);
+
+    /* Take the statistics of the window that ends now and start the next one */
+    taskENTER_CRITICAL();
+    {
+        for (uIndex = 0; uIndex < PROFILER_MAX_TASKS; uIndex++)
+        {
+            g_Window[uIndex] = g_Stats[uIndex];
+            Profiler_ResetWindow(&g_Stats[uIndex]);
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    uWindow = uTotalRunTime - g_PrevTotalRunTime;
+    g_PrevTotalRunTime = uTotalRunTime;
+
+    pFrame = &g_Frame[PROFILER_FRAME_HEADER_SIZE];
+    for (uxIndex = 0; uxIndex < uxTasks; uxIndex++)
+    {
+        uxTaskNumber = uxTaskGetTaskNumber(g_TaskStatus[uxIndex].xHandle);
+
+        if (uxTaskNumber == 0)
+        {
+            /* Number the task now, it is reported from the next window */
+            if (g_NextTaskNumber < PROFILER_MAX_TASKS)
+            {
+                g_PrevRunTime[g_NextTaskNumber] = g_TaskStatus[uxIndex].ulRunTimeCounter;
+                vTaskSetTaskNumber(g_TaskStatus[uxIndex].xHandle, g_NextTaskNumber);
+                g_NextTaskNumber++;
+            }
+            continue;
+        }
+        if (uxTaskNumber >= PROFILER_MAX_TASKS)
+        {
+            continue;
+        }
+
+        *pFrame++ = (uint8)uxTaskNumber;
+        for (uNameIndex = 0; uNameIndex < PROFILER_TASK_NAME_LENGTH; uNameIndex++)
+        {
+            *pFrame = (uint8)g_TaskStatus[uxIndex].pcTaskName[uNameIndex];
+            if (*pFrame++ == '\0')
+            {
+                break;
+            }
+        }
+        for (uNameIndex++; uNameIndex < PROFILER_TASK_NAME_LENGTH; uNameIndex++)
+        {
+            *pFrame++ = '\0';
+        }
+
+        pFrame = Profiler_PutUint16(pFrame, (uWindow == 0) ? 0 :
+                     (uint16)(((uint64)(g_TaskStatus[uxIndex].ulRunTimeCounter - g_PrevRunTime[uxTaskNumber]) * 10000) / uWindow));
+        g_PrevRunTime[uxTaskNumber] = g_TaskStatus[uxIndex].ulRunTimeCounter;
+
+        pFrame = Profiler_PutUint16(pFrame, Profiler_Saturate16(g_Window[uxTaskNumber].Bursts));
+        pFrame = Profiler_PutUint32(pFrame, g_Window[uxTaskNumber].MinBurst);
+        pFrame = Profiler_PutUint32(pFrame, (g_Window[uxTaskNumber].Bursts == 0) ? 0 :
+                     (g_Window[uxTaskNumber].TotalBurst / g_Window[uxTaskNumber].Bursts));
+        pFrame = Profiler_PutUint32(pFrame, g_Window[uxTaskNumber].MaxBurst);
+        pFrame = Profiler_PutUint32(pFrame, g_Window[uxTaskNumber].MaxInterval - g_Window[uxTaskNumber].MinInterval);
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+        (void)Deadline_TakeWindow(g_TaskStatus[uxIndex].xHandle, &xDeadline);
+        pFrame = Profiler_PutUint16(pFrame, Profiler_Saturate16(xDeadline.Jobs));
+        pFrame = Profiler_PutUint16(pFrame, Profiler_Saturate16(xDeadline.Misses));
+        pFrame = Profiler_PutUint32(pFrame, (uint32)xDeadline.MaxLatenessUs);
+        for (uIndex = 0; uIndex < DEADLINE_HISTOGRAM_BINS; uIndex++)
+        {
+            pFrame = Profiler_PutUint16(pFrame, Profiler_Saturate16(xDeadline.Histogram[uIndex]));
+        }
+#endif
+        uRecords++;
+    }
+
+    g_Frame[0] = PROFILER_FRAME_SYNC0;
+    g_Frame[1] = PROFILER_FRAME_SYNC1;
+    g_Frame[2] = PROFILER_FRAME_VERSION;
+    g_Frame[3] = uRecords;
+    (void)Profiler_PutUint32(&g_Frame[4], (uint32)uWindow);
+
+    for (uIndex = 2; &g_Frame[uIndex] < pFrame; uIndex++)
+    {
+        uChecksum += g_Frame[uIndex];
+    }
+    *pFrame++ = (uint8)(0 - uChecksum);
+
+    for (uIndex = 0; &g_Frame[uIndex] < pFrame; uIndex++)
+    {
+        UART0_SendByte(g_Frame[uIndex]);
+    }
+}
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+static void Profiler_ResetWindow(ProfilerTaskStats_t *pStats)
+{
+    /* LastSwitchIn is kept so the task still running gets its burst and interval */
+    pStats->Bursts = 0;
+    pStats->TotalBurst = 0;
+    pStats->MinBurst = 0;
+    pStats->MaxBurst = 0;
+    pStats->Intervals = 0;
+    pStats->MinInterval = 0;
+    pStats->MaxInterval = 0;
+}
+
+static uint16 Profiler_Saturate16(uint32 uValue)
+{
+    return (uValue > 0xFFFF) ? 0xFFFF : (uint16)uValue;
+}
+
+static uint8 *Profiler_PutUint16(uint8 *pFrame, uint16 uValue)
+{
+    *pFrame++ = (uint8)uValue;
+    *pFrame++ = (uint8)(uValue >> 8);
+    return pFrame;
+}
+
+static uint8 *Profiler_PutUint32(uint8 *pFrame, uint32 uValue)
+{
+    pFrame = Profiler_PutUint16(pFrame, (uint16)uValue);
+    return Profiler_PutUint16(pFrame, (uint16)(uValue >> 16));
+}
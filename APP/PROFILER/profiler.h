@@ -0,0 +1,83 @@
+ /******************************************************************************
+ *
+ * Module: PROFILER
+ *
+ * File Name: profiler.h
+ *
+ * Description: Header file for the per-task execution profiler. The kernel run time
+ *              counter (configGENERATE_RUN_TIME_STATS) gives the CPU share of each
+ *              task, the task switch trace hooks give the burst time and jitter.
+ *
+ *******************************************************************************/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include "std_types.h"
+
+/* Kernel includes, the frame layout depends on configAPP_DEADLINE_MONITOR */
+#include "FreeRTOS.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Task numbers 1..PROFILER_MAX_TASKS-1 get their own statistics, slot 0 collects the
+ * tasks that are not numbered yet */
+#define PROFILER_MAX_TASKS              16
+#define PROFILER_TASK_NAME_LENGTH       8
+
+#define PROFILER_REPORT_PERIOD_MS       1000
+
+/*
+ * Report frame, all fields little endian, times in run time counter ticks:
+ *   0xA5 0x5A                    sync
+ *   uint8  version               PROFILER_FRAME_VERSION
+ *   uint8  record count
+ *   uint32 window length         run time counter ticks since the previous report
+ *   record count times:
+ *     uint8  task number
+ *     char   name[8]             zero padded, not terminated when 8 chars long
+ *     uint16 cpu share           in 0.01% of the window
+ *     uint16 burst count         switched in --> switched out intervals in the window
+ *     uint32 min, avg, max burst
+ *     uint32 jitter              max - min interval between two consecutive switch ins
+ *     version 2 only, with configAPP_DEADLINE_MONITOR (zero for a task not monitored):
+ *     uint16 jobs                jobs completed in the window
+ *     uint16 misses              jobs completed after their deadline
+ *     int32  max lateness        in us, completion - deadline, negative when every job met it
+ *     uint16 histogram[8]        response times in quarters of the deadline (APP/DEADLINE)
+ *   uint8  checksum              the sum of every byte after the sync is 0
+ */
+#define PROFILER_FRAME_SYNC0            0xA5
+#define PROFILER_FRAME_SYNC1            0x5A
+#define PROFILER_FRAME_HEADER_SIZE      8
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+#define PROFILER_FRAME_VERSION          2
+#define PROFILER_FRAME_RECORD_SIZE      53
+#else
+#define PROFILER_FRAME_VERSION          1
+#define PROFILER_FRAME_RECORD_SIZE      29
+#endif
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Trace hooks, called by the kernel from traceTASK_SWITCHED_IN/OUT (FreeRTOSConfig.h)
+ * with the task number of the current task. Must not be called from the application.
+ */
+void Profiler_TaskSwitchedIn(uint32 uTaskNumber);
+void Profiler_TaskSwitchedOut(uint32 uTaskNumber);
+
+/*
+ * Description :
+ * Number the tasks that are not numbered yet, then send one report frame over UART0
+ * covering the time since the previous report and start a new window.
+ * Called periodically from a task, every PROFILER_REPORT_PERIOD_MS.
+ */
+void Profiler_SendReport(void);
+
+#endif /* PROFILER_H_ */
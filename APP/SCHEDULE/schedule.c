@@ -0,0 +1,197 @@
+ /******************************************************************************
+ *
+ * Module: SCHEDULE
+ *
+ * File Name: schedule.c
+ *
+ * Description: Source file for the task table of the application.
+ *              The analysis runs once at start up, before the scheduler, with the
+ *              budgets declared in the table and not with measured times: the
+ *              profiler report shows the max burst of each task to check them.
+ *
+ *******************************************************************************/
+
+#include "schedule.h"
+
+#include "APP/DEADLINE/deadline.h"
+
+/*******************************************************************************
+ *                              Private Functions Prototypes                   *
+ *******************************************************************************/
+
+static void Schedule_AssignPriorities(ScheduleTask_t *pTable, uint32 uCount);
+#if ( configUSE_EDF_SCHEDULING == 1 )
+static uint32 Schedule_DensityPpm(const ScheduleTask_t *pTable, uint32 uCount);
+#else
+static uint32 Schedule_ResponseTimeUs(const ScheduleTask_t *pTable, uint32 uCount, uint32 uTask);
+#endif
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+boolean Schedule_Init(ScheduleTask_t *pTable, uint32 uCount)
+{
+    uint32 uUtilisationPpm = 0;
+    boolean bSchedulable = TRUE;
+    uint32 uIndex;
+
+    Schedule_AssignPriorities(pTable, uCount);
+
+    for (uIndex = 0; uIndex < uCount; uIndex++)
+    {
+        /* An entry is either periodic or sporadic, and may not finish after its next release */
+        if (((pTable[uIndex].Job == NULL_PTR) == (pTable[uIndex].TaskCode == NULL_PTR)) ||
+            (pTable[uIndex].PeriodMs == 0) || (pTable[uIndex].DeadlineMs > pTable[uIndex].PeriodMs))
+        {
+            bSchedulable = FALSE;
+        }
+        else
+        {
+            /* The budget in us * 1000 / the period in ms is the CPU share in parts per million */
+            uUtilisationPpm += (pTable[uIndex].WcetUs * 1000UL) / pTable[uIndex].PeriodMs;
+        }
+    }
+
+    /* Over 100% no priority order can meet every deadline */
+    if ((!bSchedulable) || (uUtilisationPpm > 1000000UL))
+    {
+        return FALSE;
+    }
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    /* Earliest deadline first meets every deadline while the jobs fit in their deadline */
+    return (Schedule_DensityPpm(pTable, uCount) <= 1000000UL) ? TRUE : FALSE;
+#else
+
+    for (uIndex = 0; uIndex < uCount; uIndex++)
+    {
+        pTable[uIndex].ResponseTimeUs = Schedule_ResponseTimeUs(pTable, uCount, uIndex);
+        if (pTable[uIndex].ResponseTimeUs > (pTable[uIndex].DeadlineMs * 1000UL))
+        {
+            bSchedulable = FALSE;
+        }
+    }
+
+    return bSchedulable;
+#endif
+}
+
+void Schedule_PeriodicTask(void *pvParameters)
+{
+    const ScheduleTask_t *pTask = (const ScheduleTask_t *)pvParameters;
+    const TickType_t xPeriod = pdMS_TO_TICKS(pTask->PeriodMs);
+    TickType_t xLastWakeTime = xTaskGetTickCount();
+
+    for (;;)
+    {
+        Deadline_JobStarted();
+        pTask->Job();
+        Deadline_JobCompleted();
+        (void)xTaskDelayUntil(&xLastWakeTime, xPeriod);
+    }
+}
+
+/*******************************************************************************
+ *                         Private Functions Definitions                       *
+ *******************************************************************************/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* The kernel orders the tasks of configEDF_PRIORITY by the deadlines set by main */
+static void Schedule_AssignPriorities(ScheduleTask_t *pTable, uint32 uCount)
+{
+    uint32 uTask;
+
+    for (uTask = 0; uTask < uCount; uTask++)
+    {
+        pTable[uTask].Priority = configEDF_PRIORITY;
+        pTable[uTask].ResponseTimeUs = 0;
+    }
+}
+
+/* Sum of WcetUs / DeadlineMs in parts per million, sufficient for deadlines up to the period */
+static uint32 Schedule_DensityPpm(const ScheduleTask_t *pTable, uint32 uCount)
+{
+    uint32 uDensityPpm = 0;
+    uint32 uTask;
+
+    for (uTask = 0; uTask < uCount; uTask++)
+    {
+        if (pTable[uTask].DeadlineMs == 0)
+        {
+            return 0xFFFFFFFFUL;
+        }
+        uDensityPpm += (pTable[uTask].WcetUs * 1000UL) / pTable[uTask].DeadlineMs;
+    }
+    return uDensityPpm;
+}
+
+#else
+
+/* Deadline monotonic: the rank of a task is the number of distinct deadlines shorter
+ * than its own, tasks with the same deadline share a level */
+static void Schedule_AssignPriorities(ScheduleTask_t *pTable, uint32 uCount)
+{
+    uint32 uTask;
+    uint32 uOther;
+    uint32 uFirst;
+    uint32 uRank;
+
+    for (uTask = 0; uTask < uCount; uTask++)
+    {
+        uRank = 0;
+        for (uOther = 0; uOther < uCount; uOther++)
+        {
+            if (pTable[uOther].DeadlineMs >= pTable[uTask].DeadlineMs)
+            {
+                continue;
+            }
+            /* Count each shorter deadline once, at its first entry */
+            for (uFirst = 0; pTable[uFirst].DeadlineMs != pTable[uOther].DeadlineMs; uFirst++)
+            {
+            }
+            if (uFirst == uOther)
+            {
+                uRank++;
+            }
+        }
+
+        if (uRank >= SCHEDULE_PRIORITY_LEVELS)
+        {
+            uRank = SCHEDULE_PRIORITY_LEVELS - 1;
+        }
+        pTable[uTask].Priority = SCHEDULE_HIGHEST_PRIORITY - uRank;
+    }
+}
+
+/* R = C + sum over the tasks of the same or a higher priority of ceil(R / T) * C,
+ * iterated from R = C until it stops growing or passes the deadline. A task of the
+ * same priority is counted as interference, the kernel may run it first. */
+static uint32 Schedule_ResponseTimeUs(const ScheduleTask_t *pTable, uint32 uCount, uint32 uTask)
+{
+    const uint64 uDeadlineUs = (uint64)pTable[uTask].DeadlineMs * 1000UL;
+    uint64 uResponseUs = pTable[uTask].WcetUs;
+    uint64 uPreviousUs = 0;
+    uint64 uPeriodUs;
+    uint32 uOther;
+
+    while ((uResponseUs != uPreviousUs) && (uResponseUs <= uDeadlineUs))
+    {
+        uPreviousUs = uResponseUs;
+        uResponseUs = pTable[uTask].WcetUs;
+        for (uOther = 0; uOther < uCount; uOther++)
+        {
+            if ((uOther != uTask) && (pTable[uOther].Priority >= pTable[uTask].Priority))
+            {
+                uPeriodUs = (uint64)pTable[uOther].PeriodMs * 1000UL;
+                uResponseUs += ((uPreviousUs + uPeriodUs - 1) / uPeriodUs) * pTable[uOther].WcetUs;
+            }
+        }
+    }
+
+    /* Past the deadline the exact value does not matter, it only has to stay past it */
+    return (uResponseUs > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : (uint32)uResponseUs;
+}
+
+#endif /* configUSE_EDF_SCHEDULING == 1 */
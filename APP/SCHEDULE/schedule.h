@@ -0,0 +1,83 @@
+ /******************************************************************************
+ *
+ * Module: SCHEDULE
+ *
+ * File Name: schedule.h
+ *
+ * Description: Header file for the task table of the application. Each task is
+ *              declared with its period, deadline, execution time budget and
+ *              stack, the priorities are derived from the deadlines (deadline
+ *              monotonic, the same as rate monotonic when the deadline is the
+ *              period) and the table is checked with a response time analysis
+ *              before any task is created. With configUSE_EDF_SCHEDULING every
+ *              task runs at configEDF_PRIORITY, earliest deadline first.
+ *
+ *******************************************************************************/
+
+#ifndef SCHEDULE_H_
+#define SCHEDULE_H_
+
+#include "std_types.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Priorities given to the table, the level above is kept for the timer service task.
+ * Tasks with the shortest deadlines get the highest level, the levels run out after
+ * SCHEDULE_PRIORITY_LEVELS distinct deadlines and the rest share the lowest one. */
+#define SCHEDULE_HIGHEST_PRIORITY       ( configMAX_PRIORITIES - 2 )
+#define SCHEDULE_LOWEST_PRIORITY        ( tskIDLE_PRIORITY + 1 )
+#define SCHEDULE_PRIORITY_LEVELS        ( SCHEDULE_HIGHEST_PRIORITY - SCHEDULE_LOWEST_PRIORITY + 1 )
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* One job of a periodic task, runs to completion */
+typedef void (*ScheduleJob_t)(void);
+
+typedef struct
+{
+    ScheduleJob_t Job;              /* Periodic task: one job, released every PeriodMs. NULL_PTR for a sporadic task */
+    TaskFunction_t TaskCode;        /* Sporadic task: its own loop, released by signals. NULL_PTR for a periodic task */
+    const char *Name;
+    uint32 PeriodMs;                /* Period, or the shortest time between two releases of a sporadic task */
+    uint32 DeadlineMs;              /* Relative to the release, at most PeriodMs */
+    uint32 WcetUs;                  /* Execution time budget of one job, kernel overhead included */
+    uint16 StackDepth;              /* In words */
+    TaskHandle_t *Handle;           /* Filled when the task is created */
+    UBaseType_t Priority;           /* Set by Schedule_Init */
+    uint32 ResponseTimeUs;          /* Worst case response time, set by Schedule_Init with fixed priorities */
+} ScheduleTask_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Assigns the priority of every task of the table from its deadline, then runs the
+ * response time analysis: each task is delayed by every task of the same or a higher
+ * priority released with it (critical instant), sporadic tasks counted at their
+ * shortest inter-release time. Returns FALSE if the total utilisation is above 100%
+ * or a worst case response time exceeds its deadline, the table must then be fixed
+ * before any task is created.
+ * With configUSE_EDF_SCHEDULING the tasks share configEDF_PRIORITY and the table is
+ * rejected when the sum of WcetUs / DeadlineMs is above 100% (density test).
+ */
+boolean Schedule_Init(ScheduleTask_t *pTable, uint32 uCount);
+
+/*
+ * Description :
+ * Task code of a periodic entry, created with the entry as its parameter. Releases
+ * the job on a fixed grid of PeriodMs from the first release with xTaskDelayUntil,
+ * so the execution time of the job does not shift the next release.
+ */
+void Schedule_PeriodicTask(void *pvParameters);
+
+#endif /* SCHEDULE_H_ */
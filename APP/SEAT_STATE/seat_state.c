@@ -0,0 +1,84 @@
+ /******************************************************************************
+ *
+ * Module: SEAT_STATE
+ *
+ * File Name: seat_state.c
+ *
+ * Description: Source file for the shared driver/passenger seat state snapshot.
+ *              The state is guarded by a sequence counter (seqlock): a writer makes
+ *              the counter odd, updates the fields and makes it even again, a reader
+ *              copies the state and retries if the counter was odd or has moved.
+ *
+ *******************************************************************************/
+
+#include "seat_state.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "atomic.h"
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+static volatile uint32 g_Sequence = 0;
+static volatile SeatState_t g_State = {
+    { Off, 0, Offheat },    /* Driver */
+    { Off, 0, Offheat }     /* Passenger */
+};
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void SeatState_Read(SeatState_t *pState)
+{
+    uint32 uSequence;
+
+    do
+    {
+        uSequence = g_Sequence;
+        *pState = g_State;
+    }
+    while ((uSequence & 1U) || (uSequence != g_Sequence));
+}
+
+/*
+ * The writers only serialize against each other: the update is a handful of stores
+ * done inside the same short interrupt mask the atomic.h operations use on this port.
+ */
+void SeatState_SetDesiredTemperatures(uint32 uDriver, uint32 uPassenger)
+{
+    ATOMIC_ENTER_CRITICAL();
+    {
+        g_Sequence++;
+        g_State.Driver.Desired_Temperature = uDriver;
+        g_State.Passenger.Desired_Temperature = uPassenger;
+        g_Sequence++;
+    }
+    ATOMIC_EXIT_CRITICAL();
+}
+
+void SeatState_SetCurrentTemperatures(uint32 uDriver, uint32 uPassenger)
+{
+    ATOMIC_ENTER_CRITICAL();
+    {
+        g_Sequence++;
+        g_State.Driver.Current_Temperature = uDriver;
+        g_State.Passenger.Current_Temperature = uPassenger;
+        g_Sequence++;
+    }
+    ATOMIC_EXIT_CRITICAL();
+}
+
+void SeatState_SetHeaters(uint32 uDriver, uint32 uPassenger)
+{
+    ATOMIC_ENTER_CRITICAL();
+    {
+        g_Sequence++;
+        g_State.Driver.Heater = uDriver;
+        g_State.Passenger.Heater = uPassenger;
+        g_Sequence++;
+    }
+    ATOMIC_EXIT_CRITICAL();
+}
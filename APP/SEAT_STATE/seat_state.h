@@ -0,0 +1,57 @@
+ /******************************************************************************
+ *
+ * Module: SEAT_STATE
+ *
+ * File Name: seat_state.h
+ *
+ * Description: Header file for the shared driver/passenger seat state snapshot
+ *
+ *******************************************************************************/
+
+#ifndef SEAT_STATE_H_
+#define SEAT_STATE_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef enum {Off,Low=25,Medium=30,High=35}Desierd_Heating_Levels;  /*Range of each level*/
+typedef enum {Offheat,Lowheat,Mediumheat,Highheat}Heater_Levels;    /*the heater output level based on desired*/
+
+typedef struct
+{
+    uint32 Desired_Temperature;   /* Desierd_Heating_Levels selected by the seat button */
+    uint32 Current_Temperature;   /* Last LM35 reading of the seat */
+    uint32 Heater;                /* Heater_Levels output of the heating control */
+} SeatValues_t;
+
+typedef struct
+{
+    SeatValues_t Driver;
+    SeatValues_t Passenger;
+} SeatState_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Copy a consistent snapshot of both seats. The reader never blocks and never
+ * masks interrupts, it retries the copy if a writer published in the meantime.
+ * Must not be called from an ISR above configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ */
+void SeatState_Read(SeatState_t *pState);
+
+/*
+ * Description :
+ * Writers publish the fields they own for both seats in one update, so readers
+ * never see the driver and passenger halves from different updates.
+ */
+void SeatState_SetDesiredTemperatures(uint32 uDriver, uint32 uPassenger);
+void SeatState_SetCurrentTemperatures(uint32 uDriver, uint32 uPassenger);
+void SeatState_SetHeaters(uint32 uDriver, uint32 uPassenger);
+
+#endif /* SEAT_STATE_H_ */
@@ -0,0 +1,81 @@
+ /******************************************************************************
+ *
+ * Module: SIGNALS
+ *
+ * File Name: signals.c
+ *
+ * Description: Source file for the task to task signals built on the direct to
+ *              task notifications (notification index 0 used as a bit set).
+ *
+ *******************************************************************************/
+
+#include "signals.h"
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+
+static Signals_t Signal_Wait(Signals_t uSignals, boolean bWaitForAll, TickType_t xTicksToWait);
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Signal_Send(TaskHandle_t xTask, Signals_t uSignals)
+{
+    (void)xTaskNotify(xTask, uSignals, eSetBits);
+}
+
+void Signal_SendFromISR(TaskHandle_t xTask, Signals_t uSignals, BaseType_t *pxHigherPriorityTaskWoken)
+{
+    (void)xTaskNotifyFromISR(xTask, uSignals, eSetBits, pxHigherPriorityTaskWoken);
+}
+
+Signals_t Signal_WaitAny(Signals_t uSignals, TickType_t xTicksToWait)
+{
+    return Signal_Wait(uSignals, FALSE, xTicksToWait);
+}
+
+Signals_t Signal_WaitAll(Signals_t uSignals, TickType_t xTicksToWait)
+{
+    return Signal_Wait(uSignals, TRUE, xTicksToWait);
+}
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/*
+ * The notification value holds the pending bits and is only cleared here, for the
+ * bits that satisfied the wait. A notification that arrives between the check and
+ * xTaskNotifyWait() leaves the task in the pending state so the wait returns at once,
+ * a wake up for bits this call does not wait for just loops back to the check.
+ */
+static Signals_t Signal_Wait(Signals_t uSignals, boolean bWaitForAll, TickType_t xTicksToWait)
+{
+    TimeOut_t xTimeOut;
+    Signals_t uPending;
+
+    configASSERT(uSignals != 0);
+
+    vTaskSetTimeOutState(&xTimeOut);
+
+    for (;;)
+    {
+        /* Clearing no bits only reads the current notification value */
+        uPending = ulTaskNotifyValueClear(NULL, 0) & uSignals;
+
+        if ((bWaitForAll == FALSE) ? (uPending != 0) : (uPending == uSignals))
+        {
+            (void)ulTaskNotifyValueClear(NULL, uPending);
+            return uPending;
+        }
+
+        if (xTaskCheckForTimeOut(&xTimeOut, &xTicksToWait) != pdFALSE)
+        {
+            return 0;
+        }
+
+        (void)xTaskNotifyWait(0, 0, NULL, xTicksToWait);
+    }
+}
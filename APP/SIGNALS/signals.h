@@ -0,0 +1,52 @@
+ /******************************************************************************
+ *
+ * Module: SIGNALS
+ *
+ * File Name: signals.h
+ *
+ * Description: Header file for the task to task signals built on the direct to
+ *              task notifications. Each task owns a 32-bit set of signal bits kept
+ *              in its notification value, so no kernel object is allocated per
+ *              signal. Stream and message buffers block on the same notification,
+ *              so a task that waits on signals must not also block on one of them.
+ *
+ *******************************************************************************/
+
+#ifndef SIGNALS_H_
+#define SIGNALS_H_
+
+#include "std_types.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/* Set of signal bits, the meaning of each bit is defined by the receiving task */
+typedef uint32 Signals_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Set the given signal bits of the receiving task and unblock it if it waits on them.
+ * Setting a bit that is already set has no effect, as with a binary semaphore.
+ */
+void Signal_Send(TaskHandle_t xTask, Signals_t uSignals);
+void Signal_SendFromISR(TaskHandle_t xTask, Signals_t uSignals, BaseType_t *pxHigherPriorityTaskWoken);
+
+/*
+ * Description :
+ * Block the calling task until any (WaitAny) or all (WaitAll) of the given signal
+ * bits are set or the timeout expires. The bits that satisfied the wait are cleared
+ * and returned, the other pending bits are kept. Returns 0 on timeout.
+ */
+Signals_t Signal_WaitAny(Signals_t uSignals, TickType_t xTicksToWait);
+Signals_t Signal_WaitAll(Signals_t uSignals, TickType_t xTicksToWait);
+
+#endif /* SIGNALS_H_ */
@@ -0,0 +1,117 @@
+ /******************************************************************************
+ *
+ * Module: TRACE
+ *
+ * File Name: trace.c
+ *
+ * Description: Source file for the scheduler trace recorder.
+ *              A record slot is claimed and filled with the kernel interrupts
+ *              masked, so records from tasks and ISRs never interleave. The
+ *              recorder is a single initialized structure that a debugger can
+ *              save as it is (symbol g_TraceRecorder).
+ *
+ *******************************************************************************/
+
+#include "trace.h"
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* MCAL includes. */
+#include "GPTM.h"
+
+#if ( configAPP_TRACE_RECORDER == 1 )
+
+/*******************************************************************************
+ *                              Global Variables                               *
+ *******************************************************************************/
+
+/* Not static, the debugger saves it by name */
+TraceRecorder_t g_TraceRecorder =
+{
+    .Magic       = TRACE_MAGIC,
+    .Version     = TRACE_VERSION,
+    .RecordSize  = sizeof(TraceRecord_t),
+    .RecordCount = TRACE_BUFFER_RECORDS,
+    .TaskCount   = TRACE_MAX_TASKS,
+    .Head        = 0,
+    .Enabled     = TRUE
+};
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void Trace_Event(uint8 uEvent, const void *pObject, uint32 uValue)
+{
+    UBaseType_t uxSavedInterruptStatus;
+    TraceRecord_t *pRecord;
+
+    if (!g_TraceRecorder.Enabled)
+    {
+        return;
+    }
+
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    pRecord = &g_TraceRecorder.Records[g_TraceRecorder.Head & (TRACE_BUFFER_RECORDS - 1)];
+    g_TraceRecorder.Head++;
+    pRecord->Timestamp = (uint32)GPTM_WTimer0ReadUs();
+    pRecord->Object = (uint32)(portPOINTER_SIZE_TYPE)pObject;
+    pRecord->Value = uValue;
+    pRecord->Event = uEvent;
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+}
+
+void Trace_TaskCreated(const void *pTask, const char *pcName, uint32 uPriority)
+{
+    uint32 uHandle = (uint32)(portPOINTER_SIZE_TYPE)pTask;
+    TraceTask_t *pEntry = NULL_PTR;
+    uint32 uIndex;
+
+    /* Called inside the kernel critical section of the task creation. A deleted task
+     * whose memory is reused for a new one gets the new name */
+    for (uIndex = 0; uIndex < TRACE_MAX_TASKS; uIndex++)
+    {
+        if ((g_TraceRecorder.Tasks[uIndex].Task == uHandle) ||
+            ((pEntry == NULL_PTR) && (g_TraceRecorder.Tasks[uIndex].Task == 0)))
+        {
+            pEntry = &g_TraceRecorder.Tasks[uIndex];
+            if (pEntry->Task == uHandle)
+            {
+                break;
+            }
+        }
+    }
+
+    if (pEntry != NULL_PTR)
+    {
+        pEntry->Task = uHandle;
+        for (uIndex = 0; uIndex < TRACE_TASK_NAME_LENGTH; uIndex++)
+        {
+            pEntry->Name[uIndex] = pcName[uIndex];
+            if (pcName[uIndex] == '\0')
+            {
+                break;
+            }
+        }
+        for (; uIndex < TRACE_TASK_NAME_LENGTH; uIndex++)
+        {
+            pEntry->Name[uIndex] = '\0';
+        }
+    }
+
+    Trace_Event(TRACE_EVENT_TASK_CREATE, pTask, uPriority);
+}
+
+void Trace_Stop(void)
+{
+    g_TraceRecorder.Enabled = FALSE;
+}
+
+void Trace_Start(void)
+{
+    g_TraceRecorder.Enabled = TRUE;
+}
+
+#endif /* configAPP_TRACE_RECORDER == 1 */
@@ -0,0 +1,110 @@
+ /******************************************************************************
+ *
+ * Module: TRACE
+ *
+ * File Name: trace.h
+ *
+ * Description: Header file for the scheduler trace recorder. The kernel trace hooks
+ *              (FreeRTOSConfig.h) write fixed size timestamped records into a RAM
+ *              ring, the ring is read back with the debugger and converted into a
+ *              timeline by Tools/trace_decode.py.
+ *
+ *******************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Records kept in the ring, the oldest are overwritten. Must be a power of 2 */
+#define TRACE_BUFFER_RECORDS        256
+
+/* Task names kept for the decoder, tasks created after the table is full stay unnamed */
+#define TRACE_MAX_TASKS             16
+#define TRACE_TASK_NAME_LENGTH      16
+
+/* "TRC1" in a little endian dump, the decoder searches a RAM dump for it */
+#define TRACE_MAGIC                 0x31435254UL
+#define TRACE_VERSION               1
+
+/* Event of a record. Object is the address of the task or queue the event is about,
+ * Value is given for each event */
+#define TRACE_EVENT_TASK_SWITCHED_IN        1   /* task,   priority */
+#define TRACE_EVENT_TASK_CREATE             2   /* task,   priority */
+#define TRACE_EVENT_TASK_DELETE             3   /* task,   0 */
+#define TRACE_EVENT_TASK_DELAY              4   /* task,   ticks to delay */
+#define TRACE_EVENT_TASK_DELAY_UNTIL        5   /* task,   tick to wake */
+#define TRACE_EVENT_QUEUE_SEND              6   /* queue,  messages waiting before */
+#define TRACE_EVENT_QUEUE_SEND_FAILED       7   /* queue,  messages waiting */
+#define TRACE_EVENT_QUEUE_SEND_FROM_ISR     8   /* queue,  messages waiting before */
+#define TRACE_EVENT_QUEUE_RECEIVE           9   /* queue,  messages waiting before */
+#define TRACE_EVENT_QUEUE_RECEIVE_FAILED    10  /* queue,  messages waiting */
+#define TRACE_EVENT_QUEUE_RECEIVE_FROM_ISR  11  /* queue,  messages waiting before */
+#define TRACE_EVENT_BLOCKING_ON_QUEUE_SEND  12  /* queue,  messages waiting */
+#define TRACE_EVENT_BLOCKING_ON_QUEUE_RECEIVE 13 /* queue, messages waiting */
+#define TRACE_EVENT_TASK_NOTIFY             14  /* notified task, notification value */
+#define TRACE_EVENT_TASK_NOTIFY_FROM_ISR    15  /* notified task, notification value */
+#define TRACE_EVENT_TASK_NOTIFY_WAIT_BLOCK  16  /* waiting task,  notification value */
+#define TRACE_EVENT_TASK_NOTIFY_WAIT        17  /* waiting task,  notification value */
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+/*
+ * Layout of the recorder in RAM, all fields little endian. The decoder reads it as
+ * is, so any change here must come with a new TRACE_VERSION.
+ */
+typedef struct
+{
+    uint32 Timestamp;           /* Low 32 bits of GPTM_WTimer0ReadUs() */
+    uint32 Object;              /* Low 32 bits of the task or queue address */
+    uint32 Value;
+    uint8 Event;                /* TRACE_EVENT_* */
+    uint8 Reserved[3];
+} TraceRecord_t;
+
+typedef struct
+{
+    uint32 Task;                /* Address of the task, 0 for a free entry */
+    char Name[TRACE_TASK_NAME_LENGTH];  /* Zero padded, not terminated when 16 chars long */
+} TraceTask_t;
+
+typedef struct
+{
+    uint32 Magic;
+    uint16 Version;
+    uint16 RecordSize;
+    uint16 RecordCount;
+    uint16 TaskCount;
+    uint32 Head;                /* Records written since the start, the next goes to Head % RecordCount */
+    uint32 Enabled;
+    TraceTask_t Tasks[TRACE_MAX_TASKS];
+    TraceRecord_t Records[TRACE_BUFFER_RECORDS];
+} TraceRecorder_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Trace hooks, called by the kernel from the trace macros of FreeRTOSConfig.h with
+ * the kernel interrupts masked or the scheduler suspended. Safe from tasks and ISRs.
+ */
+void Trace_Event(uint8 uEvent, const void *pObject, uint32 uValue);
+void Trace_TaskCreated(const void *pTask, const char *pcName, uint32 uPriority);
+
+/*
+ * Description :
+ * Stop recording, so the ring keeps the events that led to a fault until it is
+ * read back, and start again. Recording is on from reset.
+ */
+void Trace_Stop(void);
+void Trace_Start(void);
+
+#endif /* TRACE_H_ */
@@ -1,174 +1,379 @@
-/*
- * -------------------------------------------------------------------------
- * FreeRTOS Kernel Configuration File V1.0.0
- * Copyright (C) 2024 Edges For Training.  All Rights Reserved.
- * -------------------------------------------------------------------------
- * Application specific definitions.
- *
- * These definitions should be adjusted for your particular hardware and
- * application requirements.
- *
- * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
- * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
- *
- * See http://www.freertos.org/a00110.html.
- * -------------------------------------------------------------------------
- */
-
-#ifndef FREERTOS_CONFIG_H
-#define FREERTOS_CONFIG_H
-
-#include "GPTM.h"
-#include "std_types.h"
-/******************************************************************************/
-/* Scheduling behavior related definitions. **********************************/
-/******************************************************************************/
-
-/* configCPU_CLOCK_HZ must be set to the frequency of the clock that drives 
- * the peripheral used to generate the kernels periodic tick interrupt.
- * This is very often, but not always, equal to the main system clock frequency.
- * Default frequency in Tiva-C Micro-controllers is 16Mhz */
-#define configCPU_CLOCK_HZ                    (( unsigned long )16000000)
-
-/* configTICK_RATE_HZ sets frequency of the tick interrupt in Hz, so
- * in our case Tick time will be 10ms */
-#define configTICK_RATE_HZ                    ((TickType_t)100)
-
-/* Size of the stack allocated to the Idle task. 128 Words = 512 Bytes */
-#define configMINIMAL_STACK_SIZE              (128)
-
-/* configMAX_PRIORITIES Sets the number of available task priorities.  Tasks can
- * be assigned priorities of 0 to (configMAX_PRIORITIES - 1).  Zero is the lowest
- * priority. */
-#define configMAX_PRIORITIES                  (7)
-
-/* Set configUSE_PREEMPTION to 1 to use pre-emptive scheduling. Set
- * configUSE_PREEMPTION to 0 to use co-operative scheduling. */
-#define configUSE_PREEMPTION                  (1)                
-
-/* When configUSE_16_BIT_TICKS is set to 1, TickType_t is defined
- * to be an unsigned 16-bit type. When configUSE_16_BIT_TICKS is set to 0, 
- * TickType_t is defined to be an unsigned 32-bit type. */
-#define configUSE_16_BIT_TICKS                0
-
-/******************************************************************************/
-/* Memory allocation related definitions. *************************************/
-/******************************************************************************/
-
-/* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c
- * or heap_4.c are included in the build. This value is defaulted to 4096 bytes but
- * it must be tailored to each application. Note the heap will appear in the .bss
- * section. */
-#define configTOTAL_HEAP_SIZE                 ((size_t)(16384))
-
-/******************************************************************************/
-/* Definitions that include or exclude functionality. *************************/
-/******************************************************************************/
-
-/* Set the following INCLUDE_* constants to 1 to include the named API function,
- * or 0 to exclude the named API function.  Most linkers will remove unused
- * functions even when the constant is 1. */
-#define INCLUDE_vTaskDelay                     1
-#define INCLUDE_vTaskDelete                    1
-#define INCLUDE_xTimerPendFunctionCall         1
-#define INCLUDE_vTaskDelayUntil                1
-#define configUSE_MUTEXES                      1
-#define INCLUDE_vTaskSuspend                   1
-#define configUSE_APPLICATION_TASK_TAG         1
-
-/******************************************************************************/
-/* Software timer related definitions. ****************************************/
-/******************************************************************************/
-
-/* Set configUSE_TIMERS to 1 to include software timer functionality in the
- * build.  Set to 0 to exclude software timer functionality from the build.  The
- * FreeRTOS/source/timers.c source file must be included in the build if
- * configUSE_TIMERS is set to 1.  Default to 0 if left undefined. */
-#define configUSE_TIMERS                      1
-
-/* configTIMER_TASK_PRIORITY sets the priority used by the timer task.  Only
- * used if configUSE_TIMERS is set to 1.  The timer task is a standard FreeRTOS
- * task, so its priority is set like any other task. Only used if configUSE_TIMERS 
- * is set to 1. */
-#define configTIMER_TASK_PRIORITY             (configMAX_PRIORITIES - 1)
-
- /* configTIMER_QUEUE_LENGTH sets the length of the queue (the number of discrete
- * items the queue can hold) used to send commands to the timer task. Only used
- * if configUSE_TIMERS is set to 1. */
-#define configTIMER_QUEUE_LENGTH              10
-
-/* configTIMER_TASK_STACK_DEPTH sets the size of the stack allocated to the
- * timer task (in words, not in bytes!).  The timer task is a standard FreeRTOS
- * task. Only used if configUSE_TIMERS is set to 1. */
-#define configTIMER_TASK_STACK_DEPTH          configMINIMAL_STACK_SIZE
-/******************************************************************************/
-/* Hook and callback function related definitions. ****************************/
-/******************************************************************************/
-
-/* Set the following configUSE_* constants to 1 to include the named hook
- * functionality in the build.  Set to 0 to exclude the hook functionality from the
- * build.  The application writer is responsible for providing the hook function
- * for any set to 1. */
-#define configUSE_IDLE_HOOK                   0
-#define configUSE_TICK_HOOK                   0
-
-/******************************************************************************/
-/* ARM Cortex-M Specific Definitions. *****************************************/
-/******************************************************************************/
-
-/* Tiva-C Micro-controllers use 3-bits as priority bits for each interrupt in NVIC PRI registers - 8 priority levels */
-#define configPRIO_BITS                               3
-
-/* The lowest interrupt priority that can be used */
-#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY       7
-
-/* The highest interrupt priority that can be used by any interrupt service
-routine that makes calls to interrupt safe FreeRTOS API functions.  DO NOT CALL
-INTERRUPT SAFE FREERTOS API FUNCTIONS FROM ANY INTERRUPT THAT HAS A HIGHER
-PRIORITY THAN THIS! (higher priorities are lower numeric values. */
-#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY  5
-
-/* Interrupt priorities used by the kernel port layer itself (the tick and context switch performing interrupts).
- * This implementation is generic to all Cortex-M ports, and do not rely on any particular library functions. */
-#define configKERNEL_INTERRUPT_PRIORITY               (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
-
-/* It sets the interrupt priority above which FreeRTOS API calls must not be made.  
- * Interrupts above this priority are never disabled, so never delayed by RTOS activity. 
- * This implementation is generic to all Cortex-M ports, and do not rely on any particular library functions. */
-#define configMAX_SYSCALL_INTERRUPT_PRIORITY          (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
-
-/******************************************************************************/
-/* Debugging assistance. ******************************************************/
-/******************************************************************************/
-
-/* Normal assert() semantics without relying on the provision of an assert.h header file. */
-#define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
-/* Set configGENERATE_RUN_TIME_STATS to 1 to enable collection of run-time statistics.
- * When this is done, both portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
- * and portGET_RUN_TIME_COUNTER_VALUE() or portALT_GET_RUN_TIME_COUNTER_VALUE(x) must also be defined. */
-#define configGENERATE_RUN_TIME_STATS 1
-
-/* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() is defined to call the function that initializes
-   the 32-bit timer */
-#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() GPTM_WTimer0Init()
-
-/* portGET_RUN_TIME_COUNTER_VALUE() is defined to get the current run-time
- * timer value. The returned time value is 32-bits long, and is formed by subtracting the
- * current timer value from its max value because of our timer is counting down  */
-#define portGET_RUN_TIME_COUNTER_VALUE()  GPTM_WTimer0Read()
-
-/* Set to 1 to include the vTaskList() and vTaskGetRunTimeStats() functions in
- * the build.  Set to 0 to exclude these functions from the build.  These two
- * functions introduce a dependency on string formatting functions that would
- * otherwise not exist - hence they are kept separate.  Defaults to 0 if left
- * undefined. */
-#define configUSE_STATS_FORMATTING_FUNCTIONS 1
-
-/* Set configUSE_TRACE_FACILITY to include additional task structure members
- * are used by trace and visualization functions and tools.  Set to 0 to exclude
- * the additional information from the structures. Defaults to 0 if left
- * undefined. */
-#define configUSE_TRACE_FACILITY             1
-
-
-#endif /* FREERTOS_CONFIG_H */
+/*
+ * -------------------------------------------------------------------------
+ * FreeRTOS Kernel Configuration File V1.0.0
+ * Copyright (C) 2024 Edges For Training.  All Rights Reserved.
+ * -------------------------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ *
+ * See http://www.freertos.org/a00110.html.
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include "GPTM.h"
+#include "DWT/dwt.h"
+#include "std_types.h"
+#ifdef SIMULATION
+#include "sim_clock.h"
+#endif
+/******************************************************************************/
+/* Scheduling behavior related definitions. **********************************/
+/******************************************************************************/
+
+/* configCPU_CLOCK_HZ must be set to the frequency of the clock that drives 
+ * the peripheral used to generate the kernels periodic tick interrupt.
+ * This is very often, but not always, equal to the main system clock frequency.
+ * Default frequency in Tiva-C Micro-controllers is 16Mhz */
+#define configCPU_CLOCK_HZ                    (( unsigned long )16000000)
+
+/* configTICK_RATE_HZ sets frequency of the tick interrupt in Hz, so
+ * in our case Tick time will be 10ms */
+#define configTICK_RATE_HZ                    ((TickType_t)100)
+
+/* Size of the stack allocated to the Idle task. 128 Words = 512 Bytes */
+#define configMINIMAL_STACK_SIZE              (128)
+
+/* configMAX_PRIORITIES Sets the number of available task priorities.  Tasks can
+ * be assigned priorities of 0 to (configMAX_PRIORITIES - 1).  Zero is the lowest
+ * priority. */
+#define configMAX_PRIORITIES                  (7)
+
+/* Set configUSE_PREEMPTION to 1 to use pre-emptive scheduling. Set
+ * configUSE_PREEMPTION to 0 to use co-operative scheduling. */
+#define configUSE_PREEMPTION                  (1)                
+
+/* Set configUSE_EDF_SCHEDULING to 1 to run the ready tasks of priority
+ * configEDF_PRIORITY earliest deadline first (vTaskSetDeadline() in task.h)
+ * instead of round robin. The tasks of the table (APP/SCHEDULE) then all run at
+ * that priority with the deadline of their entry. The other priorities keep the
+ * fixed priority order. */
+#define configUSE_EDF_SCHEDULING              0
+#define configEDF_PRIORITY                    ( configMAX_PRIORITIES - 2 )
+
+/* Set configUSE_TASK_TIMING_WHEEL to 1 to keep the delayed tasks in a timing
+ * wheel (Source/timing_wheel.c) instead of the two sorted delayed lists. A task
+ * then blocks in constant time whatever the number of blocked tasks, for 2.5 KB
+ * of slot lists. Each level of the wheel decodes configTIMING_WHEEL_SLOT_BITS
+ * bits of the tick count. */
+#define configUSE_TASK_TIMING_WHEEL           0
+#define configTIMING_WHEEL_SLOT_BITS          4
+
+/* When configUSE_16_BIT_TICKS is set to 1, TickType_t is defined
+ * to be an unsigned 16-bit type. When configUSE_16_BIT_TICKS is set to 0, 
+ * TickType_t is defined to be an unsigned 32-bit type. */
+#define configUSE_16_BIT_TICKS                0
+
+/******************************************************************************/
+/* Memory allocation related definitions. *************************************/
+/******************************************************************************/
+
+/* Build profile. Set configAPP_STATIC_ALLOCATION_PROFILE to 1 to create every
+ * task of the application, and the idle and timer tasks, from compile time
+ * storage in main.c. The heap files then compile to nothing, so there is no
+ * heap at all and an object that does not fit fails the link instead of a
+ * pvPortMalloc() at runtime. Set to 0 for the heap and pools below. */
+#ifndef configAPP_STATIC_ALLOCATION_PROFILE
+#define configAPP_STATIC_ALLOCATION_PROFILE   0
+#endif
+
+#if ( configAPP_STATIC_ALLOCATION_PROFILE == 1 )
+    #define configSUPPORT_STATIC_ALLOCATION   1
+    #define configSUPPORT_DYNAMIC_ALLOCATION  0
+#else
+    #define configSUPPORT_STATIC_ALLOCATION   0
+    #define configSUPPORT_DYNAMIC_ALLOCATION  1
+#endif
+
+/* Set to 1 to take the heap from heap_tlsf.c, a constant time allocator that
+ * combines adjacent free blocks, instead of heap_2.c. Both files stay in the
+ * build, the one not selected compiles to nothing. */
+#define configUSE_TLSF_HEAP                   1
+
+/* Set to 1 to serve the task control blocks and the task stacks from the fixed
+ * size pools of heap_pool.c, in front of the heap below. The pools are reserved
+ * on top of configTOTAL_HEAP_SIZE, which then only holds the idle and timer task
+ * stacks, the timer queue and anything the pools do not fit. One TCB for each
+ * of the 7 application tasks plus the idle and timer tasks, one 256 word stack
+ * for each application task. */
+#ifndef configUSE_OBJECT_POOLS
+#define configUSE_OBJECT_POOLS                1
+#endif
+#define configPOOL_TASK_COUNT                 9
+#define configPOOL_STACK_COUNT                7
+#define configPOOL_STACK_SIZE                 (256 * sizeof(StackType_t))
+
+/* Sets the total size of the FreeRTOS heap, in bytes, when heap_1.c, heap_2.c
+ * or heap_4.c are included in the build. This value is defaulted to 4096 bytes but
+ * it must be tailored to each application. Note the heap will appear in the .bss
+ * section. Without the pools every task is allocated from the heap, which needs
+ * its full size back. */
+#ifdef SIMULATION
+/* The host build has 64-bit pointers and stack words, twice the target size */
+#if ( configUSE_OBJECT_POOLS == 1 )
+#define configTOTAL_HEAP_SIZE                 ((size_t)(16384))
+#else
+#define configTOTAL_HEAP_SIZE                 ((size_t)(32768))
+#endif
+#else
+#if ( configUSE_OBJECT_POOLS == 1 )
+#define configTOTAL_HEAP_SIZE                 ((size_t)(8192))
+#else
+#define configTOTAL_HEAP_SIZE                 ((size_t)(16384))
+#endif
+#endif
+
+/******************************************************************************/
+/* Definitions that include or exclude functionality. *************************/
+/******************************************************************************/
+
+/* Set the following INCLUDE_* constants to 1 to include the named API function,
+ * or 0 to exclude the named API function.  Most linkers will remove unused
+ * functions even when the constant is 1. */
+#define INCLUDE_vTaskDelay                     1
+#define INCLUDE_vTaskDelete                    1
+#define INCLUDE_xTimerPendFunctionCall         1
+#define INCLUDE_vTaskDelayUntil                1
+#define configUSE_MUTEXES                      1
+#define INCLUDE_vTaskSuspend                   1
+#define INCLUDE_uxTaskPriorityGet              1
+#define configUSE_APPLICATION_TASK_TAG         1
+
+/******************************************************************************/
+/* Software timer related definitions. ****************************************/
+/******************************************************************************/
+
+/* Set configUSE_TIMERS to 1 to include software timer functionality in the
+ * build.  Set to 0 to exclude software timer functionality from the build.  The
+ * FreeRTOS/source/timers.c source file must be included in the build if
+ * configUSE_TIMERS is set to 1.  Default to 0 if left undefined. */
+#define configUSE_TIMERS                      1
+
+/* configTIMER_TASK_PRIORITY sets the priority used by the timer task.  Only
+ * used if configUSE_TIMERS is set to 1.  The timer task is a standard FreeRTOS
+ * task, so its priority is set like any other task. Only used if configUSE_TIMERS 
+ * is set to 1. */
+#define configTIMER_TASK_PRIORITY             (configMAX_PRIORITIES - 1)
+
+ /* configTIMER_QUEUE_LENGTH sets the length of the queue (the number of discrete
+ * items the queue can hold) used to send commands to the timer task. Only used
+ * if configUSE_TIMERS is set to 1. */
+#define configTIMER_QUEUE_LENGTH              10
+
+/* configTIMER_TASK_STACK_DEPTH sets the size of the stack allocated to the
+ * timer task (in words, not in bytes!).  The timer task is a standard FreeRTOS
+ * task. Only used if configUSE_TIMERS is set to 1. */
+#define configTIMER_TASK_STACK_DEPTH          configMINIMAL_STACK_SIZE
+
+/* Set configUSE_TIMER_TIMING_WHEEL to 1 to keep the active timers in a timing
+ * wheel, as configUSE_TASK_TIMING_WHEEL does for the delayed tasks, instead of
+ * the two sorted active timer lists. Starting or resetting a timer is then
+ * constant time whatever the number of active timers. */
+#define configUSE_TIMER_TIMING_WHEEL          0
+
+/* Set configUSE_TIMER_ISR_COMMAND_RING to 1 to pass the timer commands sent from
+ * interrupts (xTimerStartFromISR(), xTimerResetFromISR()...) through a lock-free
+ * ring of configTIMER_ISR_COMMAND_RING_LENGTH commands instead of the timer queue.
+ * A slot is reserved with a compare and swap (ldrex/strex), the interrupts are not
+ * masked. Only the command that finds the ring empty puts a message on the queue,
+ * the timer task then applies the ring in one pass. Each message of the queue is
+ * marked with the commands of the ring sent before it, so the commands of the
+ * tasks and the interrupts are still applied in the order they were sent. A
+ * command that finds the ring full goes on the queue. The length is a power of 2. */
+#define configUSE_TIMER_ISR_COMMAND_RING      0
+#define configTIMER_ISR_COMMAND_RING_LENGTH   16
+/******************************************************************************/
+/* Hook and callback function related definitions. ****************************/
+/******************************************************************************/
+
+/* Set the following configUSE_* constants to 1 to include the named hook
+ * functionality in the build.  Set to 0 to exclude the hook functionality from the
+ * build.  The application writer is responsible for providing the hook function
+ * for any set to 1. */
+/* The SIMULATION build advances its virtual clock from the idle hook (main.c). */
+#ifdef SIMULATION
+#define configUSE_IDLE_HOOK                   1
+#else
+#define configUSE_IDLE_HOOK                   0
+#endif
+#define configUSE_TICK_HOOK                   0
+
+/* Set configUSE_TICKLESS_IDLE to 1 to stop the tick interrupt while the idle task
+ * expects to stay idle for at least configEXPECTED_IDLE_TIME_BEFORE_SLEEP ticks.
+ * With configUSE_LOW_POWER_TICKLESS_TIMER set to 1 the port enters deep sleep and
+ * measures the idle time with WTimer1, which keeps running from the PIOSC in deep
+ * sleep, instead of the 24-bit SysTick (limited to ~1s), the tick count is then
+ * corrected with vTaskStepTick(). The host port of the SIMULATION build does the
+ * same with the WTimer1 model and the tick and sleep of its virtual clock. */
+#define configUSE_TICKLESS_IDLE                   1
+#define configUSE_LOW_POWER_TICKLESS_TIMER        1
+#define configLOW_POWER_TIMER_CLOCK_HZ            GPTM_SLEEP_TIMER_CLOCK_HZ
+#define configLOW_POWER_TIMER_INIT()              GPTM_WTimer1SleepTimerInit()
+#define configLOW_POWER_TIMER_START( ulCounts )   GPTM_WTimer1SleepStart( ulCounts )
+#ifdef SIMULATION
+#define configTICK_TIMER_STOP()                   SimClock_TickStop()
+#define configTICK_TIMER_START( ulCounts )        SimClock_TickStart( ulCounts )
+#define configWAIT_FOR_INTERRUPT()                vPortRunInterrupt( SimClock_Sleep )
+#endif
+/* configLOW_POWER_TIMER_STOP() is defined with the run time clock below */
+
+/******************************************************************************/
+/* ARM Cortex-M Specific Definitions. *****************************************/
+/******************************************************************************/
+
+/* Tiva-C Micro-controllers use 3-bits as priority bits for each interrupt in NVIC PRI registers - 8 priority levels */
+#define configPRIO_BITS                               3
+
+/* The lowest interrupt priority that can be used */
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY       7
+
+/* The highest interrupt priority that can be used by any interrupt service
+routine that makes calls to interrupt safe FreeRTOS API functions.  DO NOT CALL
+INTERRUPT SAFE FREERTOS API FUNCTIONS FROM ANY INTERRUPT THAT HAS A HIGHER
+PRIORITY THAN THIS! (higher priorities are lower numeric values. */
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY  5
+
+/* Interrupt priorities used by the kernel port layer itself (the tick and context switch performing interrupts).
+ * This implementation is generic to all Cortex-M ports, and do not rely on any particular library functions. */
+#define configKERNEL_INTERRUPT_PRIORITY               (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+/* It sets the interrupt priority above which FreeRTOS API calls must not be made.  
+ * Interrupts above this priority are never disabled, so never delayed by RTOS activity. 
+ * This implementation is generic to all Cortex-M ports, and do not rely on any particular library functions. */
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY          (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+/******************************************************************************/
+/* Debugging assistance. ******************************************************/
+/******************************************************************************/
+
+/* Normal assert() semantics without relying on the provision of an assert.h header file.
+ * The SIMULATION build reports the failed assertion and ends the host process (main.c). */
+#ifdef SIMULATION
+void vAssertCalled( const char * pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+#else
+#define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
+#endif
+/* Set configGENERATE_RUN_TIME_STATS to 1 to enable collection of run-time statistics.
+ * When this is done, both portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+ * and portGET_RUN_TIME_COUNTER_VALUE() or portALT_GET_RUN_TIME_COUNTER_VALUE(x) must also be defined. */
+#define configGENERATE_RUN_TIME_STATS 1
+
+/* Set configAPP_RUN_TIME_CLOCK_DWT to 1 to count the run time in CPU cycles with
+ * the DWT cycle counter, extended to 64-bit by MCAL/DWT, instead of the 1us
+ * timestamp of WTimer0. Single cycle resolution is needed for the short bursts of
+ * tasks like vLedControlTask, and the count does not stop or wrap. */
+#define configAPP_RUN_TIME_CLOCK_DWT 1
+
+#if ( configAPP_RUN_TIME_CLOCK_DWT == 1 )
+#define configRUN_TIME_COUNTER_TYPE  uint64_t
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() DWT_CycleCounterInit()
+#define portGET_RUN_TIME_COUNTER_VALUE()  DWT_CycleCounterRead64()
+#else
+/* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() is defined to call the function that initializes
+   the free running WTimer0 timestamp */
+#define configRUN_TIME_COUNTER_TYPE  uint64_t
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() GPTM_WTimer0Init()
+
+/* portGET_RUN_TIME_COUNTER_VALUE() is defined to get the current run-time
+ * timer value. The returned time value is the 64-bit timestamp in microseconds,
+ * so it does not wrap */
+#define portGET_RUN_TIME_COUNTER_VALUE()  GPTM_WTimer0ReadUs()
+#endif
+
+/* The cycle counter stops in deep sleep, WTimer1 runs at the CPU clock so the
+ * counts it measured are the cycles to add back to the run time clock */
+#if ( configAPP_RUN_TIME_CLOCK_DWT == 1 )
+#define configLOW_POWER_TIMER_STOP()              DWT_CycleCounterSkip( GPTM_WTimer1SleepStop() )
+#else
+#define configLOW_POWER_TIMER_STOP()              GPTM_WTimer1SleepStop()
+#endif
+
+/* Set to 1 to include the vTaskList() and vTaskGetRunTimeStats() functions in
+ * the build.  Set to 0 to exclude these functions from the build.  These two
+ * functions introduce a dependency on string formatting functions that would
+ * otherwise not exist - hence they are kept separate.  Defaults to 0 if left
+ * undefined. */
+/* vTaskList() allocates from the heap, the static profile has none. */
+#if ( configAPP_STATIC_ALLOCATION_PROFILE == 1 )
+#define configUSE_STATS_FORMATTING_FUNCTIONS 0
+#else
+#define configUSE_STATS_FORMATTING_FUNCTIONS 1
+#endif
+
+/* Set configUSE_TRACE_FACILITY to include additional task structure members
+ * are used by trace and visualization functions and tools.  Set to 0 to exclude
+ * the additional information from the structures. Defaults to 0 if left
+ * undefined. */
+#define configUSE_TRACE_FACILITY             1
+
+/* The task switch trace hooks feed the per-task profiler (APP/PROFILER/profiler.c).
+ * They run inside the context switch, the task number is assigned by the profiler
+ * with vTaskSetTaskNumber() and is 0 until then. */
+void Profiler_TaskSwitchedIn(uint32 uTaskNumber);
+void Profiler_TaskSwitchedOut(uint32 uTaskNumber);
+#define traceTASK_SWITCHED_OUT()  Profiler_TaskSwitchedOut( ( uint32 ) pxCurrentTCB->uxTaskNumber )
+
+/* Set configAPP_DEADLINE_MONITOR to 1 to check the response time of each job of the
+ * tasks registered with Deadline_Register() (APP/DEADLINE/deadline.c) against their
+ * deadline, reported with the profiler frame. The tasks mark the start and the end of
+ * their jobs, a job is released the last time the task entered the ready list before
+ * it started. */
+#define configAPP_DEADLINE_MONITOR           1
+
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+#include "APP/DEADLINE/deadline.h"
+#define traceMOVED_TASK_TO_READY_STATE( pxTCB )  Deadline_TaskReady( pxTCB )
+#endif
+
+/* Set configAPP_TRACE_RECORDER to 1 to record the scheduler events below into the
+ * RAM ring of APP/TRACE/trace.c (4KB), read back with the debugger and converted
+ * with Tools/trace_decode.py. The hooks expand inside tasks.c and queue.c, where
+ * pxCurrentTCB, pxTCB and pxQueue are the kernel's own variables. */
+#define configAPP_TRACE_RECORDER             1
+
+#if ( configAPP_TRACE_RECORDER == 1 )
+#include "APP/TRACE/trace.h"
+#define traceTASK_SWITCHED_IN()                                                                    \
+    do {                                                                                           \
+        Profiler_TaskSwitchedIn( ( uint32 ) pxCurrentTCB->uxTaskNumber );                          \
+        Trace_Event( TRACE_EVENT_TASK_SWITCHED_IN, pxCurrentTCB, ( uint32 ) pxCurrentTCB->uxPriority ); \
+    } while( 0 )
+#define traceTASK_CREATE( pxNewTCB )                  Trace_TaskCreated( ( pxNewTCB ), ( pxNewTCB )->pcTaskName, ( uint32 ) ( pxNewTCB )->uxPriority )
+#define traceTASK_DELETE( pxTaskToDelete )            Trace_Event( TRACE_EVENT_TASK_DELETE, ( pxTaskToDelete ), 0 )
+#define traceTASK_DELAY()                             Trace_Event( TRACE_EVENT_TASK_DELAY, pxCurrentTCB, ( uint32 ) xTicksToDelay )
+#define traceTASK_DELAY_UNTIL( xTimeToWake )          Trace_Event( TRACE_EVENT_TASK_DELAY_UNTIL, pxCurrentTCB, ( uint32 ) ( xTimeToWake ) )
+#define traceQUEUE_SEND( pxQueue )                    Trace_Event( TRACE_EVENT_QUEUE_SEND, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FAILED( pxQueue )             Trace_Event( TRACE_EVENT_QUEUE_SEND_FAILED, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_SEND_FROM_ISR( pxQueue )           Trace_Event( TRACE_EVENT_QUEUE_SEND_FROM_ISR, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE( pxQueue )                 Trace_Event( TRACE_EVENT_QUEUE_RECEIVE, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FAILED( pxQueue )          Trace_Event( TRACE_EVENT_QUEUE_RECEIVE_FAILED, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )        Trace_Event( TRACE_EVENT_QUEUE_RECEIVE_FROM_ISR, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )        Trace_Event( TRACE_EVENT_BLOCKING_ON_QUEUE_SEND, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )     Trace_Event( TRACE_EVENT_BLOCKING_ON_QUEUE_RECEIVE, ( pxQueue ), ( uint32 ) ( pxQueue )->uxMessagesWaiting )
+#define traceTASK_NOTIFY( uxIndexToNotify )           Trace_Event( TRACE_EVENT_TASK_NOTIFY, pxTCB, ( uint32 ) pxTCB->ulNotifiedValue[ ( uxIndexToNotify ) ] )
+#define traceTASK_NOTIFY_FROM_ISR( uxIndexToNotify )  Trace_Event( TRACE_EVENT_TASK_NOTIFY_FROM_ISR, pxTCB, ( uint32 ) pxTCB->ulNotifiedValue[ ( uxIndexToNotify ) ] )
+#define traceTASK_NOTIFY_GIVE_FROM_ISR( uxIndexToNotify ) Trace_Event( TRACE_EVENT_TASK_NOTIFY_FROM_ISR, pxTCB, ( uint32 ) pxTCB->ulNotifiedValue[ ( uxIndexToNotify ) ] )
+#define traceTASK_NOTIFY_WAIT_BLOCK( uxIndexToWait )  Trace_Event( TRACE_EVENT_TASK_NOTIFY_WAIT_BLOCK, pxCurrentTCB, ( uint32 ) pxCurrentTCB->ulNotifiedValue[ ( uxIndexToWait ) ] )
+#define traceTASK_NOTIFY_WAIT( uxIndexToWait )        Trace_Event( TRACE_EVENT_TASK_NOTIFY_WAIT, pxCurrentTCB, ( uint32 ) pxCurrentTCB->ulNotifiedValue[ ( uxIndexToWait ) ] )
+#define traceTASK_NOTIFY_TAKE_BLOCK( uxIndexToWait )  Trace_Event( TRACE_EVENT_TASK_NOTIFY_WAIT_BLOCK, pxCurrentTCB, ( uint32 ) pxCurrentTCB->ulNotifiedValue[ ( uxIndexToWait ) ] )
+#define traceTASK_NOTIFY_TAKE( uxIndexToWait )        Trace_Event( TRACE_EVENT_TASK_NOTIFY_WAIT, pxCurrentTCB, ( uint32 ) pxCurrentTCB->ulNotifiedValue[ ( uxIndexToWait ) ] )
+#else
+#define traceTASK_SWITCHED_IN()   Profiler_TaskSwitchedIn( ( uint32 ) pxCurrentTCB->uxTaskNumber )
+#endif
+
+/* Set configAPP_KERNEL_BENCHMARK to 1 to run the kernel micro-benchmarks of
+ * APP/BENCHMARK once at start up, before the first profiler report. The results
+ * are sent on UART0 as CSV lines in CPU cycles per operation, compare them
+ * before and after changing the options of this file. Keep it 0 in the
+ * application build, the tick benchmark moves the tick count forward. */
+#define configAPP_KERNEL_BENCHMARK           0
+
+#endif /* FREERTOS_CONFIG_H */
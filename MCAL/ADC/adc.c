@@ -1,129 +1,224 @@
-/*
- ============================================================================
- Name        : adc.c
- Module Name : ADC
- Author      : asus
- Date        : 28 Sept. 2024
- Description : Source file for the TM4C123GH6PM Microcontroller ADC driver
- ============================================================================
- */
-
-#include "adc.h"
-#include "tm4c123gh6pm_registers.h"
-
-/*
- * Description :
- * Function responsible for initializing the ADC0 and ADC1 driver.
- * sets up the ADC0 and ADC1 sequencer.
- */
-void ADC_Init(void)
-{
-    /* Enable ADC0 and ADC1 clock */
-    SYSCTL_RCGCADC_REG |= 0x03;
-    while (!(SYSCTL_PRADC_REG & 0x03))
-        ;
-
-   /* Enable PORTE clock */
-   SYSCTL_RCGCGPIO_REG |= 0x10;
-   while (!(SYSCTL_PRGPIO_REG & 0x10))
-       ;
-
-   /* Enable alternative function on PE3 and PE2 (ADC input pins) */
-   GPIO_PORTE_AFSEL_REG |= 0x0C;
-
-   /* Disable digital enable on PE3 and PE2 */
-   GPIO_PORTE_DEN_REG &= ~0x0C;
-
-   /* Enable analog mode select on PE3 and PE2 */
-   GPIO_PORTE_AMSEL_REG |= 0x0C;
-
-   /* Configure PE3 and PE2 as input pins */
-   GPIO_PORTE_DIR_REG &= ~0x0C;
-
-    /********** Configure ADC0 **********/
-    /* Disable sample sequencer 0 */
-    ADC0_ACTSS_REG &= ~SAMPLE_SEQ_0_MASK;
-
-    /* Configure trigger event for sequencer 0 (0xF means always sample) */
-    ADC0_EMUX_REG |= TRIGGER_ALWAYS_MASK;
-
-    /* Configure input source for sequencer 0 (PE3/Ain0) */
-    ADC0_SSMUX0_REG = AIN0_CHANNEL;
-
-    /* Configure sample control bits for sequencer 0 */
-    ADC0_SSCTL0_REG |= SAMPLE_CONTROL_MASK;
-
-    /* Enable dither mode */
-    ADC0_CTL_REG |= DITHER_MODE_ENABLE;
-
-    /* Clear VDDA and GNDA reference bits for all ADC modules */
-    ADC0_CTL_REG &= ~VOLTAGE_REF_CLEAR_MASK;
-
-    /* Enable sample sequencer 0 */
-    ADC0_ACTSS_REG |= SAMPLE_SEQ_0_MASK;
-
-    /********** Configure ADC1 **********/
-    /* Disable sample sequencer 0 */
-    ADC1_ACTSS_REG &= ~SAMPLE_SEQ_0_MASK;
-
-    /* Configure trigger event for sequencer 0 (0xF means always sample) */
-    ADC1_EMUX_REG |= TRIGGER_ALWAYS_MASK;
-
-    /* Configure input source for sequencer 0 (PE2/Ain1) */
-    ADC1_SSMUX0_REG = AIN1_CHANNEL;
-
-    /* Configure sample control bits for sequencer 0 */
-    ADC1_SSCTL0_REG |= SAMPLE_CONTROL_MASK;
-
-    /* Enable dither mode */
-    ADC1_CTL_REG |= DITHER_MODE_ENABLE;
-
-    /* Clear VDDA and GNDA reference bits for all ADC modules */
-    ADC1_CTL_REG &= ~VOLTAGE_REF_CLEAR_MASK;
-
-    /* Enable sample sequencer 0 */
-    ADC1_ACTSS_REG |= SAMPLE_SEQ_0_MASK;
-}
-
-/*
- * Description :
- * Function responsible for reading analog data from a certain ADC0 channel
- * and converting it to digital using the ADC0 driver.
- * The function starts the conversion, waits for it to complete,
- * and returns the digital result.
- */
-uint16 ADC_ReadChannel(uint8 channel_num)
-{
-    uint16 ADC_Value;
-    if (channel_num == AIN0_CHANNEL)
-    {
-        /* Start SS0 conversion for ADC0 */
-        ADC0_PSSI_REG |= SAMPLE_SEQ_0_MASK;
-
-        /* Check if the raw interrupt status is set (Wait for conversion to complete) */
-        while (!(ADC0_RIS_REG & SAMPLE_SEQ_0_MASK))
-            ;
-
-        /* Read the 12-bit result from ADC0 */
-        ADC_Value = ADC0_SSFIFO0_REG & ADC_RESULT_MASK;
-
-        /* Clear the interrupt flag for ADC0 */
-        ADC0_ISC_REG |= SAMPLE_SEQ_0_MASK;
-    }
-    else if (channel_num == AIN1_CHANNEL)
-    {
-        /* Start SS0 conversion for ADC1 */
-        ADC1_PSSI_REG |= SAMPLE_SEQ_0_MASK;
-
-        /* Check if the raw interrupt status is set (Wait for conversion to complete) */
-        while (!(ADC1_RIS_REG & SAMPLE_SEQ_0_MASK))
-            ;
-
-        /* Read the 12-bit result from ADC1 */
-        ADC_Value = ADC1_SSFIFO0_REG & ADC_RESULT_MASK; // Mask to 12 bits
-
-        /* Clear the interrupt flag for ADC1 */
-        ADC1_ISC_REG |= SAMPLE_SEQ_0_MASK;
-    }
-    return ADC_Value;
-}
+/*
+ ============================================================================
+ Name        : adc.c
+ Module Name : ADC
+ Author      : asus
+ Date        : 28 Sept. 2024
+ Description : Source file for the TM4C123GH6PM Microcontroller ADC driver
+ ============================================================================
+ */
+
+#include "adc.h"
+#include "GPTM.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Kernel includes, for the sample rings. */
+#include "FreeRTOS.h"
+#include "spsc_ring.h"
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+/*
+ * One single-producer/single-consumer ring per channel for the timer triggered mode.
+ * The ISR is the only producer and the consumer task the only consumer, so no locking
+ * is needed. A sample is dropped if the consumer is late, the ring keeps the oldest
+ * unread ones.
+ */
+static SpscRing_t g_SampleRings[2];
+static uint16 g_Samples[2][ADC_SAMPLE_RING_SIZE];
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Function responsible for initializing the ADC0 and ADC1 driver.
+ * sets up the ADC0 and ADC1 sequencer.
+ */
+void ADC_Init(void)
+{
+    /* Enable ADC0 and ADC1 clock */
+    SYSCTL_RCGCADC_REG |= 0x03;
+    SYSCTL_DCGCADC_REG |= 0x03;     /* Keep sampling in deep sleep mode */
+    while (!(SYSCTL_PRADC_REG & 0x03))
+        ;
+
+   /* Enable PORTE clock */
+   SYSCTL_RCGCGPIO_REG |= 0x10;
+   while (!(SYSCTL_PRGPIO_REG & 0x10))
+       ;
+
+   /* Enable alternative function on PE3 and PE2 (ADC input pins) */
+   GPIO_PORTE_AFSEL_REG |= 0x0C;
+
+   /* Disable digital enable on PE3 and PE2 */
+   GPIO_PORTE_DEN_REG &= ~0x0C;
+
+   /* Enable analog mode select on PE3 and PE2 */
+   GPIO_PORTE_AMSEL_REG |= 0x0C;
+
+   /* Configure PE3 and PE2 as input pins */
+   GPIO_PORTE_DIR_REG &= ~0x0C;
+
+    /********** Configure ADC0 **********/
+    /* Disable sample sequencer 0 */
+    ADC0_ACTSS_REG &= ~SAMPLE_SEQ_0_MASK;
+
+    /* Configure trigger event for sequencer 0 (0xF means always sample) */
+    ADC0_EMUX_REG |= TRIGGER_ALWAYS_MASK;
+
+    /* Configure input source for sequencer 0 (PE3/Ain0) */
+    ADC0_SSMUX0_REG = AIN0_CHANNEL;
+
+    /* Configure sample control bits for sequencer 0 */
+    ADC0_SSCTL0_REG |= SAMPLE_CONTROL_MASK;
+
+    /* Enable dither mode */
+    ADC0_CTL_REG |= DITHER_MODE_ENABLE;
+
+    /* Clear VDDA and GNDA reference bits for all ADC modules */
+    ADC0_CTL_REG &= ~VOLTAGE_REF_CLEAR_MASK;
+
+    /* Enable sample sequencer 0 */
+    ADC0_ACTSS_REG |= SAMPLE_SEQ_0_MASK;
+
+    /********** Configure ADC1 **********/
+    /* Disable sample sequencer 0 */
+    ADC1_ACTSS_REG &= ~SAMPLE_SEQ_0_MASK;
+
+    /* Configure trigger event for sequencer 0 (0xF means always sample) */
+    ADC1_EMUX_REG |= TRIGGER_ALWAYS_MASK;
+
+    /* Configure input source for sequencer 0 (PE2/Ain1) */
+    ADC1_SSMUX0_REG = AIN1_CHANNEL;
+
+    /* Configure sample control bits for sequencer 0 */
+    ADC1_SSCTL0_REG |= SAMPLE_CONTROL_MASK;
+
+    /* Enable dither mode */
+    ADC1_CTL_REG |= DITHER_MODE_ENABLE;
+
+    /* Clear VDDA and GNDA reference bits for all ADC modules */
+    ADC1_CTL_REG &= ~VOLTAGE_REF_CLEAR_MASK;
+
+    /* Enable sample sequencer 0 */
+    ADC1_ACTSS_REG |= SAMPLE_SEQ_0_MASK;
+}
+
+/*
+ * Description :
+ * Function responsible for reading analog data from a certain ADC0 channel
+ * and converting it to digital using the ADC0 driver.
+ * The function starts the conversion, waits for it to complete,
+ * and returns the digital result.
+ */
+uint16 ADC_ReadChannel(uint8 channel_num)
+{
+    uint16 ADC_Value;
+    if (channel_num == AIN0_CHANNEL)
+    {
+        /* Start SS0 conversion for ADC0 */
+        ADC0_PSSI_REG |= SAMPLE_SEQ_0_MASK;
+
+        /* Check if the raw interrupt status is set (Wait for conversion to complete) */
+        while (!(ADC0_RIS_REG & SAMPLE_SEQ_0_MASK))
+            ;
+
+        /* Read the 12-bit result from ADC0 */
+        ADC_Value = ADC0_SSFIFO0_REG & ADC_RESULT_MASK;
+
+        /* Clear the interrupt flag for ADC0 */
+        ADC0_ISC_REG |= SAMPLE_SEQ_0_MASK;
+    }
+    else if (channel_num == AIN1_CHANNEL)
+    {
+        /* Start SS0 conversion for ADC1 */
+        ADC1_PSSI_REG |= SAMPLE_SEQ_0_MASK;
+
+        /* Check if the raw interrupt status is set (Wait for conversion to complete) */
+        while (!(ADC1_RIS_REG & SAMPLE_SEQ_0_MASK))
+            ;
+
+        /* Read the 12-bit result from ADC1 */
+        ADC_Value = ADC1_SSFIFO0_REG & ADC_RESULT_MASK; // Mask to 12 bits
+
+        /* Clear the interrupt flag for ADC1 */
+        ADC1_ISC_REG |= SAMPLE_SEQ_0_MASK;
+    }
+    return ADC_Value;
+}
+
+/*
+ * Description :
+ * Function responsible for initializing the ADC0 and ADC1 driver in timer triggered mode.
+ * Timer0 triggers both modules at the same instant every ADC_SAMPLING_PERIOD_MS and the
+ * sequence complete interrupts push the results into a ring buffer per channel.
+ */
+void ADC_TimerTriggeredInit(void)
+{
+    /* Pins and sequencers are set up as in the processor triggered mode */
+    ADC_Init();
+
+    /* The rings are empty before the first trigger */
+    vSpscRingInitialise(&g_SampleRings[AIN0_CHANNEL], g_Samples[AIN0_CHANNEL], sizeof(uint16), ADC_SAMPLE_RING_SIZE);
+    vSpscRingInitialise(&g_SampleRings[AIN1_CHANNEL], g_Samples[AIN1_CHANNEL], sizeof(uint16), ADC_SAMPLE_RING_SIZE);
+
+    /* Disable sample sequencer 0 of both modules while changing the trigger */
+    ADC0_ACTSS_REG &= ~SAMPLE_SEQ_0_MASK;
+    ADC1_ACTSS_REG &= ~SAMPLE_SEQ_0_MASK;
+
+    /* Configure trigger event for sequencer 0 (0x5 means GPTM ADC trigger) */
+    ADC0_EMUX_REG = (ADC0_EMUX_REG & ~TRIGGER_SS0_CLEAR_MASK) | TRIGGER_TIMER_MASK;
+    ADC1_EMUX_REG = (ADC1_EMUX_REG & ~TRIGGER_SS0_CLEAR_MASK) | TRIGGER_TIMER_MASK;
+
+    /* Clear any pending flag then unmask the sequencer 0 interrupt */
+    ADC0_ISC_REG = SAMPLE_SEQ_0_MASK;
+    ADC1_ISC_REG = SAMPLE_SEQ_0_MASK;
+    ADC0_IM_REG |= SAMPLE_SEQ_0_MASK;
+    ADC1_IM_REG |= SAMPLE_SEQ_0_MASK;
+
+    /* Set the interrupts priority and enable them in the NVIC (IRQ 14 in EN0 and IRQ 48 in EN1) */
+    NVIC_PRI3_REG = (NVIC_PRI3_REG & ADC0_PRIORITY_MASK) | (ADC0_INTERRUPT_PRIORITY<<ADC0_PRIORITY_BITS_POS);
+    NVIC_PRI12_REG = (NVIC_PRI12_REG & ADC1_PRIORITY_MASK) | (ADC1_INTERRUPT_PRIORITY<<ADC1_PRIORITY_BITS_POS);
+    NVIC_EN0_REG |= (1<<ADC0_IRQ_NUM);
+    NVIC_EN1_REG |= (1<<(ADC1_IRQ_NUM - 32));
+
+    /* Enable sample sequencer 0 of both modules */
+    ADC0_ACTSS_REG |= SAMPLE_SEQ_0_MASK;
+    ADC1_ACTSS_REG |= SAMPLE_SEQ_0_MASK;
+
+    /* Start the timer which triggers both modules simultaneously */
+    GPTM_Timer0ADCTriggerInit(ADC_SAMPLING_PERIOD_MS);
+}
+
+/*
+ * Description :
+ * Function responsible for taking the oldest ready sample of a channel in timer triggered mode.
+ * Returns TRUE and writes the sample if one is ready, FALSE otherwise. It never waits.
+ */
+boolean ADC_GetSample(uint8 channel_num, uint16 *pValue)
+{
+    return (xSpscRingPop(&g_SampleRings[channel_num], pValue) != pdFAIL) ? TRUE : FALSE;
+}
+
+/* ADC0 sequencer 0 complete ISR - PE3/Ain0 */
+void ADC0Seq0_Handler(void)
+{
+    uint16 uSample = ADC0_SSFIFO0_REG & ADC_RESULT_MASK;
+
+    /* No consumer task is notified, the ring is polled */
+    (void)xSpscRingPushFromISR(&g_SampleRings[AIN0_CHANNEL], &uSample, NULL_PTR);
+    ADC0_ISC_REG = SAMPLE_SEQ_0_MASK;     /* Clear the interrupt flag for ADC0 */
+}
+
+/* ADC1 sequencer 0 complete ISR - PE2/Ain1 */
+void ADC1Seq0_Handler(void)
+{
+    uint16 uSample = ADC1_SSFIFO0_REG & ADC_RESULT_MASK;
+
+    (void)xSpscRingPushFromISR(&g_SampleRings[AIN1_CHANNEL], &uSample, NULL_PTR);
+    ADC1_ISC_REG = SAMPLE_SEQ_0_MASK;     /* Clear the interrupt flag for ADC1 */
+}
@@ -0,0 +1,80 @@
+ /******************************************************************************
+ *
+ * Module: DWT
+ *
+ * File Name: dwt.c
+ *
+ * Description: Source file for the Cortex-M4 DWT cycle counter driver.
+ *
+ *******************************************************************************/
+
+#include "dwt.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Kernel includes, used to mask the kernel interrupts while the 64-bit count is updated. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+/* Upper 32 bits of the count and the counter value they belong to */
+static uint32 g_CycleCountHigh = 0;
+static uint32 g_LastCycleCount = 0;
+
+/* Cycles the counter missed while the core clock was stopped */
+static uint64 g_SkippedCycles = 0;
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void DWT_CycleCounterInit(void)
+{
+    /* The DWT is powered by the trace enable bit of the debug monitor control register */
+    CORE_DEBUG_DEMCR_REG |= DWT_DEMCR_TRCENA_MASK;
+    if (!(DWT_CTRL_REG & DWT_CTRL_CYCCNTENA_MASK))
+    {
+        DWT_CYCCNT_REG = 0;
+        g_CycleCountHigh = 0;
+        g_LastCycleCount = 0;
+        g_SkippedCycles = 0;
+        DWT_CTRL_REG |= DWT_CTRL_CYCCNTENA_MASK;
+    }
+}
+
+uint32 DWT_CycleCounterRead(void)
+{
+    return DWT_CYCCNT_REG;
+}
+
+uint64 DWT_CycleCounterRead64(void)
+{
+    UBaseType_t uxSavedInterruptStatus;
+    uint32 uCycleCount;
+    uint64 uValue;
+
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    uCycleCount = DWT_CYCCNT_REG;
+    if (uCycleCount < g_LastCycleCount)
+    {
+        g_CycleCountHigh++;
+    }
+    g_LastCycleCount = uCycleCount;
+    uValue = (((uint64)g_CycleCountHigh << 32) | uCycleCount) + g_SkippedCycles;
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+
+    return uValue;
+}
+
+uint32 DWT_CycleCounterSkip(uint32 uCycles)
+{
+    UBaseType_t uxSavedInterruptStatus;
+
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    g_SkippedCycles += uCycles;
+    taskEXIT_CRITICAL_FROM_ISR(uxSavedInterruptStatus);
+
+    return uCycles;
+}
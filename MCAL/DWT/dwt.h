@@ -0,0 +1,58 @@
+ /******************************************************************************
+ *
+ * Module: DWT
+ *
+ * File Name: dwt.h
+ *
+ * Description: Header file for the Cortex-M4 DWT cycle counter driver. The 32-bit
+ *              CYCCNT counts the CPU clock and wraps every 268s at 16MHz, the
+ *              driver extends it to 64-bit in software.
+ *
+ *******************************************************************************/
+
+#ifndef DWT_H_
+#define DWT_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define DWT_DEMCR_TRCENA_MASK       0x01000000
+#define DWT_CTRL_CYCCNTENA_MASK     0x00000001
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Enables the trace block and starts the cycle counter from 0.
+ * Does nothing if the counter already runs, so every user may call it.
+ */
+void DWT_CycleCounterInit(void);
+
+/*
+ * Description :
+ * Returns the raw 32-bit cycle counter, for intervals shorter than one wrap.
+ */
+uint32 DWT_CycleCounterRead(void);
+
+/*
+ * Description :
+ * Returns the 64-bit cycle count, the run time clock of the kernel statistics
+ * (FreeRTOSConfig.h). A wrap is detected by comparing with the previous read, so
+ * it must be called at least once per wrap: every context switch does. It masks
+ * the kernel interrupts for a few cycles and may be called from tasks and ISRs.
+ */
+uint64 DWT_CycleCounterRead64(void);
+
+/*
+ * Description :
+ * The counter stops with the core clock in deep sleep. Adds the cycles slept,
+ * measured by another timer, to the 64-bit count and returns them unchanged so
+ * it can wrap the measurement (configLOW_POWER_TIMER_STOP in FreeRTOSConfig.h).
+ */
+uint32 DWT_CycleCounterSkip(uint32 uCycles);
+
+#endif /* DWT_H_ */
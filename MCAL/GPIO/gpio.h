@@ -1,45 +1,59 @@
-/**********************************************************************************************
- *
- * Module: GPIO
- *
- * File Name: GPIO.h
- *
- * Description: Header file for the TM4C123GH6PM DIO driver for TivaC Built-in Buttons and LEDs
- *
- * Author: Edges for Training Team
- *
- ***********************************************************************************************/
-
-#ifndef GPIO_H_
-#define GPIO_H_
-
-#include "std_types.h"
-
-#define GPIO_PORTF_PRIORITY_MASK      0xFF1FFFFF
-#define GPIO_PORTF_PRIORITY_BITS_POS  21
-#define GPIO_PORTF_INTERRUPT_PRIORITY 5
-
-#define PRESSED                ((uint8)0x00)
-#define RELEASED               ((uint8)0x01)
-
-void GPIO_BuiltinButtonsLedsInit(void);
-
-void GPIO_RedLedOn(void);
-void GPIO_BlueLedOn(void);
-void GPIO_GreenLedOn(void);
-
-void GPIO_RedLedOff(void);
-void GPIO_BlueLedOff(void);
-void GPIO_GreenLedOff(void);
-
-void GPIO_RedLedToggle(void);
-void GPIO_BlueLedToggle(void);
-void GPIO_GreenLedToggle(void);
-
-uint8 GPIO_SW1GetState(void);
-uint8 GPIO_SW2GetState(void);
-
-void GPIO_SW1EdgeTriggeredInterruptInit(void);
-void GPIO_SW2EdgeTriggeredInterruptInit(void);
-
-#endif /* GPIO_H_ */
+/**********************************************************************************************
+ *
+ * Module: GPIO
+ *
+ * File Name: GPIO.h
+ *
+ * Description: Header file for the TM4C123GH6PM DIO driver for TivaC Built-in Buttons and LEDs
+ *
+ * Author: Edges for Training Team
+ *
+ ***********************************************************************************************/
+
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include "std_types.h"
+
+#define GPIO_PORTF_PRIORITY_MASK      0xFF1FFFFF
+#define GPIO_PORTF_PRIORITY_BITS_POS  21
+#define GPIO_PORTF_INTERRUPT_PRIORITY 5
+
+#define PRESSED                ((uint8)0x00)
+#define RELEASED               ((uint8)0x01)
+
+/* Interrupt bits of the buttons in the Port F interrupt registers */
+#define GPIO_SW1_PIN_MASK      ((uint32)(1<<4))
+#define GPIO_SW2_PIN_MASK      ((uint32)(1<<0))
+
+void GPIO_BuiltinButtonsLedsInit(void);
+
+void GPIO_RedLedOn(void);
+void GPIO_BlueLedOn(void);
+void GPIO_GreenLedOn(void);
+
+void GPIO_RedLedOff(void);
+void GPIO_BlueLedOff(void);
+void GPIO_GreenLedOff(void);
+
+void GPIO_RedLedToggle(void);
+void GPIO_BlueLedToggle(void);
+void GPIO_GreenLedToggle(void);
+
+uint8 GPIO_SW1GetState(void);
+uint8 GPIO_SW2GetState(void);
+
+/* The interrupt of each button is raised on both edges, press and release */
+void GPIO_SW1EdgeTriggeredInterruptInit(void);
+void GPIO_SW2EdgeTriggeredInterruptInit(void);
+
+/* Pending and enabled button interrupts, as GPIO_SWx_PIN_MASK bits */
+uint32 GPIO_SWInterruptStatus(void);
+
+/* Disable masks the interrupt of the given pins and clears it, Clear only clears it
+ * and Enable unmasks it: an edge latched while the pin was masked is raised then */
+void GPIO_SWInterruptDisable(uint32 uPins);
+void GPIO_SWInterruptClear(uint32 uPins);
+void GPIO_SWInterruptEnable(uint32 uPins);
+
+#endif /* GPIO_H_ */
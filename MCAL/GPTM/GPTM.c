@@ -1,30 +1,210 @@
- /******************************************************************************
- *
- * Module: GPTM
- *
- * File Name: GPTM.c
- *
- * Description: Source file for the TM4C123GH6PM GPTM driver for TivaC general purpose timer
- *
- * Author: Edges for Training Team
- *
- *******************************************************************************/
-#include "GPTM.h"
-#include "tm4c123gh6pm_registers.h"
-
-void GPTM_WTimer0Init(void)
-{
-    /* Configure one shot down 32bit timer with tick time = 0.1msec */
-    SYSCTL_RCGCWTIMER_REG |= (1<<0);  /* Enable clock WTimer0 in run mode */
-    WTIMER0_CTL_REG = 0;              /* Disable WTimer0 output */
-    WTIMER0_CFG_REG = 0x04;           /* Select 32-bit configuration option */
-    WTIMER0_TAMR_REG = 0x01;          /* Select one-shot down counter mode of WTimer0A */
-    WTIMER0_TAPR_REG = 1600 -1;       /* Set the prescaler for WTimer0A */
-    WTIMER0_CTL_REG |= (0x01);        /* Enable WTimer0A module */
-}
-
-uint32 GPTM_WTimer0Read(void)
-{
-    return (uint32) (0xFFFFFFFFUL - WTIMER0_TAR_REG);
-}
-
+ /******************************************************************************
+ *
+ * Module: GPTM
+ *
+ * File Name: GPTM.c
+ *
+ * Description: Source file for the TM4C123GH6PM GPTM driver for TivaC general purpose timer
+ *
+ * Author: Edges for Training Team
+ *
+ *******************************************************************************/
+#include "GPTM.h"
+#include "tm4c123gh6pm_registers.h"
+
+static volatile boolean g_SleepTimerExpired = FALSE;
+
+/* Upper 32 bits of the timestamp, incremented by the WTimer0A time out */
+static volatile uint32 g_TimestampHigh = 0;
+
+/* Compare of the timestamp, the callback is NULL_PTR when it is not armed */
+static volatile GPTM_CompareCallback_t g_CompareCallback = NULL_PTR;
+static uint64 g_CompareDeadlineUs = 0;
+
+/* Lower 32 bits of the timestamp. The count goes down from 0xFFFFFFFF to 0 and reloads,
+ * its negation wraps to 0 when the time out is raised */
+#define GPTM_TIMESTAMP_LOW()    ((uint32)(0UL - WTIMER0_TAR_REG))
+
+void GPTM_WTimer0Init(void)
+{
+    if (WTIMER0_CTL_REG & GPTM_CTL_TAEN_MASK)
+    {
+        return;
+    }
+
+    /* Configure periodic down 32bit timer with tick time = 1usec */
+    SYSCTL_RCGCWTIMER_REG |= (1<<0);  /* Enable clock WTimer0 in run mode */
+    SYSCTL_DCGCWTIMER_REG |= (1<<0);  /* Keep WTimer0 counting in deep sleep mode */
+    while(!(SYSCTL_PRWTIMER_REG & (1<<0)));               /* Wait until WTimer0 clock is ready for access */
+    WTIMER0_CTL_REG = 0;              /* Disable WTimer0 output */
+    WTIMER0_CFG_REG = 0x04;           /* Select 32-bit configuration option */
+    WTIMER0_TAMR_REG = 0x02 | GPTM_TAMR_TAMIE_MASK;       /* Periodic down counter mode of WTimer0A with the match enabled */
+    WTIMER0_TAPR_REG = (GPTM_CLOCK_TICKS_PER_MS / (1000 * GPTM_TIMESTAMP_TICKS_PER_US)) - 1; /* Set the prescaler for WTimer0A */
+    WTIMER0_TAILR_REG = 0xFFFFFFFF;
+    WTIMER0_TAPMR_REG = 0;
+    g_TimestampHigh = 0;
+    g_CompareCallback = NULL_PTR;
+    WTIMER0_ICR_REG = GPTM_ICR_TATOCINT_MASK | GPTM_ICR_TAMCINT_MASK;
+    WTIMER0_IMR_REG = GPTM_IMR_TATOIM_MASK;               /* The time out extends the timestamp */
+
+    /* Set the interrupt priority and enable it in the NVIC (IRQ 94 in EN2) */
+    NVIC_PRI23_REG = (NVIC_PRI23_REG & WTIMER0A_PRIORITY_MASK) | (WTIMER0A_INTERRUPT_PRIORITY<<WTIMER0A_PRIORITY_BITS_POS);
+    NVIC_EN2_REG |= (1<<30);
+
+    WTIMER0_CTL_REG |= GPTM_CTL_TAEN_MASK;                /* Enable WTimer0A module */
+}
+
+uint64 GPTM_WTimer0ReadUs(void)
+{
+    uint32 uHigh;
+    uint32 uLow;
+    uint32 uTimeOutPending;
+
+    /* Read again if the time out ISR ran in between */
+    do
+    {
+        uHigh = g_TimestampHigh;
+        uLow = GPTM_TIMESTAMP_LOW();
+        uTimeOutPending = WTIMER0_RIS_REG & GPTM_RIS_TATORIS_MASK;
+    } while (uHigh != g_TimestampHigh);
+
+    /* Wrapped while the ISR is held off by a critical section or by the caller's own
+     * priority, the low half is checked as the flag may be read after the count */
+    if (uTimeOutPending && (uLow < 0x80000000UL))
+    {
+        uHigh++;
+    }
+
+    return ((uint64)uHigh << 32) | uLow;
+}
+
+uint32 GPTM_WTimer0Read(void)
+{
+    return (uint32)(GPTM_WTimer0ReadUs() / 100);
+}
+
+boolean GPTM_WTimer0SetCompare(uint64 uDeadlineUs, GPTM_CompareCallback_t pfCallback)
+{
+    /* Disarm the previous compare before changing it */
+    WTIMER0_IMR_REG &= ~GPTM_IMR_TAMIM_MASK;
+    g_CompareDeadlineUs = uDeadlineUs;
+    g_CompareCallback = pfCallback;
+    WTIMER0_TAMATCHR_REG = 0UL - (uint32)uDeadlineUs;
+    WTIMER0_ICR_REG = GPTM_ICR_TAMCINT_MASK;
+    WTIMER0_IMR_REG |= GPTM_IMR_TAMIM_MASK;
+
+    /* The deadline may have passed before the match was armed, the callback is then
+     * called by the ISR only if it already took it */
+    if (GPTM_WTimer0ReadUs() >= uDeadlineUs)
+    {
+        WTIMER0_IMR_REG &= ~GPTM_IMR_TAMIM_MASK;
+        if (g_CompareCallback != NULL_PTR)
+        {
+            g_CompareCallback = NULL_PTR;
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+void GPTM_WTimer0CancelCompare(void)
+{
+    WTIMER0_IMR_REG &= ~GPTM_IMR_TAMIM_MASK;
+    g_CompareCallback = NULL_PTR;
+}
+
+void GPTM_Timer0ADCTriggerInit(uint32 uPeriodMs)
+{
+    /* Configure periodic down 32bit timer which triggers the ADC at every timeout */
+    SYSCTL_RCGCTIMER_REG |= (1<<0);                       /* Enable clock Timer0 in run mode */
+    SYSCTL_DCGCTIMER_REG |= (1<<0);                       /* Keep triggering the ADC in deep sleep mode */
+    while(!(SYSCTL_PRTIMER_REG & (1<<0)));                /* Wait until Timer0 clock is ready for access */
+    TIMER0_CTL_REG = 0;                                   /* Disable Timer0 output */
+    TIMER0_CFG_REG = 0x00;                                /* Select 32-bit configuration option */
+    TIMER0_TAMR_REG = 0x02;                               /* Select periodic down counter mode of Timer0A */
+    TIMER0_TAILR_REG = (uPeriodMs * GPTM_CLOCK_TICKS_PER_MS) - 1;
+    TIMER0_CTL_REG |= GPTM_CTL_TAOTE_MASK | GPTM_CTL_TAEN_MASK; /* Enable the ADC trigger output then Timer0A */
+}
+
+void GPTM_WTimer1SleepTimerInit(void)
+{
+    /* Configure one shot down 32bit timer clocked at 16MHz in run and deep sleep modes */
+    SYSCTL_RCGCWTIMER_REG |= (1<<1);                      /* Enable clock WTimer1 in run mode */
+    SYSCTL_DCGCWTIMER_REG |= (1<<1);                      /* Enable clock WTimer1 in deep sleep mode */
+    while(!(SYSCTL_PRWTIMER_REG & (1<<1)));               /* Wait until WTimer1 clock is ready for access */
+    SYSCTL_DSLPCLKCFG_REG = GPTM_DSLPCLKCFG_PIOSC;        /* Deep sleep clock is the PIOSC */
+    SYSCTL_DSLPPWRCFG_REG = GPTM_DSLPPWRCFG_LOW_POWER;
+    WTIMER1_CTL_REG = 0;                                  /* Disable WTimer1 output */
+    WTIMER1_CFG_REG = 0x04;                               /* Select 32-bit configuration option */
+    WTIMER1_TAMR_REG = 0x01;                              /* Select one-shot down counter mode of WTimer1A */
+    WTIMER1_TAPR_REG = 0;                                 /* No prescaler */
+    WTIMER1_ICR_REG = GPTM_ICR_TATOCINT_MASK;
+    WTIMER1_IMR_REG = GPTM_IMR_TATOIM_MASK;               /* The time out wakes the MCU */
+
+    /* Set the interrupt priority and enable it in the NVIC (IRQ 96 in EN3) */
+    NVIC_PRI24_REG = (NVIC_PRI24_REG & WTIMER1A_PRIORITY_MASK) | (WTIMER1A_INTERRUPT_PRIORITY<<WTIMER1A_PRIORITY_BITS_POS);
+    NVIC_EN3_REG |= (1<<0);
+}
+
+void GPTM_WTimer1SleepStart(uint32 uCounts)
+{
+    g_SleepTimerExpired = FALSE;
+    WTIMER1_ICR_REG = GPTM_ICR_TATOCINT_MASK;
+    WTIMER1_TAILR_REG = uCounts - 1;
+    WTIMER1_CTL_REG |= GPTM_CTL_TAEN_MASK;
+}
+
+uint32 GPTM_WTimer1SleepStop(void)
+{
+    uint32 uElapsed;
+
+    WTIMER1_CTL_REG &= ~GPTM_CTL_TAEN_MASK;
+    if(g_SleepTimerExpired || (WTIMER1_RIS_REG & GPTM_RIS_TATORIS_MASK))
+    {
+        /* The one shot stopped at its time out */
+        uElapsed = WTIMER1_TAILR_REG + 1;
+    }
+    else
+    {
+        uElapsed = WTIMER1_TAILR_REG - WTIMER1_TAR_REG;
+    }
+    WTIMER1_ICR_REG = GPTM_ICR_TATOCINT_MASK;
+    g_SleepTimerExpired = FALSE;
+    return uElapsed;
+}
+
+/* WTimer1A time out - ISR, only wakes the MCU, the tick is stepped by the port */
+void WTimer1A_Handler(void)
+{
+    WTIMER1_ICR_REG = GPTM_ICR_TATOCINT_MASK;
+    g_SleepTimerExpired = TRUE;
+}
+
+/* WTimer0A time out and match - ISR, extends the timestamp and runs the compare callback */
+void WTimer0A_Handler(void)
+{
+    uint32 uStatus = WTIMER0_MIS_REG;
+    GPTM_CompareCallback_t pfCallback;
+
+    if (uStatus & GPTM_MIS_TATOMIS_MASK)
+    {
+        g_TimestampHigh++;
+        WTIMER0_ICR_REG = GPTM_ICR_TATOCINT_MASK;
+    }
+
+    /* The low half matches once per wrap, the full deadline may still be ahead */
+    if (uStatus & GPTM_MIS_TAMMIS_MASK)
+    {
+        WTIMER0_ICR_REG = GPTM_ICR_TAMCINT_MASK;
+        if (GPTM_WTimer0ReadUs() >= g_CompareDeadlineUs)
+        {
+            WTIMER0_IMR_REG &= ~GPTM_IMR_TAMIM_MASK;
+            pfCallback = g_CompareCallback;
+            g_CompareCallback = NULL_PTR;
+            if (pfCallback != NULL_PTR)
+            {
+                pfCallback();
+            }
+        }
+    }
+}
@@ -1,22 +1,94 @@
- /******************************************************************************
- *
- * Module: GPTM
- *
- * File Name: GPTM.h
- *
- * Description: Header file for the TM4C123GH6PM GPTM driver for TivaC general purpose timer
- *
- * Author: Edges for Training Team
- *
- *******************************************************************************/
-
-#ifndef GPTM_H_
-#define GPTM_H_
-
-#include "std_types.h"
-
-void GPTM_WTimer0Init(void);
-uint32 GPTM_WTimer0Read(void);
-
-
-#endif /* GPTM_H_ */
+ /******************************************************************************
+ *
+ * Module: GPTM
+ *
+ * File Name: GPTM.h
+ *
+ * Description: Header file for the TM4C123GH6PM GPTM driver for TivaC general purpose timer
+ *
+ * Author: Edges for Training Team
+ *
+ *******************************************************************************/
+
+#ifndef GPTM_H_
+#define GPTM_H_
+
+#include "std_types.h"
+
+/* GPTM modules are clocked from the 16MHz system clock */
+#define GPTM_CLOCK_TICKS_PER_MS       16000
+
+#define GPTM_CTL_TAEN_MASK            0x00000001
+#define GPTM_CTL_TAOTE_MASK           0x00000020
+#define GPTM_TAMR_TAMIE_MASK          0x00000020
+#define GPTM_IMR_TATOIM_MASK          0x00000001
+#define GPTM_IMR_TAMIM_MASK           0x00000010
+#define GPTM_RIS_TATORIS_MASK         0x00000001
+#define GPTM_RIS_TAMRIS_MASK          0x00000010
+#define GPTM_MIS_TATOMIS_MASK         0x00000001
+#define GPTM_MIS_TAMMIS_MASK          0x00000010
+#define GPTM_ICR_TATOCINT_MASK        0x00000001
+#define GPTM_ICR_TAMCINT_MASK         0x00000010
+
+/* WTimer0A is the free running timestamp: periodic down counter prescaled to 1us,
+ * wrapping every 2^32us (~71 minutes), extended to 64-bit by its time out interrupt.
+ * The interrupt must not be preempted by a timestamp reader, so it has the highest
+ * priority allowed to use the kernel (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY)
+ * and ISRs above it must not read the timestamp. WTimer0A is IRQ 94, its priority is
+ * held in bits 21, 22 and 23 of PRI23. */
+#define GPTM_TIMESTAMP_TICKS_PER_US   1
+#define WTIMER0A_PRIORITY_MASK        0xFF1FFFFF
+#define WTIMER0A_PRIORITY_BITS_POS    21
+#define WTIMER0A_INTERRUPT_PRIORITY   5
+
+/* Deep sleep clock: PIOSC without divider, so the peripherals enabled in deep sleep
+ * keep the same 16MHz clock as in run mode */
+#define GPTM_DSLPCLKCFG_PIOSC         0x00000010
+#define GPTM_DSLPPWRCFG_LOW_POWER     0x00000021   /* Flash in low power mode, SRAM in standby */
+
+/* WTimer1A measures the tickless idle time, it runs in deep sleep */
+#define GPTM_SLEEP_TIMER_CLOCK_HZ     16000000
+#define WTIMER1A_PRIORITY_MASK        0xFFFFFF1F
+#define WTIMER1A_PRIORITY_BITS_POS    5
+#define WTIMER1A_INTERRUPT_PRIORITY   5
+
+/* Called from the WTimer0A ISR when the compare deadline is reached */
+typedef void (*GPTM_CompareCallback_t)(void);
+
+/*
+ * Description :
+ * Starts the WTimer0 timestamp, does nothing if it already runs.
+ * ReadUs returns the microseconds since the start, monotonic over the 64-bit range.
+ * It takes no lock and may be called from tasks, critical sections and ISRs up to
+ * WTIMER0A_INTERRUPT_PRIORITY. Read returns the same time in 0.1ms units, modulo 2^32.
+ */
+void GPTM_WTimer0Init(void);
+uint64 GPTM_WTimer0ReadUs(void);
+uint32 GPTM_WTimer0Read(void);
+
+/*
+ * Description :
+ * Calls pfCallback from the WTimer0A ISR once the timestamp reaches uDeadlineUs, with
+ * a 1us resolution independent of the kernel tick. There is a single compare, setting
+ * a new one replaces the previous one, so it must be owned by one user.
+ * Returns FALSE, without calling pfCallback, if the deadline has already passed.
+ */
+boolean GPTM_WTimer0SetCompare(uint64 uDeadlineUs, GPTM_CompareCallback_t pfCallback);
+void GPTM_WTimer0CancelCompare(void);
+void WTimer0A_Handler(void);
+
+void GPTM_Timer0ADCTriggerInit(uint32 uPeriodMs);
+
+/*
+ * Description :
+ * Low power timer of the tickless idle (FreeRTOSConfig.h configLOW_POWER_TIMER_*).
+ * Start arms a one shot of uCounts ticks of GPTM_SLEEP_TIMER_CLOCK_HZ whose interrupt
+ * wakes the MCU, Stop returns the ticks elapsed since the start (uCounts at most).
+ */
+void GPTM_WTimer1SleepTimerInit(void);
+void GPTM_WTimer1SleepStart(uint32 uCounts);
+uint32 GPTM_WTimer1SleepStop(void);
+void WTimer1A_Handler(void);
+
+
+#endif /* GPTM_H_ */
@@ -1,19 +1,19 @@
- /******************************************************************************
- *
- * Module: LEDS OF PF1, PF2 and PF3 (RED, Blue and Green LEDs)
- *
- * File Name: leds.h
- *
- * Description: Header file for the TM4C123GH6PM LEDS driver
- *
- * Author: Marawan Ragab
- *
- *******************************************************************************/
-#ifndef LEDS_H_
-#define LEDS_H_
-#include "std_types.h"
-/*******************************************************************************
- *                            Functions Prototypes                             *
- *******************************************************************************/
-void Leds_Init(void);
-#endif
+ /******************************************************************************
+ *
+ * Module: LEDS OF PF1, PF2 and PF3 (RED, Blue and Green LEDs)
+ *
+ * File Name: leds.h
+ *
+ * Description: Header file for the TM4C123GH6PM LEDS driver
+ *
+ * Author: Marawan Ragab
+ *
+ *******************************************************************************/
+#ifndef LEDS_H_
+#define LEDS_H_
+#include "std_types.h"
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+void Leds_Init(void);
+#endif
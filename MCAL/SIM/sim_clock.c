@@ -0,0 +1,385 @@
+ /******************************************************************************
+ *
+ * Module: SIM
+ *
+ * File Name: sim_clock.c
+ *
+ * Description: Source file for the virtual clock of the SIMULATION build. The
+ *              periods are read from the configuration the drivers wrote to the
+ *              register file: Timer0 TAILR for the ADC trigger and the WTimer0
+ *              prescaler for the timestamp, its time out and compare match, the
+ *              WTimer1 load of the tickless idle one shot, and the UART0 baud rate
+ *              divisors for the time a byte takes to be sent.
+ *
+ *******************************************************************************/
+
+#ifdef SIMULATION
+
+#include "sim_clock.h"
+#include "sim_hw.h"
+#include "tm4c123gh6pm_registers.h"
+#include "GPTM.h"
+#include "DWT/dwt.h"
+#include "MCAL/ADC/adc.h"
+
+/* Kernel includes, for the tick rate and the tick interrupt handler. */
+#include "FreeRTOS.h"
+
+/* The tick handler of the port, a host port can map it to its own handler */
+#ifndef SIM_CLOCK_TICK_HANDLER
+#define SIM_CLOCK_TICK_HANDLER      xPortSysTickHandler
+#endif
+extern void SIM_CLOCK_TICK_HANDLER(void);
+
+/* Kernel tick period */
+#define SIM_CLOCK_TICK_PERIOD_US    (1000000ULL / configTICK_RATE_HZ)
+
+/* GPTM clock ticks per microsecond */
+#define SIM_CLOCK_GPTM_TICKS_PER_US (GPTM_CLOCK_TICKS_PER_MS / 1000ULL)
+
+/* WTimer0 reloads from 0xFFFFFFFF, one time out every 2^32 counts */
+#define SIM_CLOCK_WTIMER0_WRAP      0x100000000ULL
+
+/* DWT cycles per microsecond */
+#define SIM_CLOCK_CYCLES_PER_US     (configCPU_CLOCK_HZ / 1000000ULL)
+
+/* UART0 frame of 1 start, 8 data and 1 stop bits */
+#define SIM_CLOCK_UART_FRAME_BITS   10ULL
+
+/* Limit of a step that only ends at the next event */
+#define SIM_CLOCK_FOREVER_US        0xFFFFFFFFFFFFFFFFULL
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+static uint64 g_NowUs = 0;
+static uint64 g_NextTickUs = SIM_CLOCK_TICK_PERIOD_US;
+static boolean g_TickRunning = TRUE;
+static uint64 g_SleepTimerStartUs = 0;
+static boolean g_SleepTimerRunning = FALSE;
+static boolean g_DeepSleep = FALSE;
+static uint64 g_SleptUs = 0;            /* Time spent in deep sleep, the DWT does not count it */
+static uint64 g_NextAdcUs = 0;          /* 0 while Timer0 is not triggering the ADC */
+static uint64 g_NextUartUs = 0;         /* 0 while the UART0 transmit FIFO is empty */
+static const SimEvent_t *g_Script = NULL_PTR;
+static uint32 g_ScriptLength = 0;
+static uint32 g_ScriptNext = 0;
+static uint16 g_Inputs[2] = {0, 0};
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Period of the Timer0 ADC trigger as configured by GPTM_Timer0ADCTriggerInit, 0 if stopped */
+static uint64 SimClock_AdcPeriodUs(void)
+{
+    if(!(TIMER0_CTL_REG & GPTM_CTL_TAEN_MASK))
+    {
+        return 0;
+    }
+    return ((uint64)TIMER0_TAILR_REG + 1ULL) / SIM_CLOCK_GPTM_TICKS_PER_US;
+}
+
+/* Time UART0 takes to send a byte, a bit lasts 16 * (IBRD + FBRD / 64) clocks */
+static uint64 SimClock_UartByteUs(void)
+{
+    uint64 uDivisor = ((uint64)UART0_IBRD_REG * 64ULL) + (uint64)UART0_FBRD_REG;
+    uint64 uByteUs = (SIM_CLOCK_UART_FRAME_BITS * uDivisor) / (4ULL * SIM_CLOCK_CYCLES_PER_US);
+
+    return (uByteUs != 0) ? uByteUs : 1ULL;
+}
+
+/* WTimer0 counts, one every TAPR + 1 GPTM clocks since virtual time 0 */
+static uint64 SimClock_WTimer0Counts(uint64 uTimeUs)
+{
+    return (uTimeUs * SIM_CLOCK_GPTM_TICKS_PER_US) / ((uint64)WTIMER0_TAPR_REG + 1ULL);
+}
+
+/* Virtual time of the next unmasked WTimer0 time out or compare match and its status
+ * bits, 0 if none is due */
+static uint64 SimClock_NextWTimer0Us(uint32 *pStatus)
+{
+    uint64 uPrescale = (uint64)WTIMER0_TAPR_REG + 1ULL;
+    uint64 uCounts = SimClock_WTimer0Counts(g_NowUs);
+    uint64 uNextCounts = 0;
+    uint64 uMatchCounts;
+
+    *pStatus = 0;
+    if(!(WTIMER0_CTL_REG & GPTM_CTL_TAEN_MASK))
+    {
+        return 0;
+    }
+    if(WTIMER0_IMR_REG & GPTM_IMR_TATOIM_MASK)
+    {
+        uNextCounts = (uCounts | (SIM_CLOCK_WTIMER0_WRAP - 1ULL)) + 1ULL;
+        *pStatus = GPTM_RIS_TATORIS_MASK;
+    }
+    if(WTIMER0_IMR_REG & GPTM_IMR_TAMIM_MASK)
+    {
+        /* The count matches when its low half is the negated match value */
+        uMatchCounts = (uCounts & ~(SIM_CLOCK_WTIMER0_WRAP - 1ULL)) | (uint32)(0UL - WTIMER0_TAMATCHR_REG);
+        if(uMatchCounts <= uCounts)
+        {
+            uMatchCounts += SIM_CLOCK_WTIMER0_WRAP;
+        }
+        if((uNextCounts == 0) || (uMatchCounts < uNextCounts))
+        {
+            uNextCounts = uMatchCounts;
+            *pStatus = GPTM_RIS_TAMRIS_MASK;
+        }
+        else if(uMatchCounts == uNextCounts)
+        {
+            *pStatus |= GPTM_RIS_TAMRIS_MASK;
+        }
+    }
+    if(uNextCounts == 0)
+    {
+        return 0;
+    }
+
+    /* First microsecond at which the count is reached */
+    return ((uNextCounts * uPrescale) + SIM_CLOCK_GPTM_TICKS_PER_US - 1ULL) / SIM_CLOCK_GPTM_TICKS_PER_US;
+}
+
+/* WTimer1 counts since its one shot was started, its counts start at the first step
+ * that finds it enabled (GPTM_WTimer1SleepStart is called right before the sleep) */
+static uint64 SimClock_SleepTimerCounts(void)
+{
+    return ((g_NowUs - g_SleepTimerStartUs) * SIM_CLOCK_GPTM_TICKS_PER_US) / ((uint64)WTIMER1_TAPR_REG + 1ULL);
+}
+
+/* Virtual time of the WTimer1 one shot time out, 0 if it is not running */
+static uint64 SimClock_NextSleepTimerUs(void)
+{
+    uint64 uCounts = ((uint64)WTIMER1_TAILR_REG + 1ULL) * ((uint64)WTIMER1_TAPR_REG + 1ULL);
+
+    if(!(WTIMER1_CTL_REG & GPTM_CTL_TAEN_MASK))
+    {
+        g_SleepTimerRunning = FALSE;
+        return 0;
+    }
+    if(!g_SleepTimerRunning)
+    {
+        g_SleepTimerRunning = TRUE;
+        g_SleepTimerStartUs = g_NowUs;
+    }
+
+    return g_SleepTimerStartUs + ((uCounts + SIM_CLOCK_GPTM_TICKS_PER_US - 1ULL) / SIM_CLOCK_GPTM_TICKS_PER_US);
+}
+
+/* WTimer0 counts down from 0xFFFFFFFF once enabled, as GPTM_WTimer0ReadUs expects,
+ * WTimer1 counts down from its load and sets its time out status once it reached 0,
+ * and the DWT counts the CPU cycles once enabled, except in deep sleep */
+static void SimClock_UpdateTimers(void)
+{
+    uint64 uCounts;
+
+    if(WTIMER0_CTL_REG & GPTM_CTL_TAEN_MASK)
+    {
+        WTIMER0_TAR_REG = (uint32)(0ULL - SimClock_WTimer0Counts(g_NowUs));
+    }
+    if(g_SleepTimerRunning)
+    {
+        uCounts = SimClock_SleepTimerCounts();
+        if(uCounts > (uint64)WTIMER1_TAILR_REG)
+        {
+            WTIMER1_TAR_REG = 0;
+            WTIMER1_RIS_REG |= GPTM_RIS_TATORIS_MASK;
+        }
+        else
+        {
+            WTIMER1_TAR_REG = WTIMER1_TAILR_REG - (uint32)uCounts;
+        }
+    }
+    if(DWT_CTRL_REG & DWT_CTRL_CYCCNTENA_MASK)
+    {
+        DWT_CYCCNT_REG = (uint32)((g_NowUs - g_SleptUs) * SIM_CLOCK_CYCLES_PER_US);
+    }
+}
+
+static void SimClock_RaiseScripted(const SimEvent_t *pEvent)
+{
+    if(pEvent->eType == SIM_EVENT_INPUT)
+    {
+        if(pEvent->uTarget < 2)
+        {
+            g_Inputs[pEvent->uTarget] = pEvent->uValue;
+        }
+    }
+    else if(pEvent->eType == SIM_EVENT_BUTTON)
+    {
+        SimHw_SetButton(pEvent->uTarget, (pEvent->uValue != 0) ? TRUE : FALSE);
+    }
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void SimClock_Init(const SimEvent_t *pScript, uint32 uScriptLength)
+{
+    g_NowUs = 0;
+    g_NextTickUs = SIM_CLOCK_TICK_PERIOD_US;
+    g_TickRunning = TRUE;
+    g_SleepTimerStartUs = 0;
+    g_SleepTimerRunning = FALSE;
+    g_DeepSleep = FALSE;
+    g_SleptUs = 0;
+    g_NextAdcUs = 0;
+    g_NextUartUs = 0;
+    g_Script = pScript;
+    g_ScriptLength = (pScript != NULL_PTR) ? uScriptLength : 0;
+    g_ScriptNext = 0;
+    g_Inputs[AIN0_CHANNEL] = 0;
+    g_Inputs[AIN1_CHANNEL] = 0;
+}
+
+uint64 SimClock_NowUs(void)
+{
+    return g_NowUs;
+}
+
+SimEventType_t SimClock_Step(uint64 uLimitUs)
+{
+    uint64 uAdcPeriodUs = SimClock_AdcPeriodUs();
+    uint32 uTimerStatus = 0;
+    uint64 uNextTimerUs = SimClock_NextWTimer0Us(&uTimerStatus);
+    uint64 uNextSleepTimerUs = SimClock_NextSleepTimerUs();
+    uint64 uNextUs = uLimitUs;
+    SimEventType_t eNext = SIM_EVENT_NONE;
+    const SimEvent_t *pScripted = NULL_PTR;
+
+    /* The first conversion comes one period after the trigger timer was started */
+    if(uAdcPeriodUs == 0)
+    {
+        g_NextAdcUs = 0;
+    }
+    else if(g_NextAdcUs == 0)
+    {
+        g_NextAdcUs = g_NowUs + uAdcPeriodUs;
+    }
+
+    /* A byte written to the empty FIFO is sent one frame later */
+    if(!SimHw_UartBusy())
+    {
+        g_NextUartUs = 0;
+    }
+    else if(g_NextUartUs == 0)
+    {
+        g_NextUartUs = g_NowUs + SimClock_UartByteUs();
+    }
+
+    /* Checked in reverse priority order so the later check wins on equal times */
+    if(g_TickRunning && (g_NextTickUs <= uNextUs))
+    {
+        uNextUs = g_NextTickUs;
+        eNext = SIM_EVENT_TICK;
+    }
+    if((g_NextUartUs != 0) && (g_NextUartUs <= uNextUs))
+    {
+        uNextUs = g_NextUartUs;
+        eNext = SIM_EVENT_UART;
+    }
+    if((uNextSleepTimerUs != 0) && (uNextSleepTimerUs <= uNextUs))
+    {
+        uNextUs = uNextSleepTimerUs;
+        eNext = SIM_EVENT_SLEEP_TIMER;
+    }
+    if((uNextTimerUs != 0) && (uNextTimerUs <= uNextUs))
+    {
+        uNextUs = uNextTimerUs;
+        eNext = SIM_EVENT_TIMER;
+    }
+    if((g_NextAdcUs != 0) && (g_NextAdcUs <= uNextUs))
+    {
+        uNextUs = g_NextAdcUs;
+        eNext = SIM_EVENT_ADC;
+    }
+    if((g_ScriptNext < g_ScriptLength) && (g_Script[g_ScriptNext].uTimeUs <= uNextUs))
+    {
+        pScripted = &g_Script[g_ScriptNext];
+        eNext = pScripted->eType;
+
+        /* An event scripted in the past is raised now */
+        uNextUs = (pScripted->uTimeUs > g_NowUs) ? pScripted->uTimeUs : g_NowUs;
+    }
+
+    if(g_DeepSleep)
+    {
+        g_SleptUs += uNextUs - g_NowUs;
+    }
+    g_NowUs = uNextUs;
+    SimClock_UpdateTimers();
+
+    if(pScripted != NULL_PTR)
+    {
+        g_ScriptNext++;
+        SimClock_RaiseScripted(pScripted);
+    }
+    else if(eNext == SIM_EVENT_TICK)
+    {
+        g_NextTickUs += SIM_CLOCK_TICK_PERIOD_US;
+        SIM_CLOCK_TICK_HANDLER();
+    }
+    else if(eNext == SIM_EVENT_TIMER)
+    {
+        SimHw_WTimer0Interrupt(uTimerStatus);
+    }
+    else if(eNext == SIM_EVENT_SLEEP_TIMER)
+    {
+        g_SleepTimerRunning = FALSE;
+        SimHw_WTimer1TimeOut();
+    }
+    else if(eNext == SIM_EVENT_ADC)
+    {
+        g_NextAdcUs += uAdcPeriodUs;
+        SimHw_AdcSample(AIN0_CHANNEL, g_Inputs[AIN0_CHANNEL]);
+        SimHw_AdcSample(AIN1_CHANNEL, g_Inputs[AIN1_CHANNEL]);
+    }
+    else if(eNext == SIM_EVENT_UART)
+    {
+        /* The handler may refill the FIFO, its next byte is timed from now */
+        g_NextUartUs = 0;
+        (void)SimHw_UartTransmit();
+    }
+
+    return eNext;
+}
+
+uint32 SimClock_TickStop(void)
+{
+    g_TickRunning = FALSE;
+    return (uint32)((g_NextTickUs - g_NowUs) * SIM_CLOCK_CYCLES_PER_US);
+}
+
+void SimClock_TickStart(uint32 uCycles)
+{
+    g_TickRunning = TRUE;
+    g_NextTickUs = g_NowUs + (((uint64)uCycles + SIM_CLOCK_CYCLES_PER_US - 1ULL) / SIM_CLOCK_CYCLES_PER_US);
+}
+
+void SimClock_Sleep(void)
+{
+    SimEventType_t eEvent;
+
+    /* An analog input change is no interrupt, the core sleeps on */
+    g_DeepSleep = TRUE;
+    do
+    {
+        eEvent = SimClock_Step(SIM_CLOCK_FOREVER_US);
+    } while(eEvent == SIM_EVENT_INPUT);
+    g_DeepSleep = FALSE;
+}
+
+void SimClock_Run(uint64 uDurationUs)
+{
+    uint64 uEndUs = g_NowUs + uDurationUs;
+
+    /* Stops once the end is reached and nothing else is due at the end */
+    while((SimClock_Step(uEndUs) != SIM_EVENT_NONE) || (g_NowUs < uEndUs))
+    {
+    }
+}
+
+#endif /* SIMULATION */
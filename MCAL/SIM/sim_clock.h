@@ -0,0 +1,96 @@
+ /******************************************************************************
+ *
+ * Module: SIM
+ *
+ * File Name: sim_clock.h
+ *
+ * Description: Header file for the virtual clock of the SIMULATION build. Time only
+ *              moves when SimClock_Step() or SimClock_Run() is called, and every
+ *              interrupt (kernel tick, ADC conversion complete, WTimer0 timestamp,
+ *              WTimer1 sleep time out, UART0 transmit, button edge) is raised at an exact virtual time, so a run
+ *              is reproduced exactly and runs as fast as the host can execute the handlers.
+ *              The DWT cycle counter follows the virtual time at configCPU_CLOCK_HZ.
+ *
+ *******************************************************************************/
+
+#ifndef SIM_CLOCK_H_
+#define SIM_CLOCK_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+
+typedef enum
+{
+    SIM_EVENT_NONE,
+    SIM_EVENT_TICK,             /* Kernel tick interrupt */
+    SIM_EVENT_TIMER,            /* WTimer0 timestamp time out or compare match interrupt */
+    SIM_EVENT_SLEEP_TIMER,      /* WTimer1 one shot time out of the tickless idle */
+    SIM_EVENT_ADC,              /* Timer0 triggered conversion of both LM35 channels */
+    SIM_EVENT_UART,             /* UART0 shifted out the byte of its transmit FIFO */
+    SIM_EVENT_INPUT,            /* Scripted change of the analog input of a channel */
+    SIM_EVENT_BUTTON            /* Scripted press or release of a Port F button */
+} SimEventType_t;
+
+/* One entry of the scripted schedule */
+typedef struct
+{
+    uint64 uTimeUs;             /* Virtual time of the event, the script is sorted on it */
+    SimEventType_t eType;       /* SIM_EVENT_INPUT or SIM_EVENT_BUTTON */
+    uint8 uTarget;              /* ADC channel (AIN0_CHANNEL/AIN1_CHANNEL) or button pin */
+    uint16 uValue;              /* Raw 12 bit input level of SIM_EVENT_INPUT, 1 press / 0 release of SIM_EVENT_BUTTON */
+} SimEvent_t;
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Reset the virtual time to 0 and the analog inputs to 0, and use the given
+ * schedule (sorted by time, may be NULL) for the scripted events.
+ */
+void SimClock_Init(const SimEvent_t *pScript, uint32 uScriptLength);
+
+/*
+ * Description :
+ * Virtual time in microseconds.
+ */
+uint64 SimClock_NowUs(void);
+
+/*
+ * Description :
+ * Advance the virtual time to the next event, at most uLimitUs, and raise it.
+ * On equal times the scripted event comes first, then the ADC conversion, then the
+ * WTimer0 interrupt, then the WTimer1 time out, then the UART0 byte, then the tick. Returns the type of the event raised, SIM_EVENT_NONE if the limit came first.
+ * Scripted entries of another type than SIM_EVENT_INPUT/SIM_EVENT_BUTTON are skipped.
+ */
+SimEventType_t SimClock_Step(uint64 uLimitUs);
+
+/*
+ * Description :
+ * Kernel tick timer of the tickless idle of the host port, counted in CPU clock
+ * cycles as the SysTick does. Stop returns the cycles left until the next tick, 0 if
+ * it is due now and was not raised yet. Start raises the next tick uCycles from now,
+ * then one every tick period again.
+ */
+uint32 SimClock_TickStop(void);
+void SimClock_TickStart(uint32 uCycles);
+
+/*
+ * Description :
+ * Deep sleep until the next interrupt: advance the virtual time to the next event
+ * other than an analog input change and raise it. The DWT cycle counter does not
+ * count the time asleep, WTimer0, WTimer1, Timer0 and UART0 go on.
+ */
+void SimClock_Sleep(void);
+
+/*
+ * Description :
+ * Raise every event up to uDurationUs of virtual time from now.
+ */
+void SimClock_Run(uint64 uDurationUs);
+
+#endif /* SIM_CLOCK_H_ */
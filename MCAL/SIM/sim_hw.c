@@ -0,0 +1,228 @@
+ /******************************************************************************
+ *
+ * Module: SIM
+ *
+ * File Name: sim_hw.c
+ *
+ * Description: Source file for the simulated TM4C123GH6PM hardware. Compiled only
+ *              when SIMULATION is defined, the target build does not contain it.
+ *
+ *******************************************************************************/
+
+#ifdef SIMULATION
+
+#include <stdio.h>
+
+#include "sim_hw.h"
+#include "tm4c123gh6pm_registers.h"
+#include "MCAL/ADC/adc.h"
+#include "GPTM.h"
+#include "uart0.h"
+
+/* Address of UART0_DR_REG, the access to it is what fills the transmit FIFO */
+#define SIM_HW_UART0_DR_ADDRESS   0x4000C000UL
+
+/* Address of WTIMER1_ICR_REG, the access to it acknowledges the time out */
+#define SIM_HW_WTIMER1_ICR_ADDRESS 0x40037024UL
+
+/* Port F interrupt service routine (APP/DEBOUNCE) */
+extern void GPIOPortF_Handler(void);
+
+/*******************************************************************************
+ *                              Private Variables                              *
+ *******************************************************************************/
+
+/* Open addressed table, an address of 0 marks a free slot */
+static uint32 g_Addresses[SIM_HW_MAX_REGISTERS];
+static volatile uint32 g_Values[SIM_HW_MAX_REGISTERS];
+static volatile uint32 g_Scratch;
+static boolean g_Overflowed = FALSE;
+static boolean g_UartBusy = FALSE;
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+
+/* Storage of the register at the given address, allocated on first access */
+static volatile uint32 *SimHw_Lookup(uint32 uAddress)
+{
+    uint32 uIndex = (uAddress >> 2) & (SIM_HW_MAX_REGISTERS - 1U);
+    uint32 uProbe;
+
+    for(uProbe = 0; uProbe < SIM_HW_MAX_REGISTERS; uProbe++)
+    {
+        if(g_Addresses[uIndex] == uAddress)
+        {
+            return &g_Values[uIndex];
+        }
+        if(g_Addresses[uIndex] == 0)
+        {
+            g_Addresses[uIndex] = uAddress;
+            return &g_Values[uIndex];
+        }
+        uIndex = (uIndex + 1U) & (SIM_HW_MAX_REGISTERS - 1U);
+    }
+
+    g_Overflowed = TRUE;
+    return &g_Scratch;
+}
+
+/*******************************************************************************
+ *                         Public Functions Definitions                        *
+ *******************************************************************************/
+
+void SimHw_Init(void)
+{
+    uint32 uIndex;
+
+    for(uIndex = 0; uIndex < SIM_HW_MAX_REGISTERS; uIndex++)
+    {
+        g_Addresses[uIndex] = 0;
+        g_Values[uIndex] = 0;
+    }
+    g_Overflowed = FALSE;
+    g_UartBusy = FALSE;
+
+    /* Every peripheral clock is ready as soon as it is enabled */
+    SYSCTL_PRGPIO_REG = 0xFFFFFFFF;
+    SYSCTL_PRTIMER_REG = 0xFFFFFFFF;
+    SYSCTL_PRWTIMER_REG = 0xFFFFFFFF;
+    SYSCTL_PRUART_REG = 0xFFFFFFFF;
+    SYSCTL_PRADC_REG = 0xFFFFFFFF;
+
+    /* Polled ADC reads find a completed conversion */
+    ADC0_RIS_REG = SAMPLE_SEQ_0_MASK;
+    ADC1_RIS_REG = SAMPLE_SEQ_0_MASK;
+
+    /* Buttons are released (pulled up) */
+    GPIO_PORTF_DATA_REG = (1U << SIM_HW_SW1_PIN) | (1U << SIM_HW_SW2_PIN);
+
+    /* The UART0 FIFOs are empty */
+    UART0_FR_REG = UART_FR_TXFE_MASK | UART_FR_RXFE_MASK;
+}
+
+volatile uint32 *SimHw_Register(uint32 uAddress)
+{
+    /* The driver only writes the data register, nothing is received, so any
+     * access to it is a byte put in the transmit FIFO */
+    if(uAddress == SIM_HW_UART0_DR_ADDRESS)
+    {
+        g_UartBusy = TRUE;
+        UART0_FR_REG = (UART0_FR_REG & ~UART_FR_TXFE_MASK) | UART_FR_TXFF_MASK;
+    }
+
+    /* The sleep timer driver only writes the time out bit to the interrupt clear
+     * register, so any access to it clears the raw status */
+    if(uAddress == SIM_HW_WTIMER1_ICR_ADDRESS)
+    {
+        WTIMER1_RIS_REG &= ~GPTM_RIS_TATORIS_MASK;
+    }
+
+    return SimHw_Lookup(uAddress);
+}
+
+boolean SimHw_Overflowed(void)
+{
+    return g_Overflowed;
+}
+
+void SimHw_AdcSample(uint8 uChannel, uint16 uSample)
+{
+    if(uChannel == AIN0_CHANNEL)
+    {
+        ADC0_SSFIFO0_REG = uSample & ADC_RESULT_MASK;
+        ADC0_RIS_REG |= SAMPLE_SEQ_0_MASK;
+        ADC0Seq0_Handler();
+    }
+    else if(uChannel == AIN1_CHANNEL)
+    {
+        ADC1_SSFIFO0_REG = uSample & ADC_RESULT_MASK;
+        ADC1_RIS_REG |= SAMPLE_SEQ_0_MASK;
+        ADC1Seq0_Handler();
+    }
+}
+
+void SimHw_SetButton(uint8 uPin, boolean bPressed)
+{
+    if(bPressed)
+    {
+        GPIO_PORTF_DATA_REG &= ~(1U << uPin);
+    }
+    else
+    {
+        GPIO_PORTF_DATA_REG |= (1U << uPin);
+    }
+
+    /* Every change is an edge, it interrupts only while the pin is unmasked */
+    GPIO_PORTF_RIS_REG = (1U << uPin);
+    GPIO_PORTF_MIS_REG = GPIO_PORTF_RIS_REG & GPIO_PORTF_IM_REG;
+    if(GPIO_PORTF_MIS_REG != 0)
+    {
+        GPIOPortF_Handler();
+    }
+
+    /* The handler acknowledges through ICR, a write one to clear register the
+     * register file does not model, so the status is cleared here */
+    GPIO_PORTF_RIS_REG = 0;
+    GPIO_PORTF_MIS_REG = 0;
+}
+
+void SimHw_WTimer0Interrupt(uint32 uStatus)
+{
+    /* The interrupt is taken at once, so no timestamp reader can find it pending
+     * in RIS, and the ICR acknowledge is not modelled: only MIS is set */
+    WTIMER0_MIS_REG = uStatus & WTIMER0_IMR_REG;
+    if(WTIMER0_MIS_REG != 0)
+    {
+        WTimer0A_Handler();
+    }
+    WTIMER0_MIS_REG = 0;
+}
+
+void SimHw_WTimer1TimeOut(void)
+{
+    /* The one shot stops at its time out. Unlike WTimer0 the ICR acknowledge is
+     * modelled, TATORIS stays set until the driver writes ICR */
+    WTIMER1_CTL_REG &= ~GPTM_CTL_TAEN_MASK;
+    WTIMER1_TAR_REG = 0;
+    WTIMER1_RIS_REG |= GPTM_RIS_TATORIS_MASK;
+    WTIMER1_MIS_REG = WTIMER1_RIS_REG & WTIMER1_IMR_REG;
+    if(WTIMER1_MIS_REG != 0)
+    {
+        WTimer1A_Handler();
+    }
+    WTIMER1_MIS_REG = 0;
+}
+
+boolean SimHw_UartBusy(void)
+{
+    return g_UartBusy;
+}
+
+boolean SimHw_UartTransmit(void)
+{
+    if(!g_UartBusy)
+    {
+        return FALSE;
+    }
+
+    /* Read through the lookup, an access through UART0_DR_REG would fill the FIFO again */
+    (void)putchar((int)(*SimHw_Lookup(SIM_HW_UART0_DR_ADDRESS) & 0xFFU));
+    g_UartBusy = FALSE;
+    UART0_FR_REG = (UART0_FR_REG & ~UART_FR_TXFF_MASK) | UART_FR_TXFE_MASK;
+
+    /* The FIFO drained: TXRIS is set, at the position of TXIM in IM. As for the
+     * buttons the ICR acknowledge is not modelled */
+    UART0_RIS_REG = UART_IM_TXIM_MASK;
+    UART0_MIS_REG = UART0_RIS_REG & UART0_IM_REG;
+    if(UART0_MIS_REG != 0)
+    {
+        UART0_Handler();
+    }
+    UART0_RIS_REG = 0;
+    UART0_MIS_REG = 0;
+
+    return TRUE;
+}
+
+#endif /* SIMULATION */
@@ -0,0 +1,92 @@
+ /******************************************************************************
+ *
+ * Module: SIM
+ *
+ * File Name: sim_hw.h
+ *
+ * Description: Header file for the simulated TM4C123GH6PM hardware used by the
+ *              SIMULATION build. The registers of tm4c123gh6pm_registers.h are
+ *              backed by a register file in RAM, and the inputs of the seat heater
+ *              (LM35 samples and the two buttons) are injected through this API.
+ *
+ *******************************************************************************/
+
+#ifndef SIM_HW_H_
+#define SIM_HW_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+
+/* Number of distinct registers the register file can hold, must be a power of 2 */
+#define SIM_HW_MAX_REGISTERS      256U
+
+/* Buttons of Port F, active low */
+#define SIM_HW_SW1_PIN            4U      /* PF4 */
+#define SIM_HW_SW2_PIN            0U      /* PF0 */
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+/*
+ * Description :
+ * Reset every register to 0, then report all peripherals ready and a completed
+ * ADC sample so the driver init functions and polled reads do not spin.
+ * Must be called before any driver init.
+ */
+void SimHw_Init(void);
+
+/*
+ * Description :
+ * Storage of the register at the given address, used by HW_REG. Registers are
+ * allocated on first access, once the file is full the extra registers share a
+ * single scratch word and SimHw_Overflowed() returns TRUE.
+ */
+volatile uint32 *SimHw_Register(uint32 uAddress);
+boolean SimHw_Overflowed(void);
+
+/*
+ * Description :
+ * Convert a 12 bit sample on channel AIN0 (driver seat) or AIN1 (passenger seat)
+ * and run the sequencer 0 interrupt of that ADC, as the timer trigger would.
+ */
+void SimHw_AdcSample(uint8 uChannel, uint16 uSample);
+
+/*
+ * Description :
+ * Press (the pin reads low) or release one of the Port F buttons. The edge runs
+ * GPIOPortF_Handler if the pin is unmasked in IM. A bouncing contact is scripted
+ * as several changes.
+ */
+void SimHw_SetButton(uint8 uPin, boolean bPressed);
+
+/*
+ * Description :
+ * Raise the WTimer0A interrupt for the given status bits (time out, match).
+ * WTimer0A_Handler runs if one of them is unmasked in IMR.
+ */
+void SimHw_WTimer0Interrupt(uint32 uStatus);
+
+/*
+ * Description :
+ * Time out of the WTimer1 one shot of the tickless idle: the timer stops, TATORIS
+ * is set until the driver writes ICR, and WTimer1A_Handler runs if it is unmasked
+ * in IMR.
+ */
+void SimHw_WTimer1TimeOut(void);
+
+/*
+ * Description :
+ * The transmit FIFO of UART0 is modelled one byte deep: a write to the data
+ * register fills it (TXFF) until SimHw_UartTransmit() shifts the byte out to the
+ * host standard output, then the transmit interrupt runs UART0_Handler if it is
+ * unmasked in IM. SimHw_UartBusy() returns TRUE while a byte waits to be sent,
+ * SimHw_UartTransmit() FALSE if there was none. Nothing is ever received.
+ */
+boolean SimHw_UartBusy(void);
+boolean SimHw_UartTransmit(void);
+
+#endif /* SIM_HW_H_ */
@@ -1,26 +1,57 @@
-/*
- ============================================================================
- Name        : lm35.h
- Module Name : LM35
- Author      : asus
- Date        : 28 Sept. 2024
- Description : Header file for the LM35 driver
- ============================================================================
- */
-
-#include "lm35.h"
-#include "../ADC/adc.h"
-
-/*
- * Description :
- * Function responsible for calculate the temperature from the ADC digital value.
- */
-uint8 LM35_getTemperature(uint8 channel_num)
-{
-    uint16 adc_value = ADC_ReadChannel(channel_num);
-
-    /* Calculate temperature from 0V-3.3V mapped to 0C-45C */
-    uint8 temperature = (uint8) (((uint32) adc_value * SENSOR_MAX_TEMPERATURE * ADC_REFERENCE_VOLTAGE) / (ADC_MAXIMUM_VALUE * SENSOR_MAX_VOLT_VALUE));
-
-    return temperature;
-}
+/*
+ ============================================================================
+ Name        : lm35.h
+ Module Name : LM35
+ Author      : asus
+ Date        : 28 Sept. 2024
+ Description : Header file for the LM35 driver
+ ============================================================================
+ */
+
+#include "lm35.h"
+#include "../ADC/adc.h"
+
+/* Temperature of an ADC digital value, shared by the polled and the timer triggered reads */
+static uint8 LM35_convertToTemperature(uint16 adc_value)
+{
+    /* Calculate temperature from 0V-3.3V mapped to 0C-45C */
+    return (uint8) (((uint32) adc_value * SENSOR_MAX_TEMPERATURE * ADC_REFERENCE_VOLTAGE) / (ADC_MAXIMUM_VALUE * SENSOR_MAX_VOLT_VALUE));
+}
+
+/*
+ * Description :
+ * Function responsible for calculate the temperature from the ADC digital value.
+ */
+uint8 LM35_getTemperature(uint8 channel_num)
+{
+    uint16 adc_value = ADC_ReadChannel(channel_num);
+
+    return LM35_convertToTemperature(adc_value);
+}
+
+/*
+ * Description :
+ * Function responsible for calculate the temperature from the samples the ADC collected
+ * in timer triggered mode since the last call. The ready samples are averaged.
+ * Returns FALSE and leaves the temperature untouched if no sample is ready.
+ */
+boolean LM35_getLatestTemperature(uint8 channel_num, uint8 *pTemperature)
+{
+    uint16 adc_value;
+    uint32 sum = 0;
+    uint32 count = 0;
+
+    while (ADC_GetSample(channel_num, &adc_value))
+    {
+        sum += adc_value;
+        count++;
+    }
+
+    if (count == 0)
+    {
+        return FALSE;
+    }
+
+    *pTemperature = LM35_convertToTemperature((uint16) (sum / count));
+    return TRUE;
+}
@@ -1,46 +1,63 @@
- /******************************************************************************
- *
- * Module: UART0
- *
- * File Name: uart0.h
- *
- * Description: Header file for the TM4C123GH6PM UART0 driver
- *
- * Author: Edges for Training Team
- *
- *******************************************************************************/
-
-#ifndef UART0_H_
-#define UART0_H_
-
-#include "std_types.h"
-
-/*******************************************************************************
- *                             Preprocessor Macros                             *
- *******************************************************************************/
-#define UART_DATA_5BITS          0x0
-#define UART_DATA_6BITS          0x1
-#define UART_DATA_7BITS          0x2
-#define UART_DATA_8BITS          0x3
-#define UART_LCRH_WLEN_BITS_POS  5
-#define UART_CTL_UARTEN_MASK     0x00000001
-#define UART_CTL_TXE_MASK        0x00000100
-#define UART_CTL_RXE_MASK        0x00000200
-#define UART_FR_TXFE_MASK        0x00000080
-#define UART_FR_RXFE_MASK        0x00000010
-
-/*******************************************************************************
- *                            Functions Prototypes                             *
- *******************************************************************************/
-
-extern void UART0_Init(void);
-
-extern void UART0_SendByte(uint8 data);
-
-extern uint8 UART0_ReceiveByte(void);
-
-extern void UART0_SendString(const uint8 *pData);
-
-extern void UART0_SendInteger(sint64 sNumber);
-
-#endif
+ /******************************************************************************
+ *
+ * Module: UART0
+ *
+ * File Name: uart0.h
+ *
+ * Description: Header file for the TM4C123GH6PM UART0 driver
+ *
+ * Author: Edges for Training Team
+ *
+ *******************************************************************************/
+
+#ifndef UART0_H_
+#define UART0_H_
+
+#include "std_types.h"
+
+/*******************************************************************************
+ *                             Preprocessor Macros                             *
+ *******************************************************************************/
+#define UART_DATA_5BITS          0x0
+#define UART_DATA_6BITS          0x1
+#define UART_DATA_7BITS          0x2
+#define UART_DATA_8BITS          0x3
+#define UART_LCRH_WLEN_BITS_POS  5
+#define UART_CTL_UARTEN_MASK     0x00000001
+#define UART_CTL_TXE_MASK        0x00000100
+#define UART_CTL_RXE_MASK        0x00000200
+#define UART_LCRH_FEN_MASK       0x00000010
+#define UART_FR_TXFE_MASK        0x00000080
+#define UART_FR_TXFF_MASK        0x00000020
+#define UART_FR_RXFE_MASK        0x00000010
+#define UART_IM_TXIM_MASK        0x00000020
+#define UART_ICR_TXIC_MASK       0x00000020
+
+/* Size of the software transmit buffer, must be a power of 2 */
+#define UART0_TX_BUFFER_SIZE     1024
+
+/* UART0 is IRQ 5, its priority is held in bits 13, 14 and 15 of PRI1. The priority
+ * must not be above configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY as the producers mask it */
+#define UART0_PRIORITY_MASK      0xFFFF1FFF
+#define UART0_PRIORITY_BITS_POS  13
+#define UART0_INTERRUPT_PRIORITY 5
+
+/*******************************************************************************
+ *                            Functions Prototypes                             *
+ *******************************************************************************/
+
+extern void UART0_Init(void);
+
+extern void UART0_SendByte(uint8 data);
+
+extern uint8 UART0_ReceiveByte(void);
+
+extern void UART0_SendString(const uint8 *pData);
+
+extern void UART0_SendInteger(sint64 sNumber);
+
+extern uint32 UART0_GetTxDroppedBytes(void);
+
+extern void UART0_Handler(void);
+
+#endif
@@ -0,0 +1,384 @@
+/*
+ * Pools of fixed size buffers passed from task to task by pointer, see
+ * buffer_pool.h.
+ *
+ * The free buffers of a pool are kept in a singly linked list through their
+ * first word, as the free blocks of the object pools are (heap_pool.c), so a
+ * buffer is taken and given back in constant time.  The list is only changed
+ * in a critical section, which is a few instructions long.
+ */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "buffer_pool.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* Bits of the ucFlags member of a pool. */
+#define bufferpoolFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 1 )
+
+/* The first word of a free buffer, the link to the next free buffer. */
+typedef struct BufferPoolFreeBuffer
+{
+    struct BufferPoolFreeBuffer * pxNext;
+} BufferPoolFreeBuffer_t;
+
+typedef struct BufferPoolDef_t
+{
+    uint8_t * pucBuffers;              /*< The first buffer, the others follow every xBufferSize bytes. */
+    BufferPoolFreeBuffer_t * pxFree;   /*< The first free buffer. */
+    size_t xBufferSize;                /*< Size of each buffer, aligned to portBYTE_ALIGNMENT. */
+    UBaseType_t uxBufferCount;
+    UBaseType_t uxFreeCount;
+    UBaseType_t uxMinimumFreeCount;    /*< The lowest uxFreeCount has been. */
+    uint8_t ucFlags;
+} BufferPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Fills in a pool structure and links its buffers in the free list.
+ */
+static void prvInitialiseNewBufferPool( BufferPool_t * const pxBufferPool,
+                                        size_t xBufferSize,
+                                        UBaseType_t uxBufferCount,
+                                        uint8_t * const pucPoolStorageArea,
+                                        uint8_t ucFlags ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes the first free buffer, called in a critical section.
+ */
+static void * prvTake( BufferPool_t * const pxBufferPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Puts a buffer back at the head of the free list, called in a critical
+ * section.
+ */
+static void prvGive( BufferPool_t * const pxBufferPool,
+                     void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    BufferPoolHandle_t xBufferPoolCreate( size_t xBufferSize,
+                                          UBaseType_t uxBufferCount )
+    {
+        BufferPool_t * pxBufferPool;
+        size_t xStorageSize;
+
+        configASSERT( xBufferSize > ( size_t ) 0 );
+        configASSERT( uxBufferCount > ( UBaseType_t ) 0 );
+
+        /* The pool structure is placed in front of the buffers.  Its size is a
+         * multiple of portBYTE_ALIGNMENT so the first buffer stays aligned. */
+        xStorageSize = bufferpoolSTORAGE_SIZE( xBufferSize, uxBufferCount );
+        pxBufferPool = pvPortMalloc( bufferpoolBUFFER_SIZE( sizeof( BufferPool_t ) ) + xStorageSize ); /*lint !e9087 !e9079 pvPortMalloc() always ensures returned memory blocks are aligned per the requirements of the MCU stack. */
+
+        if( pxBufferPool != NULL )
+        {
+            prvInitialiseNewBufferPool( pxBufferPool,
+                                        xBufferSize,
+                                        uxBufferCount,
+                                        ( ( uint8_t * ) pxBufferPool ) + bufferpoolBUFFER_SIZE( sizeof( BufferPool_t ) ),
+                                        0 );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxBufferPool;
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    BufferPoolHandle_t xBufferPoolCreateStatic( size_t xBufferSize,
+                                                UBaseType_t uxBufferCount,
+                                                uint8_t * const pucPoolStorageArea,
+                                                StaticBufferPool_t * const pxStaticBufferPool )
+    {
+        BufferPool_t * const pxBufferPool = ( BufferPool_t * ) pxStaticBufferPool; /*lint !e740 !e9087 BufferPool_t and StaticBufferPool_t are deliberately aliased for data hiding purposes and guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+        configASSERT( xBufferSize > ( size_t ) 0 );
+        configASSERT( uxBufferCount > ( UBaseType_t ) 0 );
+        configASSERT( pucPoolStorageArea );
+        configASSERT( pxStaticBufferPool );
+
+        /* Each buffer is aligned as the storage area is. */
+        configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucPoolStorageArea ) & ( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) == 0U );
+
+        #if ( configASSERT_DEFINED == 1 )
+        {
+            /* Sanity check that the size of the structure used to declare a
+             * variable of type StaticBufferPool_t equals the size of the real
+             * buffer pool structure. */
+            volatile size_t xSize = sizeof( StaticBufferPool_t );
+            configASSERT( xSize == sizeof( BufferPool_t ) );
+        } /*lint !e529 xSize is referenced is configASSERT() is defined. */
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pucPoolStorageArea != NULL ) && ( pxStaticBufferPool != NULL ) )
+        {
+            prvInitialiseNewBufferPool( pxBufferPool,
+                                        xBufferSize,
+                                        uxBufferCount,
+                                        pucPoolStorageArea,
+                                        bufferpoolFLAGS_IS_STATICALLY_ALLOCATED );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( BufferPoolHandle_t ) pxStaticBufferPool;
+    }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vBufferPoolDelete( BufferPoolHandle_t xBufferPool )
+{
+    BufferPool_t * const pxBufferPool = xBufferPool;
+
+    configASSERT( pxBufferPool );
+
+    /* A buffer still in use would point into freed memory. */
+    configASSERT( pxBufferPool->uxFreeCount == pxBufferPool->uxBufferCount );
+
+    if( ( pxBufferPool->ucFlags & bufferpoolFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
+    {
+        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+        {
+            /* Both the structure and the buffers were allocated in one block. */
+            vPortFree( ( void * ) pxBufferPool ); /*lint !e9087 Standard free() semantics require void *, plus pxBufferPool was allocated by pvPortMalloc(). */
+        }
+        #else
+        {
+            /* Should not be possible to get here, ucFlags must be corrupt.
+             * Force an assert. */
+            configASSERT( xBufferPool == ( BufferPoolHandle_t ) ~0 );
+        }
+        #endif
+    }
+    else
+    {
+        /* The structure and the buffers were not allocated dynamically, just
+         * scrub the structure so it does not look like a pool any more. */
+        ( void ) memset( pxBufferPool, 0x00, sizeof( BufferPool_t ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvBufferPoolTake( BufferPoolHandle_t xBufferPool )
+{
+    BufferPool_t * const pxBufferPool = xBufferPool;
+    void * pvBuffer;
+
+    configASSERT( pxBufferPool );
+
+    taskENTER_CRITICAL();
+    {
+        pvBuffer = prvTake( pxBufferPool );
+    }
+    taskEXIT_CRITICAL();
+
+    return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void * pvBufferPoolTakeFromISR( BufferPoolHandle_t xBufferPool )
+{
+    BufferPool_t * const pxBufferPool = xBufferPool;
+    void * pvBuffer;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxBufferPool );
+
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    {
+        pvBuffer = prvTake( pxBufferPool );
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+    return pvBuffer;
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolGive( BufferPoolHandle_t xBufferPool,
+                      void * pvBuffer )
+{
+    BufferPool_t * const pxBufferPool = xBufferPool;
+
+    configASSERT( pxBufferPool );
+
+    taskENTER_CRITICAL();
+    {
+        prvGive( pxBufferPool, pvBuffer );
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vBufferPoolGiveFromISR( BufferPoolHandle_t xBufferPool,
+                             void * pvBuffer )
+{
+    BufferPool_t * const pxBufferPool = xBufferPool;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxBufferPool );
+
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    {
+        prvGive( pxBufferPool, pvBuffer );
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+size_t xBufferPoolGetBufferSize( BufferPoolHandle_t xBufferPool )
+{
+    const BufferPool_t * const pxBufferPool = xBufferPool;
+
+    configASSERT( pxBufferPool );
+
+    return pxBufferPool->xBufferSize;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBufferPoolGetFreeCount( BufferPoolHandle_t xBufferPool )
+{
+    const BufferPool_t * const pxBufferPool = xBufferPool;
+
+    configASSERT( pxBufferPool );
+
+    return pxBufferPool->uxFreeCount;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxBufferPoolGetMinimumEverFreeCount( BufferPoolHandle_t xBufferPool )
+{
+    const BufferPool_t * const pxBufferPool = xBufferPool;
+
+    configASSERT( pxBufferPool );
+
+    return pxBufferPool->uxMinimumFreeCount;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBufferQueueSend( QueueHandle_t xQueue,
+                             void * pvBuffer,
+                             TickType_t xTicksToWait )
+{
+    /* The queue copies the pointer, not the buffer. */
+    return xQueueSendToBack( xQueue, &pvBuffer, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBufferQueueSendFromISR( QueueHandle_t xQueue,
+                                    void * pvBuffer,
+                                    BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    return xQueueSendToBackFromISR( xQueue, &pvBuffer, pxHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xBufferQueueReceive( QueueHandle_t xQueue,
+                                void ** const ppvBuffer,
+                                TickType_t xTicksToWait )
+{
+    configASSERT( ppvBuffer );
+
+    return xQueueReceive( xQueue, ppvBuffer, xTicksToWait );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewBufferPool( BufferPool_t * const pxBufferPool,
+                                        size_t xBufferSize,
+                                        UBaseType_t uxBufferCount,
+                                        uint8_t * const pucPoolStorageArea,
+                                        uint8_t ucFlags )
+{
+    UBaseType_t uxIndex;
+    BufferPoolFreeBuffer_t * pxBuffer;
+
+    pxBufferPool->pucBuffers = pucPoolStorageArea;
+    pxBufferPool->xBufferSize = bufferpoolBUFFER_SIZE( xBufferSize );
+    pxBufferPool->uxBufferCount = uxBufferCount;
+    pxBufferPool->uxFreeCount = uxBufferCount;
+    pxBufferPool->uxMinimumFreeCount = uxBufferCount;
+    pxBufferPool->ucFlags = ucFlags;
+
+    /* Link the buffers in address order, the last one ends the list. */
+    pxBufferPool->pxFree = ( BufferPoolFreeBuffer_t * ) pucPoolStorageArea; /*lint !e826 !e9087 The storage area is aligned to portBYTE_ALIGNMENT. */
+
+    for( uxIndex = ( UBaseType_t ) 0; uxIndex < uxBufferCount; uxIndex++ )
+    {
+        pxBuffer = ( BufferPoolFreeBuffer_t * ) &( pucPoolStorageArea[ uxIndex * pxBufferPool->xBufferSize ] ); /*lint !e826 !e9087 Each buffer is aligned to portBYTE_ALIGNMENT. */
+
+        if( uxIndex < ( uxBufferCount - ( UBaseType_t ) 1 ) )
+        {
+            pxBuffer->pxNext = ( BufferPoolFreeBuffer_t * ) &( pucPoolStorageArea[ ( uxIndex + ( UBaseType_t ) 1 ) * pxBufferPool->xBufferSize ] ); /*lint !e826 !e9087 Each buffer is aligned to portBYTE_ALIGNMENT. */
+        }
+        else
+        {
+            pxBuffer->pxNext = NULL;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void * prvTake( BufferPool_t * const pxBufferPool )
+{
+    BufferPoolFreeBuffer_t * const pxBuffer = pxBufferPool->pxFree;
+
+    if( pxBuffer != NULL )
+    {
+        pxBufferPool->pxFree = pxBuffer->pxNext;
+        pxBufferPool->uxFreeCount--;
+
+        if( pxBufferPool->uxFreeCount < pxBufferPool->uxMinimumFreeCount )
+        {
+            pxBufferPool->uxMinimumFreeCount = pxBufferPool->uxFreeCount;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxBuffer;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGive( BufferPool_t * const pxBufferPool,
+                     void * const pvBuffer )
+{
+    BufferPoolFreeBuffer_t * const pxBuffer = ( BufferPoolFreeBuffer_t * ) pvBuffer;
+
+    /* The buffer must be one of the pool, and not be free already: a pool
+     * with every buffer free was given one too many. */
+    configASSERT( ( ( uint8_t * ) pvBuffer >= pxBufferPool->pucBuffers ) &&
+                  ( ( uint8_t * ) pvBuffer < &( pxBufferPool->pucBuffers[ pxBufferPool->uxBufferCount * pxBufferPool->xBufferSize ] ) ) );
+    configASSERT( ( ( size_t ) ( ( uint8_t * ) pvBuffer - pxBufferPool->pucBuffers ) % pxBufferPool->xBufferSize ) == ( size_t ) 0 );
+    configASSERT( pxBufferPool->uxFreeCount < pxBufferPool->uxBufferCount );
+
+    pxBuffer->pxNext = pxBufferPool->pxFree;
+    pxBufferPool->pxFree = pxBuffer;
+    pxBufferPool->uxFreeCount++;
+}
+/*-----------------------------------------------------------*/
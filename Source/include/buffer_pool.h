@@ -0,0 +1,157 @@
+/*
+ * Pools of fixed size buffers passed from task to task by pointer.
+ *
+ * A queue copies each item into its storage area when it is sent and out of it
+ * when it is received.  For large items, such as frames of sensor samples or
+ * log records, the two copies cost more than the rest of the queue operation
+ * and grow with the item.  A buffer pool holds a fixed number of buffers of one
+ * size.  The writer takes a buffer from the pool, fills it in place and sends
+ * its pointer on a buffer queue, a queue of pointers created with
+ * xBufferQueueCreate().  The reader receives the pointer, uses the buffer in
+ * place and gives it back to the pool.  Only the pointer is copied, so the cost
+ * is the same whatever the size of the buffer.
+ *
+ * A buffer has one owner at a time:
+ * - pvBufferPoolTake() makes the caller the owner of the buffer it returns.
+ * - xBufferQueueSend() hands the buffer to the queue when it returns pdPASS,
+ *   the caller must not use the buffer after that.  When it returns
+ *   errQUEUE_FULL the caller still owns the buffer.
+ * - xBufferQueueReceive() makes the caller the owner of the buffer it receives.
+ * - vBufferPoolGive() gives the buffer back to the pool it was taken from, the
+ *   caller must not use it after that.
+ *
+ * Taking and giving a buffer are constant time and can be called from an
+ * interrupt through their FromISR versions.  pvBufferPoolTake() does not block,
+ * it returns NULL when every buffer is in use.
+ */
+
+#ifndef BUFFER_POOL_H
+#define BUFFER_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include buffer_pool.h"
+#endif
+
+#include "queue.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * Type by which buffer pools are referenced.  For example, a call to
+ * xBufferPoolCreate() returns a BufferPoolHandle_t variable that can then be
+ * used as a parameter to pvBufferPoolTake(), vBufferPoolGive(), etc.
+ */
+struct BufferPoolDef_t;
+typedef struct BufferPoolDef_t * BufferPoolHandle_t;
+
+/* The size of a buffer in the pool, xBufferSize rounded up so that every
+ * buffer is aligned to portBYTE_ALIGNMENT and can hold the free list link. */
+#define bufferpoolBUFFER_SIZE( xBufferSize )                                                               \
+    ( ( ( ( ( xBufferSize ) < sizeof( void * ) ) ? sizeof( void * ) : ( xBufferSize ) ) + ( portBYTE_ALIGNMENT - 1 ) ) & \
+      ~( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) )
+
+/* The size of the storage area given to xBufferPoolCreateStatic(), which must
+ * be aligned to portBYTE_ALIGNMENT. */
+#define bufferpoolSTORAGE_SIZE( xBufferSize, uxBufferCount )    ( bufferpoolBUFFER_SIZE( xBufferSize ) * ( size_t ) ( uxBufferCount ) )
+
+/*
+ * Creates a pool of uxBufferCount buffers of at least xBufferSize bytes, in
+ * memory allocated from the FreeRTOS heap.  Returns NULL if the memory could
+ * not be allocated.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BufferPoolHandle_t xBufferPoolCreate( size_t xBufferSize,
+                                          UBaseType_t uxBufferCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Creates a pool of uxBufferCount buffers of at least xBufferSize bytes in
+ * pucPoolStorageArea, which is bufferpoolSTORAGE_SIZE( xBufferSize,
+ * uxBufferCount ) bytes aligned to portBYTE_ALIGNMENT.  The pool structure is
+ * held in *pxStaticBufferPool.
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    BufferPoolHandle_t xBufferPoolCreateStatic( size_t xBufferSize,
+                                                UBaseType_t uxBufferCount,
+                                                uint8_t * const pucPoolStorageArea,
+                                                StaticBufferPool_t * const pxStaticBufferPool ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Deletes a pool.  Every buffer must have been given back.
+ */
+void vBufferPoolDelete( BufferPoolHandle_t xBufferPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Takes a free buffer from the pool.  Returns NULL if every buffer is in use.
+ */
+void * pvBufferPoolTake( BufferPoolHandle_t xBufferPool ) PRIVILEGED_FUNCTION;
+void * pvBufferPoolTakeFromISR( BufferPoolHandle_t xBufferPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * Gives a buffer taken from the pool back to it.
+ */
+void vBufferPoolGive( BufferPoolHandle_t xBufferPool,
+                      void * pvBuffer ) PRIVILEGED_FUNCTION;
+void vBufferPoolGiveFromISR( BufferPoolHandle_t xBufferPool,
+                             void * pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * The usable size of each buffer of the pool, at least the size it was created
+ * with.
+ */
+size_t xBufferPoolGetBufferSize( BufferPoolHandle_t xBufferPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * The number of free buffers now, and the lowest it has been since the pool
+ * was created.
+ */
+UBaseType_t uxBufferPoolGetFreeCount( BufferPoolHandle_t xBufferPool ) PRIVILEGED_FUNCTION;
+UBaseType_t uxBufferPoolGetMinimumEverFreeCount( BufferPoolHandle_t xBufferPool ) PRIVILEGED_FUNCTION;
+
+/*
+ * A buffer queue is a queue whose items are buffer pointers.
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    #define xBufferQueueCreate( uxQueueLength ) \
+    xQueueCreate( ( uxQueueLength ), sizeof( void * ) )
+#endif
+
+/* pucQueueStorage holds uxQueueLength * sizeof( void * ) bytes. */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #define xBufferQueueCreateStatic( uxQueueLength, pucQueueStorage, pxQueueBuffer ) \
+    xQueueCreateStatic( ( uxQueueLength ), sizeof( void * ), ( pucQueueStorage ), ( pxQueueBuffer ) )
+#endif
+
+/*
+ * Sends the pointer of a buffer on a buffer queue, blocking for up to
+ * xTicksToWait ticks for space as xQueueSendToBack() does.  The queue owns the
+ * buffer when pdPASS is returned.
+ */
+BaseType_t xBufferQueueSend( QueueHandle_t xQueue,
+                             void * pvBuffer,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xBufferQueueSendFromISR( QueueHandle_t xQueue,
+                                    void * pvBuffer,
+                                    BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Receives the pointer of a buffer from a buffer queue into *ppvBuffer,
+ * blocking for up to xTicksToWait ticks as xQueueReceive() does.  The caller
+ * owns the buffer when pdPASS is returned.
+ */
+BaseType_t xBufferQueueReceive( QueueHandle_t xQueue,
+                                void ** const ppvBuffer,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* BUFFER_POOL_H */
@@ -0,0 +1,106 @@
+/*
+ * Wait-free ring of fixed size items from one producer to one consumer.
+ *
+ * The ring passes data from an interrupt to a task, or from a task to an
+ * interrupt, without a critical section: the producer is the only writer of
+ * the head and the consumer the only writer of the tail, both are 32-bit
+ * counters read and written with Atomic_Load_u32() and Atomic_Store_u32().
+ * Pushing and popping an item never masks interrupts and never waits, so they
+ * can be called from an interrupt of any priority, including one above
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.  A push to a full ring fails and the
+ * item is dropped, the ring keeps the oldest unread items.
+ *
+ * There must be a single producer and a single consumer at a time.  Two tasks,
+ * or a task and an interrupt, that both push to the same ring must serialise
+ * their pushes themselves.
+ *
+ * The consumer can poll the ring, or set itself as the consumer task of the
+ * ring with vSpscRingSetConsumer().  The push that finds the ring empty then
+ * sets the given bits of the notification value of the consumer task, so the
+ * task can wait for the ring with xSpscRingReceive() or together with other
+ * notifications.  Only that push notifies, a consumer woken that way must pop
+ * until the ring is empty before waiting again.  Notifying the consumer from
+ * an interrupt is a kernel call, so the interrupt then runs at or below
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ */
+
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include spsc_ring.h"
+#endif
+
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+typedef struct xSPSC_RING
+{
+    uint8_t * pucStorage;                /*< ulLength items of xItemSize bytes. */
+    size_t xItemSize;
+    uint32_t ulMask;                     /*< The length minus 1, the length is a power of 2. */
+    volatile uint32_t ulHead;            /*< Items pushed since the ring was initialised, only written by the producer. */
+    volatile uint32_t ulTail;            /*< Items popped since the ring was initialised, only written by the consumer. */
+    volatile TaskHandle_t xConsumerTask; /*< Task notified when an item is pushed to the empty ring, NULL for none. */
+    volatile uint32_t ulNotifyBits;      /*< Bits set in the notification value of the consumer task. */
+} SpscRing_t;
+
+/*
+ * Must be called before the ring is used.  pvStorage holds ulLength items of
+ * xItemSize bytes, ulLength is a power of 2.
+ */
+void vSpscRingInitialise( SpscRing_t * const pxRing,
+                          void * const pvStorage,
+                          const size_t xItemSize,
+                          const uint32_t ulLength ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy an item to the ring.  Returns pdFAIL, and does not copy it, if the
+ * ring is full.  Only called by the producer.
+ */
+BaseType_t xSpscRingPush( SpscRing_t * const pxRing,
+                          const void * const pvItem ) PRIVILEGED_FUNCTION;
+BaseType_t xSpscRingPushFromISR( SpscRing_t * const pxRing,
+                                 const void * const pvItem,
+                                 BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy the oldest item out of the ring.  Returns pdFAIL if the ring is empty,
+ * it never waits.  Only called by the consumer, from a task or an interrupt.
+ */
+BaseType_t xSpscRingPop( SpscRing_t * const pxRing,
+                         void * const pvItem ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+/*
+ * Set the task notified when an item is pushed to the empty ring and the bits
+ * set in its notification value (index 0), or stop notifying with a NULL task.
+ */
+    void vSpscRingSetConsumer( SpscRing_t * const pxRing,
+                               const TaskHandle_t xConsumerTask,
+                               const uint32_t ulNotifyBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Pop the oldest item, waiting up to xTicksToWait ticks for one when the ring
+ * is empty.  Only called by the consumer task set with vSpscRingSetConsumer(),
+ * its notify bits are cleared.  Returns pdFAIL if no item came in time.
+ */
+    BaseType_t xSpscRingReceive( SpscRing_t * const pxRing,
+                                 void * const pvItem,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* SPSC_RING_H */
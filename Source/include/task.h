@@ -1088,6 +1088,55 @@ void vTaskGetInfo( TaskHandle_t xTask,
 void vTaskPrioritySet( TaskHandle_t xTask,
                        UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * Set the relative deadline of a task.  The ready tasks of priority
+ * configEDF_PRIORITY run earliest deadline first: a job is released when the
+ * task enters the Ready state, ends when it blocks or is suspended, and its
+ * absolute deadline is its release tick plus the relative deadline.  The new
+ * deadline also applies to the current job, so a context switch will occur
+ * before the function returns if another job is now due first.  A task with
+ * no deadline set runs after every task that has one.
+ *
+ * @param xTask Handle to the task for which the deadline is being set.
+ * Passing a NULL handle results in the deadline of the calling task being set.
+ *
+ * @param xRelativeDeadline The deadline of each job, in ticks from its release.
+ * At most portMAX_DELAY / 2.
+ *
+ * \defgroup vTaskSetDeadline vTaskSetDeadline
+ * \ingroup TaskCtrl
+ */
+void vTaskSetDeadline( TaskHandle_t xTask,
+                       TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * @code{c}
+ * TickType_t xTaskGetDeadline( TaskHandle_t xTask );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.  See the configuration section for more information.
+ *
+ * @param xTask Handle of the task to be queried.  Passing a NULL handle
+ * results in the deadline of the calling task being returned.
+ *
+ * @return The absolute deadline, in ticks, of the current job of the task, or
+ * of the job it would start if it was made ready now.
+ *
+ * \defgroup xTaskGetDeadline xTaskGetDeadline
+ * \ingroup TaskCtrl
+ */
+TickType_t xTaskGetDeadline( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * @code{c}
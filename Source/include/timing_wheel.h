@@ -0,0 +1,112 @@
+/*
+ * Hierarchical timing wheel of list items ordered by time.
+ *
+ * The wheel replaces a list sorted on the item value, as the delayed task
+ * lists are, when many items wait for a time.  It has timingwheelLEVELS levels
+ * of timingwheelSLOTS_PER_LEVEL unsorted lists.  An item due within
+ * timingwheelSLOTS_PER_LEVEL ticks goes to the slot of its time in level 0,
+ * an item due later goes to the slot of the same bits of its time in the level
+ * that covers its delay.  When the time reaches the start of a slot of a higher
+ * level, the items of that slot are moved down, each item moving at most once
+ * per level.  Inserting an item and taking the items due at a time are then
+ * constant time, whatever the number of items.
+ *
+ * The slots are List_t lists, so an item is taken out of the wheel with
+ * uxListRemove() as from any list.  A bit per slot records the slots that may
+ * hold items, it is cleared lazily once the slot is found empty.
+ *
+ * The wheel has no time of its own: the owner passes the time of every call,
+ * and must pass every time to pxTimingWheelAdvance(), in order, except the
+ * times before the one returned by xTimingWheelGetNextTime(), where there is
+ * nothing to do.
+ */
+
+#ifndef TIMING_WHEEL_H
+#define TIMING_WHEEL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include timing_wheel.h"
+#endif
+
+#include "list.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/* Each level decodes configTIMING_WHEEL_SLOT_BITS bits of the time. */
+#ifndef configTIMING_WHEEL_SLOT_BITS
+    #define configTIMING_WHEEL_SLOT_BITS    4
+#endif
+
+#if ( configUSE_16_BIT_TICKS == 1 )
+    #define timingwheelTICK_BITS    16
+#else
+    #define timingwheelTICK_BITS    32
+#endif
+
+/* The levels split the time in equal fields, and the bits of a level are kept
+ * in a UBaseType_t. */
+#if ( ( configTIMING_WHEEL_SLOT_BITS != 2 ) && ( configTIMING_WHEEL_SLOT_BITS != 4 ) )
+    #error configTIMING_WHEEL_SLOT_BITS must be 2 or 4
+#endif
+
+#define timingwheelSLOTS_PER_LEVEL    ( ( UBaseType_t ) 1U << configTIMING_WHEEL_SLOT_BITS )
+#define timingwheelLEVELS             ( timingwheelTICK_BITS / configTIMING_WHEEL_SLOT_BITS )
+#define timingwheelNUMBER_OF_SLOTS    ( timingwheelLEVELS * timingwheelSLOTS_PER_LEVEL )
+
+typedef struct xTIMING_WHEEL
+{
+    List_t xSlots[ timingwheelNUMBER_OF_SLOTS ];   /*< Slot S of level L is xSlots[ ( L * timingwheelSLOTS_PER_LEVEL ) + S ]. */
+    UBaseType_t uxOccupiedSlots[ timingwheelLEVELS ]; /*< Bit S is set when slot S of the level may hold items. */
+} TimingWheel_t;
+
+/* pdTRUE if pxList is one of the slots of the wheel. */
+#define timingwheelIS_SLOT( pxWheel, pxList )                          \
+    ( ( ( ( const List_t * ) ( pxList ) ) >= &( ( pxWheel )->xSlots[ 0 ] ) ) && \
+      ( ( ( const List_t * ) ( pxList ) ) < &( ( pxWheel )->xSlots[ timingwheelNUMBER_OF_SLOTS ] ) ) )
+
+/*
+ * Must be called before the wheel is used.
+ */
+void vTimingWheelInitialise( TimingWheel_t * const pxWheel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert an item that is not in a list.  Its value is the time it is due, at
+ * most portMAX_DELAY ticks after xTimeNow, the last time passed to
+ * pxTimingWheelAdvance().  An item due at xTimeNow is due at the next time.
+ *
+ * Returns the time at which the wheel next handles the item: the time it is
+ * due or, when it is due later, the time it is moved to a lower level.  The
+ * owner must not skip that time.
+ */
+TickType_t xTimingWheelInsert( TimingWheel_t * const pxWheel,
+                               ListItem_t * const pxNewListItem,
+                               const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move down the items of the levels whose slot starts at xTime, then return
+ * the list of the items due at xTime.  The owner takes them out of the list,
+ * they are not removed by the wheel.
+ */
+List_t * pxTimingWheelAdvance( TimingWheel_t * const pxWheel,
+                               const TickType_t xTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdFALSE if the wheel is empty.  Otherwise sets *pxNextTime to the
+ * first time after xTimeNow that pxTimingWheelAdvance() has to handle, which
+ * is at most the time the first item is due.
+ */
+BaseType_t xTimingWheelGetNextTime( TimingWheel_t * const pxWheel,
+                                    const TickType_t xTimeNow,
+                                    TickType_t * const pxNextTime ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TIMING_WHEEL_H */
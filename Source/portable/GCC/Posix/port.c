@@ -0,0 +1,418 @@
+/*
+ * FreeRTOS Kernel V10.5.1
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*-----------------------------------------------------------
+* Implementation of functions defined in portable.h for the host build of the
+* SIMULATION target.
+*
+* Each task runs on a POSIX thread of its own, but only one of them runs at a
+* time: the running thread holds xCPUMutex, a context switch hands it to the
+* thread of the task selected by vTaskSwitchContext() and parks the calling
+* thread until it is selected again.  Nothing interrupts a thread behind the
+* kernel's back, interrupt handlers only run when the running thread calls
+* vPortRunInterrupt(), which the SIMULATION build does from its virtual clock
+* (MCAL/SIM).  A run therefore takes the same path on every host.
+*
+* The task stack only holds the thread of the task, the thread runs on a stack
+* of its own, so the stack high water mark of a task means nothing here.
+*
+* Tickless idle takes the path of the low power timer of the CCS port
+* (configUSE_LOW_POWER_TICKLESS_TIMER): the tick timer is stopped, the low power
+* timer is armed to the end of the expected idle time, and the tick count is
+* stepped by the tick periods the low power timer measured.  The tick timer and
+* the sleep itself are provided by the application, see
+* vPortSuppressTicksAndSleep().
+*----------------------------------------------------------*/
+
+#include <pthread.h>
+#include <stdlib.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* The low power timer used by tickless idle is a 32-bit counter. */
+#define portMAX_32_BIT_NUMBER    ( 0xffffffffUL )
+
+/* Tickless idle needs the timers and the sleep of the application:
+ * - configTICK_TIMER_STOP() stops the tick interrupt and returns the counts of
+ *   configCPU_CLOCK_HZ left until the next tick, 0 if that tick is due but was not
+ *   raised yet;
+ * - configTICK_TIMER_START( ulCounts ) raises the next tick ulCounts counts later,
+ *   then one every tick period;
+ * - configLOW_POWER_TIMER_INIT(), configLOW_POWER_TIMER_START( ulCounts ) and
+ *   configLOW_POWER_TIMER_STOP() as in the CCS port, clocked at
+ *   configLOW_POWER_TIMER_CLOCK_HZ;
+ * - configWAIT_FOR_INTERRUPT() sleeps until an interrupt and runs its handler with
+ *   vPortRunInterrupt(). */
+#if ( configUSE_TICKLESS_IDLE == 1 )
+    #if !defined( configTICK_TIMER_STOP ) || !defined( configTICK_TIMER_START ) || !defined( configWAIT_FOR_INTERRUPT )
+        #error configUSE_TICKLESS_IDLE requires configTICK_TIMER_STOP(), configTICK_TIMER_START() and configWAIT_FOR_INTERRUPT()
+    #endif
+    #define portLOW_POWER_TIMER_DIVIDER    ( configCPU_CLOCK_HZ / configLOW_POWER_TIMER_CLOCK_HZ )
+#endif
+
+typedef struct THREAD
+{
+    pthread_t xThread;
+    pthread_cond_t xSelected;   /*< Signalled when the task is selected to run or deleted. */
+    TaskFunction_t pxCode;
+    void * pvParameters;
+    BaseType_t xDeleted;
+} Thread_t;
+
+/*
+ * The thread of a task, stored at the top of its stack by
+ * pxPortInitialiseStack(), the first member of a TCB points to it.
+ */
+#define portTHREAD_OF_TCB( pxTCB )    ( *( ( Thread_t ** ) ( *( ( StackType_t ** ) ( pxTCB ) ) ) ) )
+
+/*
+ * Entry point of the task threads.
+ */
+static void * prvThreadEntry( void * pvThread );
+
+/*
+ * Called by the running thread, holding xCPUMutex, to wait until its task is
+ * selected to run again.  Ends the thread if its task is deleted meanwhile.
+ */
+static void prvWaitUntilSelected( Thread_t * const pxThread );
+
+/*
+ * Select the task to run and hand it the CPU.
+ */
+static void prvSwitchContext( void );
+
+/*-----------------------------------------------------------*/
+
+extern void * volatile pxCurrentTCB;
+
+/* Held by the thread that runs, the others wait on their xSelected condition. */
+static pthread_mutex_t xCPUMutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Thread of the running task, NULL before the scheduler starts and once it ends. */
+static Thread_t * pxRunningThread = NULL;
+
+/* Signalled by vPortEndScheduler() for the thread that started the scheduler. */
+static pthread_cond_t xSchedulerEnded = PTHREAD_COND_INITIALIZER;
+static BaseType_t xSchedulerRunning = pdFALSE;
+
+/* Masks the context switches until the scheduler is started, see the CCS port. */
+static UBaseType_t uxCriticalNesting = 0xaaaaaaaa;
+static UBaseType_t uxInterruptNesting = 0;
+
+/* A context switch asked for inside a critical section or an interrupt handler,
+ * taken once both are left, as a pended PendSV would be. */
+static BaseType_t xSwitchPending = pdFALSE;
+
+/*
+ * The number of tick timer counts that make up one tick period, and the maximum
+ * number of tick periods the 32 bit low power timer can suppress.
+ */
+#if ( configUSE_TICKLESS_IDLE == 1 )
+    static uint32_t ulTimerCountsForOneTick = 0;
+    static uint32_t xMaximumPossibleSuppressedTicks = 0;
+#endif /* configUSE_TICKLESS_IDLE */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                     TaskFunction_t pxCode,
+                                     void * pvParameters )
+{
+    Thread_t * pxThread;
+    pthread_attr_t xAttributes;
+    int iResult;
+
+    pxThread = ( Thread_t * ) malloc( sizeof( Thread_t ) );
+    configASSERT( pxThread != NULL );
+
+    pxThread->pxCode = pxCode;
+    pxThread->pvParameters = pvParameters;
+    pxThread->xDeleted = pdFALSE;
+    ( void ) pthread_cond_init( &( pxThread->xSelected ), NULL );
+
+    /* The thread waits for xCPUMutex, then until its task is selected. */
+    ( void ) pthread_attr_init( &xAttributes );
+    ( void ) pthread_attr_setdetachstate( &xAttributes, PTHREAD_CREATE_DETACHED );
+    iResult = pthread_create( &( pxThread->xThread ), &xAttributes, prvThreadEntry, pxThread );
+    ( void ) pthread_attr_destroy( &xAttributes );
+    configASSERT( iResult == 0 );
+    ( void ) iResult;
+
+    *pxTopOfStack = ( StackType_t ) pxThread;
+
+    return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+static void * prvThreadEntry( void * pvThread )
+{
+    Thread_t * const pxThread = ( Thread_t * ) pvThread;
+
+    ( void ) pthread_mutex_lock( &xCPUMutex );
+    prvWaitUntilSelected( pxThread );
+
+    pxThread->pxCode( pxThread->pvParameters );
+
+    /* A task must not return from its implementing function, the CCS port
+     * stops in prvTaskExitError().  The task is deleted instead. */
+    vTaskDelete( NULL );
+
+    return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitUntilSelected( Thread_t * const pxThread )
+{
+    while( ( pxRunningThread != pxThread ) && ( pxThread->xDeleted == pdFALSE ) )
+    {
+        ( void ) pthread_cond_wait( &( pxThread->xSelected ), &xCPUMutex );
+    }
+
+    if( pxThread->xDeleted != pdFALSE )
+    {
+        /* The TCB and the stack are already freed, nothing refers to the
+         * thread any more. */
+        ( void ) pthread_mutex_unlock( &xCPUMutex );
+        ( void ) pthread_cond_destroy( &( pxThread->xSelected ) );
+        free( pxThread );
+        pthread_exit( NULL );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+    Thread_t * const pxThread = pxRunningThread;
+
+    xSwitchPending = pdFALSE;
+    vTaskSwitchContext();
+    pxRunningThread = portTHREAD_OF_TCB( pxCurrentTCB );
+
+    if( pxRunningThread != pxThread )
+    {
+        ( void ) pthread_cond_signal( &( pxRunningThread->xSelected ) );
+        prvWaitUntilSelected( pxThread );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+    ( void ) pthread_mutex_lock( &xCPUMutex );
+
+    #if ( configUSE_TICKLESS_IDLE == 1 )
+    {
+        /* The CPU clock must be a multiple of the low power timer clock. */
+        configASSERT( ( configCPU_CLOCK_HZ % configLOW_POWER_TIMER_CLOCK_HZ ) == 0 );
+
+        ulTimerCountsForOneTick = ( configCPU_CLOCK_HZ / configTICK_RATE_HZ );
+        xMaximumPossibleSuppressedTicks = portMAX_32_BIT_NUMBER / ulTimerCountsForOneTick;
+        configLOW_POWER_TIMER_INIT();
+    }
+    #endif /* configUSE_TICKLESS_IDLE */
+
+    /* Hand the CPU to the first task, then wait for vPortEndScheduler(). */
+    uxCriticalNesting = 0;
+    xSchedulerRunning = pdTRUE;
+    pxRunningThread = portTHREAD_OF_TCB( pxCurrentTCB );
+    ( void ) pthread_cond_signal( &( pxRunningThread->xSelected ) );
+
+    while( xSchedulerRunning != pdFALSE )
+    {
+        ( void ) pthread_cond_wait( &xSchedulerEnded, &xCPUMutex );
+    }
+
+    ( void ) pthread_mutex_unlock( &xCPUMutex );
+
+    return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+    Thread_t * const pxThread = pxRunningThread;
+
+    /* The threads of the tasks are left waiting, the host process ends them. */
+    pxRunningThread = NULL;
+    xSchedulerRunning = pdFALSE;
+    ( void ) pthread_cond_signal( &xSchedulerEnded );
+    prvWaitUntilSelected( pxThread );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+    if( ( uxCriticalNesting != 0 ) || ( uxInterruptNesting != 0 ) )
+    {
+        xSwitchPending = pdTRUE;
+    }
+    else
+    {
+        prvSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+    uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+    configASSERT( uxCriticalNesting );
+    uxCriticalNesting--;
+
+    if( ( uxCriticalNesting == 0 ) && ( uxInterruptNesting == 0 ) && ( xSwitchPending != pdFALSE ) )
+    {
+        prvSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortRunInterrupt( void ( * pvHandler )( void ) )
+{
+    uxInterruptNesting++;
+    pvHandler();
+    uxInterruptNesting--;
+
+    if( ( uxCriticalNesting == 0 ) && ( uxInterruptNesting == 0 ) && ( xSwitchPending != pdFALSE ) )
+    {
+        prvSwitchContext();
+    }
+}
+/*-----------------------------------------------------------*/
+
+void xPortSysTickHandler( void )
+{
+    /* Increment the RTOS tick, the context switch is taken when the handler
+     * returns from vPortRunInterrupt(). */
+    if( xTaskIncrementTick() != pdFALSE )
+    {
+        xSwitchPending = pdTRUE;
+    }
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+
+    void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+    {
+        uint32_t ulSleepCounts, ulElapsedCounts, ulCompleteTickPeriods, ulTickCountsLeft;
+        TickType_t xModifiableIdleTime;
+
+        /* Make sure the sleep time does not overflow the low power timer. */
+        if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+        {
+            xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+        }
+
+        /* No interrupt runs before configWAIT_FOR_INTERRUPT(), so unlike the CCS
+         * port nothing has to be masked.  If a context switch is pending or a task
+         * is waiting for the scheduler to be unsuspended then abandon the low
+         * power entry. */
+        if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+        {
+            return;
+        }
+
+        /* Stop the tick for the whole sleep, the low power timer measures the
+         * time instead.  A tick that is due but was not raised yet is a tick
+         * period that already ended, it is stepped with the others. */
+        ulTickCountsLeft = configTICK_TIMER_STOP();
+        ulCompleteTickPeriods = 0;
+
+        if( ulTickCountsLeft == 0 )
+        {
+            ulTickCountsLeft = ulTimerCountsForOneTick;
+            ulCompleteTickPeriods = 1;
+        }
+
+        /* Sleep until the end of the xExpectedIdleTime tick period counted from
+         * the last processed tick. */
+        ulSleepCounts = ulTickCountsLeft + ( ulTimerCountsForOneTick * ( xExpectedIdleTime - 1UL - ulCompleteTickPeriods ) );
+
+        configLOW_POWER_TIMER_START( ulSleepCounts / portLOW_POWER_TIMER_DIVIDER );
+
+        xModifiableIdleTime = xExpectedIdleTime;
+        configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+
+        if( xModifiableIdleTime > 0 )
+        {
+            configWAIT_FOR_INTERRUPT();
+        }
+
+        configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+        ulElapsedCounts = configLOW_POWER_TIMER_STOP() * portLOW_POWER_TIMER_DIVIDER;
+
+        /* Count the tick periods that ended during the sleep and restart the
+         * tick with whatever remains of the current one. */
+        if( ulElapsedCounts >= ulTickCountsLeft )
+        {
+            ulElapsedCounts -= ulTickCountsLeft;
+            ulCompleteTickPeriods += 1UL + ( ulElapsedCounts / ulTimerCountsForOneTick );
+            ulTickCountsLeft = ulTimerCountsForOneTick - ( ulElapsedCounts % ulTimerCountsForOneTick );
+        }
+        else
+        {
+            ulTickCountsLeft -= ulElapsedCounts;
+        }
+
+        /* The sleep never ends after the expected idle time, the low power
+         * timer stops counting at its time out. */
+        configASSERT( ulCompleteTickPeriods <= xExpectedIdleTime );
+
+        configTICK_TIMER_START( ulTickCountsLeft );
+
+        /* Step the tick to account for the tick periods that elapsed. */
+        vTaskStepTick( ulCompleteTickPeriods );
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void * pxTCB )
+{
+    Thread_t * const pxThread = portTHREAD_OF_TCB( pxTCB );
+
+    /* A task deleted before it ever ran, or the task that deleted itself, waits
+     * in prvWaitUntilSelected() and ends once it gets xCPUMutex. */
+    pxThread->xDeleted = pdTRUE;
+    ( void ) pthread_cond_signal( &( pxThread->xSelected ) );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,317 @@
+/*
+ * Fixed size object pools in front of the general heap.
+ *
+ * The kernel allocates the same few sizes over and over: a task control block
+ * and a stack for every task, a Queue_t for every queue, mutex and semaphore,
+ * and so on.  This file serves those sizes from pools of blocks reserved at
+ * build time.  Each pool keeps its free blocks in a singly linked list, so
+ * pvPortMalloc() and vPortFree() are constant time for them and cannot
+ * fragment the general heap.  Every other size, and any size whose pool is
+ * exhausted, is passed on to the general heap (heap_2.c or heap_tlsf.c).
+ *
+ * The pool sizes are taken from the StaticTask_t, StaticQueue_t,
+ * StaticEventGroup_t and StaticTimer_t structures, which the kernel keeps the
+ * same size as the private structures it allocates.  The number of blocks in
+ * each pool, and the stack block size, are set in FreeRTOSConfig.h.
+ *
+ * Select this file by setting configUSE_OBJECT_POOLS to 1 in FreeRTOSConfig.h.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The static allocation profile (configSUPPORT_DYNAMIC_ALLOCATION 0) has no
+ * heap. */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_OBJECT_POOLS == 1 ) )
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Number of blocks in each pool, a pool of 0 blocks is never used. */
+#ifndef configPOOL_TASK_COUNT
+    #define configPOOL_TASK_COUNT           0
+#endif
+
+#ifndef configPOOL_STACK_COUNT
+    #define configPOOL_STACK_COUNT          0
+#endif
+
+#ifndef configPOOL_QUEUE_COUNT
+    #define configPOOL_QUEUE_COUNT          0
+#endif
+
+#ifndef configPOOL_EVENT_GROUP_COUNT
+    #define configPOOL_EVENT_GROUP_COUNT    0
+#endif
+
+#ifndef configPOOL_TIMER_COUNT
+    #define configPOOL_TIMER_COUNT          0
+#endif
+
+/* Stacks are allocated in bytes, so this is the stack depth passed to
+ * xTaskCreate() times sizeof( StackType_t ). */
+#ifndef configPOOL_STACK_SIZE
+    #define configPOOL_STACK_SIZE    ( configMINIMAL_STACK_SIZE * sizeof( StackType_t ) )
+#endif
+
+/* Every block is rounded up to keep the next one aligned. */
+#define heapPOOL_BLOCK_SIZE( xSize )    ( ( ( size_t ) ( xSize ) + portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+#define heapPOOL_COUNT                  ( 5 )
+
+#define heapPOOL_TOTAL_SIZE                                                                     \
+    ( ( heapPOOL_BLOCK_SIZE( sizeof( StaticTask_t ) ) * configPOOL_TASK_COUNT ) +               \
+      ( heapPOOL_BLOCK_SIZE( configPOOL_STACK_SIZE ) * configPOOL_STACK_COUNT ) +               \
+      ( heapPOOL_BLOCK_SIZE( sizeof( StaticQueue_t ) ) * configPOOL_QUEUE_COUNT ) +             \
+      ( heapPOOL_BLOCK_SIZE( sizeof( StaticEventGroup_t ) ) * configPOOL_EVENT_GROUP_COUNT ) +  \
+      ( heapPOOL_BLOCK_SIZE( sizeof( StaticTimer_t ) ) * configPOOL_TIMER_COUNT ) )
+
+/*-----------------------------------------------------------*/
+
+/* A free block holds the link to the next free block of its pool. */
+typedef struct A_POOL_BLOCK
+{
+    struct A_POOL_BLOCK * pxNextFreeBlock;
+} PoolBlock_t;
+
+typedef struct A_POOL
+{
+    size_t xBlockSize;                 /*<< The size of the blocks, rounded up to portBYTE_ALIGNMENT. */
+    UBaseType_t uxNumberOfBlocks;      /*<< The number of blocks in the pool. */
+    uint8_t * pucStart;                /*<< The first block of the pool. */
+    uint8_t * pucEnd;                  /*<< The first byte after the last block of the pool. */
+    PoolBlock_t * pxFreeBlocks;        /*<< The list of free blocks. */
+    UBaseType_t uxNumberOfFreeBlocks;
+    UBaseType_t uxMinimumEverFreeBlocks;
+    size_t xNumberOfFallbacks;
+} Pool_t;
+
+/* The blocks of all the pools, one after the other.  A few bytes might be lost
+ * to byte aligning the start address. */
+PRIVILEGED_DATA static uint8_t ucPoolMemory[ heapPOOL_TOTAL_SIZE + portBYTE_ALIGNMENT ];
+
+/* The blocks are carved, and the rest of each pool filled, by prvPoolInit(). */
+PRIVILEGED_DATA static Pool_t xPools[ heapPOOL_COUNT ] =
+{
+    { heapPOOL_BLOCK_SIZE( sizeof( StaticTask_t ) ),       configPOOL_TASK_COUNT,        NULL, NULL, NULL, 0, 0, 0 },
+    { heapPOOL_BLOCK_SIZE( configPOOL_STACK_SIZE ),        configPOOL_STACK_COUNT,       NULL, NULL, NULL, 0, 0, 0 },
+    { heapPOOL_BLOCK_SIZE( sizeof( StaticQueue_t ) ),      configPOOL_QUEUE_COUNT,       NULL, NULL, NULL, 0, 0, 0 },
+    { heapPOOL_BLOCK_SIZE( sizeof( StaticEventGroup_t ) ), configPOOL_EVENT_GROUP_COUNT, NULL, NULL, NULL, 0, 0, 0 },
+    { heapPOOL_BLOCK_SIZE( sizeof( StaticTimer_t ) ),      configPOOL_TIMER_COUNT,       NULL, NULL, NULL, 0, 0, 0 }
+};
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Carves ucPoolMemory into the blocks of every pool.
+ */
+static void prvPoolInit( void ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    PRIVILEGED_DATA static BaseType_t xPoolsHaveBeenInitialised = pdFALSE;
+    Pool_t * pxPool;
+    Pool_t * pxFirstMatch = NULL;
+    size_t xBlockSize = heapPOOL_BLOCK_SIZE( xWantedSize );
+    void * pvReturn = NULL;
+    UBaseType_t x;
+
+    vTaskSuspendAll();
+    {
+        if( xPoolsHaveBeenInitialised == pdFALSE )
+        {
+            prvPoolInit();
+            xPoolsHaveBeenInitialised = pdTRUE;
+        }
+
+        /* Two kernel structures can round up to the same size, so keep looking
+         * if the first pool of that size is empty.  The pool table is short and
+         * of fixed length, the search is still constant time. */
+        for( x = 0; ( x < heapPOOL_COUNT ) && ( pvReturn == NULL ); x++ )
+        {
+            pxPool = &( xPools[ x ] );
+
+            if( ( pxPool->uxNumberOfBlocks > 0 ) && ( pxPool->xBlockSize == xBlockSize ) && ( xWantedSize > 0 ) )
+            {
+                if( pxFirstMatch == NULL )
+                {
+                    pxFirstMatch = pxPool;
+                }
+
+                if( pxPool->pxFreeBlocks != NULL )
+                {
+                    pvReturn = ( void * ) pxPool->pxFreeBlocks;
+                    pxPool->pxFreeBlocks = pxPool->pxFreeBlocks->pxNextFreeBlock;
+                    pxPool->uxNumberOfFreeBlocks--;
+
+                    if( pxPool->uxNumberOfFreeBlocks < pxPool->uxMinimumEverFreeBlocks )
+                    {
+                        pxPool->uxMinimumEverFreeBlocks = pxPool->uxNumberOfFreeBlocks;
+                    }
+
+                    traceMALLOC( pvReturn, xWantedSize );
+                }
+            }
+        }
+
+        if( ( pvReturn == NULL ) && ( pxFirstMatch != NULL ) )
+        {
+            pxFirstMatch->xNumberOfFallbacks++;
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    /* Any other size, or a size whose pools are all in use.  The general heap
+     * traces the allocation and calls the malloc failed hook itself. */
+    if( pvReturn == NULL )
+    {
+        pvReturn = pvPortMallocGeneral( xWantedSize );
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    Pool_t * pxPool = NULL;
+    PoolBlock_t * pxBlock;
+    UBaseType_t x;
+
+    if( pv != NULL )
+    {
+        /* The address tells which pool, if any, the block came from. */
+        for( x = 0; x < heapPOOL_COUNT; x++ )
+        {
+            if( ( puc >= xPools[ x ].pucStart ) && ( puc < xPools[ x ].pucEnd ) )
+            {
+                pxPool = &( xPools[ x ] );
+                break;
+            }
+        }
+
+        if( pxPool == NULL )
+        {
+            vPortFreeGeneral( pv );
+        }
+        else
+        {
+            configASSERT( ( ( size_t ) ( puc - pxPool->pucStart ) % pxPool->xBlockSize ) == 0 );
+
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( puc, 0, pxPool->xBlockSize );
+            }
+            #endif
+
+            /* This unexpected casting is to keep some compilers from issuing
+             * byte alignment warnings. */
+            pxBlock = ( void * ) puc;
+
+            vTaskSuspendAll();
+            {
+                configASSERT( pxPool->uxNumberOfFreeBlocks < pxPool->uxNumberOfBlocks );
+
+                pxBlock->pxNextFreeBlock = pxPool->pxFreeBlocks;
+                pxPool->pxFreeBlocks = pxBlock;
+                pxPool->uxNumberOfFreeBlocks++;
+                traceFREE( pv, pxPool->xBlockSize );
+            }
+            ( void ) xTaskResumeAll();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetPoolStats( PoolStats_t * pxPoolStats,
+                                UBaseType_t uxArraySize )
+{
+    UBaseType_t x, uxFilled = 0;
+
+    vTaskSuspendAll();
+    {
+        for( x = 0; ( x < heapPOOL_COUNT ) && ( uxFilled < uxArraySize ); x++ )
+        {
+            if( xPools[ x ].uxNumberOfBlocks > 0 )
+            {
+                pxPoolStats[ uxFilled ].xBlockSizeInBytes = xPools[ x ].xBlockSize;
+                pxPoolStats[ uxFilled ].xNumberOfBlocks = xPools[ x ].uxNumberOfBlocks;
+                pxPoolStats[ uxFilled ].xNumberOfFallbacks = xPools[ x ].xNumberOfFallbacks;
+
+                /* Until the first allocation the pools are not carved yet, the
+                 * free counts below are those of the first allocation then. */
+                if( xPools[ x ].pucStart == NULL )
+                {
+                    pxPoolStats[ uxFilled ].xNumberOfFreeBlocks = xPools[ x ].uxNumberOfBlocks;
+                    pxPoolStats[ uxFilled ].xMaximumEverUsedBlocks = 0;
+                }
+                else
+                {
+                    pxPoolStats[ uxFilled ].xNumberOfFreeBlocks = xPools[ x ].uxNumberOfFreeBlocks;
+                    pxPoolStats[ uxFilled ].xMaximumEverUsedBlocks = xPools[ x ].uxNumberOfBlocks - xPools[ x ].uxMinimumEverFreeBlocks;
+                }
+
+                uxFilled++;
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    return uxFilled;
+}
+/*-----------------------------------------------------------*/
+
+static void prvPoolInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    uint8_t * pucNextBlock;
+    PoolBlock_t * pxBlock;
+    Pool_t * pxPool;
+    UBaseType_t x, uxBlock;
+
+    /* Ensure the pools start on a correctly aligned boundary. */
+    pucNextBlock = ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) & ucPoolMemory[ portBYTE_ALIGNMENT - 1 ] ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) );
+
+    for( x = 0; x < heapPOOL_COUNT; x++ )
+    {
+        pxPool = &( xPools[ x ] );
+
+        /* A free block must be able to hold its link. */
+        configASSERT( ( pxPool->uxNumberOfBlocks == 0 ) || ( pxPool->xBlockSize >= sizeof( PoolBlock_t ) ) );
+
+        if( pxPool->uxNumberOfBlocks > 0 )
+        {
+            pxPool->pucStart = pucNextBlock;
+            pxPool->pxFreeBlocks = NULL;
+
+            /* Link the blocks from the last one down, so the first allocation
+             * gets the lowest address. */
+            for( uxBlock = pxPool->uxNumberOfBlocks; uxBlock > 0; uxBlock-- )
+            {
+                pxBlock = ( void * ) ( pucNextBlock + ( ( uxBlock - 1 ) * pxPool->xBlockSize ) );
+                pxBlock->pxNextFreeBlock = pxPool->pxFreeBlocks;
+                pxPool->pxFreeBlocks = pxBlock;
+            }
+
+            pucNextBlock += pxPool->uxNumberOfBlocks * pxPool->xBlockSize;
+            pxPool->pucEnd = pucNextBlock;
+            pxPool->uxNumberOfFreeBlocks = pxPool->uxNumberOfBlocks;
+            pxPool->uxMinimumEverFreeBlocks = pxPool->uxNumberOfBlocks;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_OBJECT_POOLS */
@@ -0,0 +1,583 @@
+/*
+ * An implementation of pvPortMalloc() and vPortFree() based on the Two-Level
+ * Segregated Fit (TLSF) allocator.  Both run in constant time and adjacent free
+ * blocks are combined when a block is freed, so the heap does not fragment the
+ * way heap_2.c does when objects of different sizes are created and deleted.
+ *
+ * Free blocks are kept in segregated lists: the first level splits the sizes in
+ * powers of two, the second level splits each power of two in
+ * heapTLSF_SL_INDEX_COUNT linear ranges.  Two bitmaps record which lists are not
+ * empty so a list holding a large enough block is found with two count leading
+ * zeros instructions instead of a list walk.
+ *
+ * Select this file instead of heap_2.c by setting configUSE_TLSF_HEAP to 1 in
+ * FreeRTOSConfig.h.  See the memory management pages of https://www.FreeRTOS.org
+ * for the other heap implementations.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The static allocation profile (configSUPPORT_DYNAMIC_ALLOCATION 0) has no
+ * heap. */
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configUSE_TLSF_HEAP == 1 ) )
+
+#if ( configUSE_OBJECT_POOLS == 1 )
+    /* heap_pool.c owns pvPortMalloc() and vPortFree() and hands the sizes it has
+     * no pool for to this heap. */
+    #define pvPortMalloc    pvPortMallocGeneral
+    #define vPortFree       vPortFreeGeneral
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* A few bytes might be lost to byte aligning the heap start address. */
+#define configADJUSTED_HEAP_SIZE    ( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX                ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )    ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )         ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/* Index of the most significant set bit, x must not be 0. */
+#if defined( __TI_ARM__ )
+    #define heapFLS( x )    ( 31 - ( UBaseType_t ) __clz( ( uint32_t ) ( x ) ) )
+#elif defined( __GNUC__ )
+    #define heapFLS( x )    ( 31 - ( UBaseType_t ) __builtin_clz( ( uint32_t ) ( x ) ) )
+#else
+    #error heap_tlsf.c needs a count leading zeros intrinsic for this compiler
+#endif
+
+/* Index of the least significant set bit, x must not be 0. */
+#define heapFFS( x )        heapFLS( ( x ) & ( ~( x ) + 1U ) )
+
+/* The second level splits each power of two in 2^heapTLSF_SL_INDEX_COUNT_LOG2
+ * lists.  Blocks smaller than heapTLSF_SMALL_BLOCK_SIZE all go to the first
+ * level 0, in lists portBYTE_ALIGNMENT apart. */
+#if portBYTE_ALIGNMENT == 8
+    #define heapTLSF_ALIGNMENT_LOG2     ( 3 )
+#else
+    #error heap_tlsf.c only supports a portBYTE_ALIGNMENT of 8
+#endif
+#define heapTLSF_SL_INDEX_COUNT_LOG2    ( 3 )
+#define heapTLSF_SL_INDEX_COUNT         ( 1U << heapTLSF_SL_INDEX_COUNT_LOG2 )
+#define heapTLSF_FL_INDEX_SHIFT         ( heapTLSF_SL_INDEX_COUNT_LOG2 + heapTLSF_ALIGNMENT_LOG2 )
+#define heapTLSF_SMALL_BLOCK_SIZE       ( ( size_t ) 1 << heapTLSF_FL_INDEX_SHIFT )
+
+/* Largest block is ( 2 ^ ( configTLSF_FL_INDEX_MAX + 1 ) ) - 1 bytes, enough for
+ * the whole SRAM of the part by default. */
+#ifndef configTLSF_FL_INDEX_MAX
+    #define configTLSF_FL_INDEX_MAX    ( 15 )
+#endif
+#define heapTLSF_FL_INDEX_COUNT        ( configTLSF_FL_INDEX_MAX - heapTLSF_FL_INDEX_SHIFT + 2 )
+
+/* The size of a block is a multiple of portBYTE_ALIGNMENT so its low bits hold
+ * the state of the block and of the block physically before it. */
+#define heapBLOCK_FREE_BIT                   ( ( size_t ) 1 )
+#define heapBLOCK_PREV_FREE_BIT              ( ( size_t ) 2 )
+#define heapBLOCK_SIZE( pxBlock )            ( ( pxBlock )->xBlockSize & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+#define heapBLOCK_IS_FREE( pxBlock )         ( ( ( pxBlock )->xBlockSize & heapBLOCK_FREE_BIT ) != 0 )
+#define heapBLOCK_IS_PREV_FREE( pxBlock )    ( ( ( pxBlock )->xBlockSize & heapBLOCK_PREV_FREE_BIT ) != 0 )
+#define heapNEXT_PHYSICAL_BLOCK( pxBlock )   ( ( BlockLink_t * ) ( ( ( uint8_t * ) ( pxBlock ) ) + heapBLOCK_SIZE( pxBlock ) ) )
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* The header of every block.  pxPrevPhysicalBlock is only valid when the block
+ * before this one is free, the free list links live in the payload of free
+ * blocks so an allocated block only costs heapSTRUCT_SIZE bytes. */
+typedef struct A_BLOCK_LINK
+{
+    struct A_BLOCK_LINK * pxPrevPhysicalBlock; /*<< The block physically before this one, if free. */
+    size_t xBlockSize;                         /*<< The size of the block, header included, and the state bits. */
+    struct A_BLOCK_LINK * pxNextFreeBlock;     /*<< The next free block in the same list (free blocks only). */
+    struct A_BLOCK_LINK * pxPrevFreeBlock;     /*<< The previous free block in the same list (free blocks only). */
+} BlockLink_t;
+
+static const uint16_t heapSTRUCT_SIZE = ( ( offsetof( BlockLink_t, pxNextFreeBlock ) + ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) );
+#define heapMINIMUM_BLOCK_SIZE    ( ( size_t ) ( ( sizeof( BlockLink_t ) + ( portBYTE_ALIGNMENT - 1 ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) ) )
+
+/* The heads of the segregated free lists and the bitmaps of the non empty ones. */
+PRIVILEGED_DATA static BlockLink_t * pxFreeLists[ heapTLSF_FL_INDEX_COUNT ][ heapTLSF_SL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmap[ heapTLSF_FL_INDEX_COUNT ];
+
+/* Keeps track of the number of free bytes remaining, but says nothing about
+ * fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the heap structures before their first use.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * The list a free block of xBlockSize bytes is stored in.
+ */
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Insert a free block in, or remove it from, the list of its size.
+ */
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) PRIVILEGED_FUNCTION;
+
+/*
+ * Remove and return a free block of at least xWantedSize bytes, NULL if there
+ * is none.
+ */
+static BlockLink_t * prvFindSuitableBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    BlockLink_t * pxBlock;
+    BlockLink_t * pxNewBlockLink;
+    PRIVILEGED_DATA static BaseType_t xHeapHasBeenInitialised = pdFALSE;
+    void * pvReturn = NULL;
+    size_t xAdditionalRequiredSize;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the list of free blocks. */
+        if( xHeapHasBeenInitialised == pdFALSE )
+        {
+            prvHeapInit();
+            xHeapHasBeenInitialised = pdTRUE;
+        }
+
+        if( xWantedSize > 0 )
+        {
+            /* The wanted size must be increased so it can contain the block
+             * header in addition to the requested amount of bytes, rounded up
+             * to keep the next block aligned. */
+            xAdditionalRequiredSize = heapSTRUCT_SIZE + portBYTE_ALIGNMENT_MASK;
+
+            if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+            {
+                xWantedSize = ( xWantedSize + xAdditionalRequiredSize ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+                /* A free block must be able to hold its free list links. */
+                if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+                {
+                    xWantedSize = heapMINIMUM_BLOCK_SIZE;
+                }
+            }
+            else
+            {
+                xWantedSize = 0;
+            }
+        }
+
+        if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+        {
+            pxBlock = prvFindSuitableBlock( xWantedSize );
+
+            if( pxBlock != NULL )
+            {
+                /* If the block is larger than required it can be split into two,
+                 * the remainder goes back to the list of its size. */
+                if( ( heapBLOCK_SIZE( pxBlock ) - xWantedSize ) >= heapMINIMUM_BLOCK_SIZE )
+                {
+                    pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                    pxNewBlockLink->xBlockSize = ( heapBLOCK_SIZE( pxBlock ) - xWantedSize ) | heapBLOCK_FREE_BIT;
+                    pxNewBlockLink->pxPrevPhysicalBlock = pxBlock;
+                    pxBlock->xBlockSize = xWantedSize | ( pxBlock->xBlockSize & heapBLOCK_PREV_FREE_BIT );
+
+                    /* The block after the remainder already knows its previous
+                     * block is free, only its address changed. */
+                    heapNEXT_PHYSICAL_BLOCK( pxNewBlockLink )->pxPrevPhysicalBlock = pxNewBlockLink;
+                    prvInsertBlockIntoFreeList( pxNewBlockLink );
+                }
+                else
+                {
+                    heapNEXT_PHYSICAL_BLOCK( pxBlock )->xBlockSize &= ~heapBLOCK_PREV_FREE_BIT;
+                }
+
+                /* The block is being returned - it is allocated and owned by the
+                 * application. */
+                pxBlock->xBlockSize &= ~heapBLOCK_FREE_BIT;
+                xFreeBytesRemaining -= heapBLOCK_SIZE( pxBlock );
+
+                if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                }
+
+                xNumberOfSuccessfulAllocations++;
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapSTRUCT_SIZE );
+            }
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+    }
+    #endif
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    BlockLink_t * pxLink;
+    BlockLink_t * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have a block header immediately before
+         * it. */
+        puc -= heapSTRUCT_SIZE;
+
+        /* This unexpected casting is to keep some compilers from issuing
+         * byte alignment warnings. */
+        pxLink = ( void * ) puc;
+
+        configASSERT( heapBLOCK_IS_FREE( pxLink ) == 0 );
+        configASSERT( heapBLOCK_SIZE( pxLink ) >= heapMINIMUM_BLOCK_SIZE );
+
+        if( heapBLOCK_IS_FREE( pxLink ) == 0 )
+        {
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                ( void ) memset( puc + heapSTRUCT_SIZE, 0, heapBLOCK_SIZE( pxLink ) - heapSTRUCT_SIZE );
+            }
+            #endif
+
+            vTaskSuspendAll();
+            {
+                xFreeBytesRemaining += heapBLOCK_SIZE( pxLink );
+                xNumberOfSuccessfulFrees++;
+                traceFREE( pv, heapBLOCK_SIZE( pxLink ) );
+
+                /* Combine with the free block physically before this one.  Free
+                 * blocks are always combined, so that block's own previous block
+                 * is allocated. */
+                if( heapBLOCK_IS_PREV_FREE( pxLink ) != 0 )
+                {
+                    pxNeighbour = pxLink->pxPrevPhysicalBlock;
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxNeighbour->xBlockSize += heapBLOCK_SIZE( pxLink );
+                    pxLink = pxNeighbour;
+                }
+
+                /* Combine with the free block physically after this one. */
+                pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+
+                if( heapBLOCK_IS_FREE( pxNeighbour ) != 0 )
+                {
+                    prvRemoveBlockFromFreeList( pxNeighbour );
+                    pxLink->xBlockSize += heapBLOCK_SIZE( pxNeighbour );
+                }
+
+                pxLink->xBlockSize |= heapBLOCK_FREE_BIT;
+
+                pxNeighbour = heapNEXT_PHYSICAL_BLOCK( pxLink );
+                pxNeighbour->pxPrevPhysicalBlock = pxLink;
+                pxNeighbour->xBlockSize |= heapBLOCK_PREV_FREE_BIT;
+
+                prvInsertBlockIntoFreeList( pxLink );
+            }
+            ( void ) xTaskResumeAll();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    BlockLink_t * pxBlock;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    vTaskSuspendAll();
+    {
+        /* Not constant time, this walks every free block. */
+        for( uxFirstLevel = 0; uxFirstLevel < heapTLSF_FL_INDEX_COUNT; uxFirstLevel++ )
+        {
+            for( uxSecondLevel = 0; uxSecondLevel < heapTLSF_SL_INDEX_COUNT; uxSecondLevel++ )
+            {
+                for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                {
+                    xBlocks++;
+
+                    if( heapBLOCK_SIZE( pxBlock ) > xMaxSize )
+                    {
+                        xMaxSize = heapBLOCK_SIZE( pxBlock );
+                    }
+
+                    if( heapBLOCK_SIZE( pxBlock ) < xMinSize )
+                    {
+                        xMinSize = heapBLOCK_SIZE( pxBlock );
+                    }
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = ( xBlocks == 0 ) ? 0 : xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxMostSignificantBit;
+
+    if( xBlockSize < heapTLSF_SMALL_BLOCK_SIZE )
+    {
+        *puxFirstLevel = 0;
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize / portBYTE_ALIGNMENT );
+    }
+    else
+    {
+        uxMostSignificantBit = heapFLS( xBlockSize );
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> ( uxMostSignificantBit - heapTLSF_SL_INDEX_COUNT_LOG2 ) ) ^ heapTLSF_SL_INDEX_COUNT;
+        *puxFirstLevel = uxMostSignificantBit - ( heapTLSF_FL_INDEX_SHIFT - 1 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    prvMappingInsert( heapBLOCK_SIZE( pxBlockToInsert ), &uxFirstLevel, &uxSecondLevel );
+    configASSERT( uxFirstLevel < heapTLSF_FL_INDEX_COUNT );
+
+    pxBlockToInsert->pxPrevFreeBlock = NULL;
+    pxBlockToInsert->pxNextFreeBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+
+    if( pxBlockToInsert->pxNextFreeBlock != NULL )
+    {
+        pxBlockToInsert->pxNextFreeBlock->pxPrevFreeBlock = pxBlockToInsert;
+    }
+
+    pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlockToInsert;
+    ulFirstLevelBitmap |= ( 1UL << uxFirstLevel );
+    ulSecondLevelBitmap[ uxFirstLevel ] |= ( 1UL << uxSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlockFromFreeList( BlockLink_t * pxBlockToRemove ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+
+    prvMappingInsert( heapBLOCK_SIZE( pxBlockToRemove ), &uxFirstLevel, &uxSecondLevel );
+
+    if( pxBlockToRemove->pxNextFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxNextFreeBlock->pxPrevFreeBlock = pxBlockToRemove->pxPrevFreeBlock;
+    }
+
+    if( pxBlockToRemove->pxPrevFreeBlock != NULL )
+    {
+        pxBlockToRemove->pxPrevFreeBlock->pxNextFreeBlock = pxBlockToRemove->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was the head of its list. */
+        pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlockToRemove->pxNextFreeBlock;
+
+        if( pxBlockToRemove->pxNextFreeBlock == NULL )
+        {
+            ulSecondLevelBitmap[ uxFirstLevel ] &= ~( 1UL << uxSecondLevel );
+
+            if( ulSecondLevelBitmap[ uxFirstLevel ] == 0 )
+            {
+                ulFirstLevelBitmap &= ~( 1UL << uxFirstLevel );
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BlockLink_t * prvFindSuitableBlock( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+    uint32_t ulBitmap = 0;
+    BlockLink_t * pxBlock = NULL;
+    size_t xRoundedSize = xWantedSize;
+
+    /* Round the size up to the next list boundary, then any block of the list
+     * found is large enough and no list needs to be walked. */
+    if( xRoundedSize >= heapTLSF_SMALL_BLOCK_SIZE )
+    {
+        xRoundedSize += ( ( size_t ) 1 << ( heapFLS( xRoundedSize ) - heapTLSF_SL_INDEX_COUNT_LOG2 ) ) - 1U;
+    }
+
+    prvMappingInsert( xRoundedSize, &uxFirstLevel, &uxSecondLevel );
+
+    if( uxFirstLevel < heapTLSF_FL_INDEX_COUNT )
+    {
+        /* A non empty list of the same first level, or else of a larger one. */
+        ulBitmap = ulSecondLevelBitmap[ uxFirstLevel ] & ( ~0UL << uxSecondLevel );
+
+        if( ulBitmap == 0 )
+        {
+            ulBitmap = ulFirstLevelBitmap & ( ~0UL << ( uxFirstLevel + 1U ) );
+
+            if( ulBitmap != 0 )
+            {
+                uxFirstLevel = heapFFS( ulBitmap );
+                ulBitmap = ulSecondLevelBitmap[ uxFirstLevel ];
+            }
+        }
+    }
+
+    if( ulBitmap != 0 )
+    {
+        uxSecondLevel = heapFFS( ulBitmap );
+        pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+    }
+    else
+    {
+        /* Nothing in the larger lists.  The head of the list the size itself
+         * maps to may still be big enough, which matters most for the largest
+         * blocks of a small heap.  Only the head is checked to stay constant
+         * time. */
+        prvMappingInsert( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+
+        if( ( uxFirstLevel < heapTLSF_FL_INDEX_COUNT ) &&
+            ( pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] != NULL ) &&
+            ( heapBLOCK_SIZE( pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] ) >= xWantedSize ) )
+        {
+            pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+        }
+    }
+
+    if( pxBlock != NULL )
+    {
+        prvRemoveBlockFromFreeList( pxBlock );
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    BlockLink_t * pxFirstFreeBlock;
+    BlockLink_t * pxEndMarker;
+    uint8_t * pucAlignedHeap;
+    size_t xTotalHeapSize;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    pucAlignedHeap = ( uint8_t * ) ( ( ( portPOINTER_SIZE_TYPE ) & ucHeap[ portBYTE_ALIGNMENT - 1 ] ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) );
+    xTotalHeapSize = configADJUSTED_HEAP_SIZE & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space, less an allocated end marker header that stops the
+     * last block from being combined with the memory after the heap. */
+    pxFirstFreeBlock = ( BlockLink_t * ) pucAlignedHeap;
+    pxFirstFreeBlock->pxPrevPhysicalBlock = NULL;
+    pxFirstFreeBlock->xBlockSize = ( xTotalHeapSize - heapSTRUCT_SIZE ) | heapBLOCK_FREE_BIT;
+
+    pxEndMarker = heapNEXT_PHYSICAL_BLOCK( pxFirstFreeBlock );
+    pxEndMarker->pxPrevPhysicalBlock = pxFirstFreeBlock;
+    pxEndMarker->xBlockSize = heapBLOCK_PREV_FREE_BIT;
+
+    /* The first level lists must be able to hold the whole heap. */
+    configASSERT( heapFLS( heapBLOCK_SIZE( pxFirstFreeBlock ) ) <= configTLSF_FL_INDEX_MAX );
+
+    prvInsertBlockIntoFreeList( pxFirstFreeBlock );
+
+    xFreeBytesRemaining = heapBLOCK_SIZE( pxFirstFreeBlock );
+    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TLSF_HEAP */
@@ -0,0 +1,243 @@
+/*
+ * Wait-free ring of fixed size items from one producer to one consumer, see
+ * spsc_ring.h.
+ *
+ * The head and the tail count the items pushed and popped and wrap at 2^32,
+ * the ring holds head - tail items and an item is stored at its count modulo
+ * the length.  Using every slot needs no separate full flag, as a 32-bit count
+ * is far larger than any ring.
+ *
+ * The producer writes an item then stores the head, the consumer loads the
+ * head then reads the item, so the consumer never sees an item before it is
+ * written.  The same holds for a slot given back by storing the tail.
+ */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "atomic.h"
+#include "spsc_ring.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copies the item to the ring.  Returns pdFAIL if the ring is full, otherwise
+ * pdPASS with *pxTaskToNotify set to the consumer task if the ring was empty
+ * and to NULL if not.
+ */
+static BaseType_t prvPush( SpscRing_t * const pxRing,
+                           const void * const pvItem,
+                           TaskHandle_t * const pxTaskToNotify ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vSpscRingInitialise( SpscRing_t * const pxRing,
+                          void * const pvStorage,
+                          const size_t xItemSize,
+                          const uint32_t ulLength )
+{
+    configASSERT( pxRing != NULL );
+    configASSERT( pvStorage != NULL );
+    configASSERT( xItemSize > ( size_t ) 0 );
+
+    /* The slot of an item is its count masked by the length minus 1. */
+    configASSERT( ( ulLength != 0U ) && ( ( ulLength & ( ulLength - 1U ) ) == 0U ) );
+
+    pxRing->pucStorage = ( uint8_t * ) pvStorage;
+    pxRing->xItemSize = xItemSize;
+    pxRing->ulMask = ulLength - 1U;
+    pxRing->ulHead = 0U;
+    pxRing->ulTail = 0U;
+    pxRing->xConsumerTask = NULL;
+    pxRing->ulNotifyBits = 0U;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSpscRingPush( SpscRing_t * const pxRing,
+                          const void * const pvItem )
+{
+    TaskHandle_t xTaskToNotify;
+    BaseType_t xReturn;
+
+    xReturn = prvPush( pxRing, pvItem, &xTaskToNotify );
+
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    {
+        if( xTaskToNotify != NULL )
+        {
+            ( void ) xTaskNotify( xTaskToNotify, pxRing->ulNotifyBits, eSetBits );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSpscRingPushFromISR( SpscRing_t * const pxRing,
+                                 const void * const pvItem,
+                                 BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    TaskHandle_t xTaskToNotify;
+    BaseType_t xReturn;
+
+    xReturn = prvPush( pxRing, pvItem, &xTaskToNotify );
+
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    {
+        if( xTaskToNotify != NULL )
+        {
+            ( void ) xTaskNotifyFromISR( xTaskToNotify, pxRing->ulNotifyBits, eSetBits, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #else
+    {
+        ( void ) pxHigherPriorityTaskWoken;
+    }
+    #endif
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSpscRingPop( SpscRing_t * const pxRing,
+                         void * const pvItem )
+{
+    /* Only the consumer writes the tail, it can be read as is. */
+    const uint32_t ulTail = pxRing->ulTail;
+    BaseType_t xReturn;
+
+    if( Atomic_Load_u32( &( pxRing->ulHead ) ) == ulTail )
+    {
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        ( void ) memcpy( pvItem, &( pxRing->pucStorage[ ( size_t ) ( ulTail & pxRing->ulMask ) * pxRing->xItemSize ] ), pxRing->xItemSize );
+
+        /* The item is read out before its slot is given back. */
+        Atomic_Store_u32( &( pxRing->ulTail ), ulTail + 1U );
+        xReturn = pdPASS;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    void vSpscRingSetConsumer( SpscRing_t * const pxRing,
+                               const TaskHandle_t xConsumerTask,
+                               const uint32_t ulNotifyBits )
+    {
+        configASSERT( ( xConsumerTask == NULL ) || ( ulNotifyBits != 0U ) );
+
+        /* The producer reads the task then the bits, a producer that sees the
+         * new task also sees its bits. */
+        pxRing->ulNotifyBits = ulNotifyBits;
+        portMEMORY_BARRIER();
+        pxRing->xConsumerTask = xConsumerTask;
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+    BaseType_t xSpscRingReceive( SpscRing_t * const pxRing,
+                                 void * const pvItem,
+                                 TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn;
+
+        configASSERT( pxRing->xConsumerTask != NULL );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        for( ; ; )
+        {
+            /* Cleared before the ring is found empty, so the bits set by a push
+             * that comes after are kept and the wait below returns at once. */
+            ( void ) ulTaskNotifyValueClear( NULL, pxRing->ulNotifyBits );
+
+            if( xSpscRingPop( pxRing, pvItem ) != pdFAIL )
+            {
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                xReturn = pdFAIL;
+                break;
+            }
+
+            /* Woken by any notification, the loop checks the ring again. */
+            ( void ) xTaskNotifyWait( 0U, 0U, NULL, xTicksToWait );
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPush( SpscRing_t * const pxRing,
+                           const void * const pvItem,
+                           TaskHandle_t * const pxTaskToNotify )
+{
+    /* Only the producer writes the head, it can be read as is. */
+    const uint32_t ulHead = pxRing->ulHead;
+    BaseType_t xReturn;
+
+    *pxTaskToNotify = NULL;
+
+    if( ( ulHead - Atomic_Load_u32( &( pxRing->ulTail ) ) ) > pxRing->ulMask )
+    {
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        ( void ) memcpy( &( pxRing->pucStorage[ ( size_t ) ( ulHead & pxRing->ulMask ) * pxRing->xItemSize ] ), pvItem, pxRing->xItemSize );
+
+        /* The item is written before the consumer can see it. */
+        Atomic_Store_u32( &( pxRing->ulHead ), ulHead + 1U );
+
+        /* The producer stores the head then loads the tail, the consumer stores
+         * the tail then loads the head.  Either the consumer sees this item, or
+         * the producer sees that the consumer had taken every item before it
+         * and notifies, so a consumer that pops until the ring is empty before
+         * waiting is never left waiting with an item in the ring. */
+        if( Atomic_Load_u32( &( pxRing->ulTail ) ) == ulHead )
+        {
+            /* The bits are read after the task, see vSpscRingSetConsumer(). */
+            *pxTaskToNotify = pxRing->xConsumerTask;
+            portMEMORY_BARRIER();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = pdPASS;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,231 @@
+/*
+ * Hierarchical timing wheel of list items ordered by time, see timing_wheel.h.
+ *
+ * An item is in the level that covers the distance from the base time (the
+ * first time not handled yet) to the time it is due, in the slot of the bits
+ * of that time decoded by the level.  A slot of level L is handled at the
+ * first time from the base whose bits below the level are 0 and whose bits of
+ * the level are the slot, which is at or before the time of each of its items
+ * since they were less than a full turn of the level away when inserted.  Its
+ * items are then less than one slot of level L away and all move down.
+ *
+ * The functions are called with the scheduler suspended or from a critical
+ * section, as the delayed task lists are, or from the timer service task for
+ * the active timers.
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timing_wheel.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configUSE_TASK_TIMING_WHEEL == 1 ) || ( configUSE_TIMER_TIMING_WHEEL == 1 )
+
+#define timingwheelSLOT_MASK    ( timingwheelSLOTS_PER_LEVEL - ( UBaseType_t ) 1U )
+
+/* Bit of the first time of a slot of the level, and the slot of xTime in it. */
+#define timingwheelLEVEL_SHIFT( uxLevel )         ( ( uxLevel ) * ( UBaseType_t ) configTIMING_WHEEL_SLOT_BITS )
+#define timingwheelSLOT_OF( xTime, uxLevel )      ( ( UBaseType_t ) ( ( xTime ) >> timingwheelLEVEL_SHIFT( uxLevel ) ) & timingwheelSLOT_MASK )
+#define timingwheelSLOT( pxWheel, uxLevel, uxSlot ) \
+    ( &( ( pxWheel )->xSlots[ ( ( uxLevel ) * timingwheelSLOTS_PER_LEVEL ) + ( uxSlot ) ] ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Insert the item due at xExpiry, xBase is the first time not handled yet and
+ * xExpiry is at or after it.  Returns the time the item is next handled.
+ */
+static TickType_t prvInsert( TimingWheel_t * const pxWheel,
+                             ListItem_t * const pxListItem,
+                             const TickType_t xBase,
+                             const TickType_t xExpiry ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vTimingWheelInitialise( TimingWheel_t * const pxWheel )
+{
+    UBaseType_t uxIndex;
+
+    for( uxIndex = ( UBaseType_t ) 0U; uxIndex < timingwheelNUMBER_OF_SLOTS; uxIndex++ )
+    {
+        vListInitialise( &( pxWheel->xSlots[ uxIndex ] ) );
+    }
+
+    for( uxIndex = ( UBaseType_t ) 0U; uxIndex < timingwheelLEVELS; uxIndex++ )
+    {
+        pxWheel->uxOccupiedSlots[ uxIndex ] = ( UBaseType_t ) 0U;
+    }
+}
+/*-----------------------------------------------------------*/
+
+TickType_t xTimingWheelInsert( TimingWheel_t * const pxWheel,
+                               ListItem_t * const pxNewListItem,
+                               const TickType_t xTimeNow )
+{
+    const TickType_t xBase = xTimeNow + ( TickType_t ) 1;
+    TickType_t xExpiry = listGET_LIST_ITEM_VALUE( pxNewListItem );
+
+    /* The time now is already handled, the item is handled at the next one.
+     * Its value is kept, it is only due sooner than the wheel can tell. */
+    if( xExpiry == xTimeNow )
+    {
+        xExpiry = xBase;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return prvInsert( pxWheel, pxNewListItem, xBase, xExpiry );
+}
+/*-----------------------------------------------------------*/
+
+List_t * pxTimingWheelAdvance( TimingWheel_t * const pxWheel,
+                               const TickType_t xTime )
+{
+    UBaseType_t uxLevel, uxTopLevel = ( UBaseType_t ) 0U;
+    UBaseType_t uxSlot;
+    List_t * pxSlot;
+    ListItem_t * pxListItem;
+
+    /* Level L turns to its next slot when the bits of the levels below are
+     * all 0. */
+    while( ( uxTopLevel < ( timingwheelLEVELS - ( UBaseType_t ) 1U ) ) &&
+           ( timingwheelSLOT_OF( xTime, uxTopLevel ) == ( UBaseType_t ) 0U ) )
+    {
+        uxTopLevel++;
+    }
+
+    /* From the top, as the items of a level can move to the slot of a lower
+     * level that is handled now too. */
+    for( uxLevel = uxTopLevel; uxLevel > ( UBaseType_t ) 0U; uxLevel-- )
+    {
+        uxSlot = timingwheelSLOT_OF( xTime, uxLevel );
+
+        if( ( pxWheel->uxOccupiedSlots[ uxLevel ] & ( ( UBaseType_t ) 1U << uxSlot ) ) != ( UBaseType_t ) 0U )
+        {
+            pxSlot = timingwheelSLOT( pxWheel, uxLevel, uxSlot );
+
+            while( listLIST_IS_EMPTY( pxSlot ) == pdFALSE )
+            {
+                pxListItem = listGET_HEAD_ENTRY( pxSlot );
+                listREMOVE_ITEM( pxListItem );
+                ( void ) prvInsert( pxWheel, pxListItem, xTime, listGET_LIST_ITEM_VALUE( pxListItem ) );
+            }
+
+            pxWheel->uxOccupiedSlots[ uxLevel ] &= ~( ( UBaseType_t ) 1U << uxSlot );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return timingwheelSLOT( pxWheel, 0U, timingwheelSLOT_OF( xTime, 0U ) );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTimingWheelGetNextTime( TimingWheel_t * const pxWheel,
+                                    const TickType_t xTimeNow,
+                                    TickType_t * const pxNextTime )
+{
+    const TickType_t xBase = xTimeNow + ( TickType_t ) 1;
+    TickType_t xDistance, xShortestDistance = portMAX_DELAY;
+    TickType_t xLevelStart;
+    UBaseType_t uxLevel, uxOffset, uxFirstOffset, uxCurrentSlot, uxSlot;
+    BaseType_t xFound = pdFALSE;
+
+    for( uxLevel = ( UBaseType_t ) 0U; uxLevel < timingwheelLEVELS; uxLevel++ )
+    {
+        uxCurrentSlot = timingwheelSLOT_OF( xBase, uxLevel );
+        xLevelStart = ( xBase >> timingwheelLEVEL_SHIFT( uxLevel ) ) << timingwheelLEVEL_SHIFT( uxLevel );
+
+        /* The slot of the base time was handled when the level turned to it,
+         * unless the base time is its first time, the items there now are a
+         * full turn away and it comes last. */
+        uxFirstOffset = ( xLevelStart == xBase ) ? ( UBaseType_t ) 0U : ( UBaseType_t ) 1U;
+
+        /* A level turns less often than the one below it, once its next turn
+         * is not before the time found, no higher level comes earlier. */
+        if( ( xFound != pdFALSE ) &&
+            ( ( ( xLevelStart + ( ( TickType_t ) uxFirstOffset << timingwheelLEVEL_SHIFT( uxLevel ) ) ) - xBase ) >= xShortestDistance ) )
+        {
+            break;
+        }
+
+        /* The first occupied slot in the order the level handles them.  A slot
+         * of a higher level that holds items handles them before the slots
+         * further in the level, so the search stops at the first one. */
+        for( uxOffset = uxFirstOffset;
+             ( uxOffset < ( uxFirstOffset + timingwheelSLOTS_PER_LEVEL ) ) && ( pxWheel->uxOccupiedSlots[ uxLevel ] != ( UBaseType_t ) 0U );
+             uxOffset++ )
+        {
+            uxSlot = ( uxCurrentSlot + uxOffset ) & timingwheelSLOT_MASK;
+
+            if( ( pxWheel->uxOccupiedSlots[ uxLevel ] & ( ( UBaseType_t ) 1U << uxSlot ) ) == ( UBaseType_t ) 0U )
+            {
+                continue;
+            }
+
+            /* The occupied bits are left set when the owner takes the items
+             * out, they are cleared here. */
+            if( listLIST_IS_EMPTY( timingwheelSLOT( pxWheel, uxLevel, uxSlot ) ) != pdFALSE )
+            {
+                pxWheel->uxOccupiedSlots[ uxLevel ] &= ~( ( UBaseType_t ) 1U << uxSlot );
+                continue;
+            }
+
+            /* Modulo the tick count, a full turn of the top level is 0. */
+            xDistance = ( xLevelStart + ( ( TickType_t ) uxOffset << timingwheelLEVEL_SHIFT( uxLevel ) ) ) - xBase;
+
+            if( ( xFound == pdFALSE ) || ( xDistance < xShortestDistance ) )
+            {
+                xShortestDistance = xDistance;
+                xFound = pdTRUE;
+            }
+
+            break;
+        }
+    }
+
+    if( xFound != pdFALSE )
+    {
+        *pxNextTime = xBase + xShortestDistance;
+    }
+
+    return xFound;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvInsert( TimingWheel_t * const pxWheel,
+                             ListItem_t * const pxListItem,
+                             const TickType_t xBase,
+                             const TickType_t xExpiry )
+{
+    const TickType_t xDistance = xExpiry - xBase;
+    UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+    UBaseType_t uxSlot;
+
+    /* The lowest level whose turn covers the distance. */
+    while( ( uxLevel < ( timingwheelLEVELS - ( UBaseType_t ) 1U ) ) &&
+           ( ( xDistance >> timingwheelLEVEL_SHIFT( uxLevel + ( UBaseType_t ) 1U ) ) != ( TickType_t ) 0U ) )
+    {
+        uxLevel++;
+    }
+
+    uxSlot = timingwheelSLOT_OF( xExpiry, uxLevel );
+    listINSERT_END( timingwheelSLOT( pxWheel, uxLevel, uxSlot ), pxListItem );
+    pxWheel->uxOccupiedSlots[ uxLevel ] |= ( UBaseType_t ) 1U << uxSlot;
+
+    /* The first time of the slot, when the item moves down. */
+    return ( xExpiry >> timingwheelLEVEL_SHIFT( uxLevel ) ) << timingwheelLEVEL_SHIFT( uxLevel );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TASK_TIMING_WHEEL || configUSE_TIMER_TIMING_WHEEL */
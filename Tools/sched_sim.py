@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Compare fixed priority and earliest deadline first scheduling on random task sets.
+
+Models the two policies of Source/tasks.c on the host: fixed priority
+with deadline monotonic priorities (APP/SCHEDULE) and configUSE_EDF_SCHEDULING,
+where the ready tasks of configEDF_PRIORITY run in the order of the absolute
+deadline of their job, equal deadlines in release order. For every random task
+set the execution times are scaled up until a job misses its deadline, the
+utilisation reached at that point is the utilisation at first miss of the
+policy on that set.
+
+    python3 Tools/sched_sim.py --sets 500 --tasks 6 --deadline 0.8
+    python3 Tools/sched_sim.py --periods non-harmonic
+
+tests/test_edf.c runs the kernel itself on one non-harmonic set.
+
+The periods and deadlines are whole ticks, the execution times are not rounded.
+The tasks are released together, then periodically, and a whole hyperperiod is
+simulated, which covers the worst case of both policies for such sets.
+"""
+
+import argparse
+import random
+import sys
+
+# Periods in ticks (10 ms at configTICK_RATE_HZ 100). Most of the harmonic ones
+# divide each other, their hyperperiod is 2000 ticks. Few of the non-harmonic
+# ones do, their hyperperiod is 1260 ticks.
+PERIODS = {
+    'harmonic': (20, 25, 40, 50, 80, 100, 200, 250, 500),
+    'non-harmonic': (20, 28, 30, 45, 63, 70, 84, 90),
+}
+
+# Execution time left when a job is considered complete, absorbs the rounding
+EPSILON = 1e-9
+
+FIXED_PRIORITY = 'fixed priority (DM)'
+EDF = 'EDF'
+
+
+def uunifast(count, total, rng):
+    """Utilisations of count tasks adding up to total, uniformly distributed (Bini and Buttazzo)."""
+    shares = []
+    remaining = total
+    for index in range(1, count):
+        following = remaining * rng.random() ** (1.0 / (count - index))
+        shares.append(remaining - following)
+        remaining = following
+    shares.append(remaining)
+    return shares
+
+
+def lcm(a, b):
+    x, y = a, b
+    while y:
+        x, y = y, x % y
+    return a // x * b
+
+
+def random_task_set(count, deadline_ratio, periods, rng):
+    """(period, deadline, share) of each task, the shares add up to 1."""
+    tasks = []
+    for share in uunifast(count, 1.0, rng):
+        period = rng.choice(periods)
+        deadline = max(1, int(round(period * rng.uniform(deadline_ratio, 1.0))))
+        tasks.append((period, deadline, share))
+    return tasks
+
+
+def meets_deadlines(tasks, edf):
+    """Simulate one hyperperiod, tasks are (period, deadline, wcet) in ticks."""
+    hyperperiod = 1
+    for period, _, _ in tasks:
+        hyperperiod = lcm(hyperperiod, period)
+
+    # Deadline monotonic rank, the table order breaks the ties
+    rank = sorted(range(len(tasks)), key=lambda task: (tasks[task][1], task))
+    priority = [0] * len(tasks)
+    for level, task in enumerate(rank):
+        priority[task] = level
+
+    remaining = [0] * len(tasks)
+    deadline = [0] * len(tasks)
+    release = [0] * len(tasks)
+    now = 0
+    while now < hyperperiod:
+        for task, (period, relative_deadline, wcet) in enumerate(tasks):
+            if now % period == 0:
+                if remaining[task] > EPSILON:
+                    return False
+                remaining[task] = wcet
+                release[task] = now
+                deadline[task] = now + relative_deadline
+
+        ready = [task for task in range(len(tasks)) if remaining[task] > EPSILON]
+        next_release = min((now // period + 1) * period for period, _, _ in tasks)
+        if not ready:
+            now = next_release
+            continue
+
+        if edf:
+            running = min(ready, key=lambda task: (deadline[task], release[task]))
+        else:
+            running = min(ready, key=lambda task: priority[task])
+
+        # Runs until it completes or the next release may preempt it
+        step = min(remaining[running], next_release - now)
+        now += step
+        remaining[running] -= step
+        for task in ready:
+            if remaining[task] > EPSILON and now >= deadline[task]:
+                return False
+    return all(value <= EPSILON for value in remaining)
+
+
+def utilisation_at_first_miss(tasks, edf, resolution):
+    """Lowest scaled utilisation, in steps of resolution, at which a deadline is missed."""
+    steps = int(round(1.0 / resolution))
+    for step in range(1, 2 * steps + 1):
+        utilisation = step * resolution
+        scaled = [(period, deadline, share * utilisation * period) for period, deadline, share in tasks]
+        if not meets_deadlines(scaled, edf):
+            return utilisation
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n', 1)[0])
+    parser.add_argument('--sets', type=int, default=200, help='random task sets, default 200')
+    parser.add_argument('--tasks', type=int, default=6, help='tasks per set, default 6')
+    parser.add_argument('--deadline', type=float, default=1.0,
+                        help='shortest deadline as a fraction of the period, default 1 (implicit deadlines)')
+    parser.add_argument('--periods', choices=sorted(PERIODS), default='harmonic',
+                        help='periods the tasks draw from, default harmonic')
+    parser.add_argument('--resolution', type=float, default=0.01, help='utilisation step, default 0.01')
+    parser.add_argument('--seed', type=int, default=1, help='random seed, default 1')
+    options = parser.parse_args()
+
+    if options.tasks < 1 or options.sets < 1 or not 0.0 < options.deadline <= 1.0:
+        sys.exit('sched_sim: --tasks and --sets must be positive and --deadline in (0, 1]')
+
+    rng = random.Random(options.seed)
+    results = {FIXED_PRIORITY: [], EDF: []}
+    for _ in range(options.sets):
+        tasks = random_task_set(options.tasks, options.deadline, PERIODS[options.periods], rng)
+        results[FIXED_PRIORITY].append(utilisation_at_first_miss(tasks, False, options.resolution))
+        results[EDF].append(utilisation_at_first_miss(tasks, True, options.resolution))
+
+    print('%d sets of %d tasks, %s periods, deadlines %.0f%%..100%% of the period'
+          % (options.sets, options.tasks, options.periods, options.deadline * 100.0))
+    print('%-23s %8s %8s %8s %8s' % ('utilisation at 1st miss', 'min', 'median', 'mean', 'max'))
+    for policy in (FIXED_PRIORITY, EDF):
+        values = sorted(value for value in results[policy] if value is not None)
+        if not values:
+            print('%-23s %8s' % (policy, 'none'))
+            continue
+        print('%-23s %7.1f%% %7.1f%% %7.1f%% %7.1f%%'
+              % (policy, values[0] * 100.0, values[len(values) // 2] * 100.0,
+                 sum(values) / len(values) * 100.0, values[-1] * 100.0))
+    wins = sum(1 for fixed, edf in zip(results[FIXED_PRIORITY], results[EDF])
+               if fixed is not None and edf is not None and edf > fixed)
+    print('EDF reached a higher utilisation on %d of %d sets' % (wins, options.sets))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""Convert a scheduler trace recorder dump (APP/TRACE) into Chrome trace JSON.
+
+Save the g_TraceRecorder structure, or the whole RAM, from the debugger as a raw
+binary file (CCS: Memory Browser > Save Memory, "Raw Binary" format), then run
+
+    python3 Tools/trace_decode.py dump.bin -o trace.json
+
+and open trace.json in chrome://tracing or https://ui.perfetto.dev. Each task gets
+a track with its running slices, the queue and notification events are instant
+events on the track of the task (or the ISR track) that caused them, and every
+notification is linked by an arrow to the next time the notified task runs.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+# Layout of TraceRecorder_t in APP/TRACE/trace.h, little endian
+MAGIC = 0x31435254
+VERSION = 1
+HEADER = struct.Struct('<IHHHHII')
+TASK = struct.Struct('<I16s')
+RECORD = struct.Struct('<IIIB3x')
+
+TASK_SWITCHED_IN = 1
+TASK_CREATE = 2
+TASK_NOTIFY = 14
+TASK_NOTIFY_FROM_ISR = 15
+
+EVENT_NAMES = {
+    1: 'switched in',
+    2: 'task create',
+    3: 'task delete',
+    4: 'delay',
+    5: 'delay until',
+    6: 'queue send',
+    7: 'queue send failed',
+    8: 'queue send from ISR',
+    9: 'queue receive',
+    10: 'queue receive failed',
+    11: 'queue receive from ISR',
+    12: 'blocking on queue send',
+    13: 'blocking on queue receive',
+    14: 'notify',
+    15: 'notify from ISR',
+    16: 'blocking on notify',
+    17: 'notify received',
+}
+
+# Events that come from an ISR are drawn on their own track
+ISR_EVENTS = (8, 11, 15)
+# Events whose object is the task that made the call, drawn on its track even
+# before its first switch in (a task waiting on its notification at start up)
+OWN_TASK_EVENTS = (4, 5, 16, 17)
+ISR_TID = 0
+PID = 1
+
+
+def find_recorder(data):
+    """Offset of the recorder in the dump, the first aligned magic with a sane header."""
+    magic = struct.pack('<I', MAGIC)
+    offset = data.find(magic)
+    while offset >= 0:
+        if offset % 4 == 0 and offset + HEADER.size <= len(data):
+            _, version, record_size, record_count, task_count, _, _ = HEADER.unpack_from(data, offset)
+            size = HEADER.size + task_count * TASK.size + record_count * record_size
+            if version == VERSION and record_size == RECORD.size and offset + size <= len(data):
+                return offset
+        offset = data.find(magic, offset + 1)
+    raise ValueError('no trace recorder (version %d) found in the dump' % VERSION)
+
+
+def read_recorder(data):
+    """Task names by address and the records from the oldest to the newest."""
+    offset = find_recorder(data)
+    _, _, _, record_count, task_count, head, _ = HEADER.unpack_from(data, offset)
+    offset += HEADER.size
+
+    names = {}
+    for _ in range(task_count):
+        task, name = TASK.unpack_from(data, offset)
+        offset += TASK.size
+        if task != 0:
+            names[task] = name.split(b'\0', 1)[0].decode('ascii', 'replace')
+
+    records = [RECORD.unpack_from(data, offset + index * RECORD.size) for index in range(record_count)]
+    if head <= record_count:
+        records = records[:head]
+    else:
+        oldest = head % record_count
+        records = records[oldest:] + records[:oldest]
+    lost = max(0, head - record_count)
+    return names, records, lost
+
+
+def unwrap(records):
+    """Timestamps in us from the first record, the recorded low 32 bits wrap every ~71 minutes."""
+    result = []
+    previous = None
+    base = 0
+    for timestamp, obj, value, event in records:
+        if previous is not None and timestamp < previous:
+            base += 1 << 32
+        previous = timestamp
+        result.append((base + timestamp, obj, value, event))
+    if result:
+        start = result[0][0]
+        result = [(ts - start, obj, value, event) for ts, obj, value, event in result]
+    return result
+
+
+def decode(names, records):
+    """Chrome trace event list."""
+    tids = {}
+    events = [{'ph': 'M', 'pid': PID, 'name': 'process_name', 'args': {'name': 'FreeRTOS'}},
+              {'ph': 'M', 'pid': PID, 'tid': ISR_TID, 'name': 'thread_name', 'args': {'name': 'ISR'}}]
+
+    def task_name(task):
+        return names.get(task, '0x%08x' % task)
+
+    def tid_of(task):
+        if task not in tids:
+            tids[task] = len(tids) + 1
+            events.append({'ph': 'M', 'pid': PID, 'tid': tids[task], 'name': 'thread_name',
+                           'args': {'name': task_name(task)}})
+        return tids[task]
+
+    running = None
+    running_since = 0
+    pending_flows = {}
+    flow_id = 0
+
+    for ts, obj, value, event in records:
+        if event == TASK_SWITCHED_IN:
+            if running is not None:
+                events.append({'ph': 'X', 'pid': PID, 'tid': tid_of(running), 'name': task_name(running),
+                               'cat': 'sched', 'ts': running_since, 'dur': ts - running_since})
+            running = obj
+            running_since = ts
+            for flow in pending_flows.pop(obj, []):
+                events.append({'ph': 'f', 'bp': 'e', 'pid': PID, 'tid': tid_of(obj), 'name': 'notify',
+                               'cat': 'notify', 'id': flow, 'ts': ts})
+            continue
+
+        name = EVENT_NAMES.get(event, 'event %d' % event)
+        if event in ISR_EVENTS:
+            tid = ISR_TID
+        elif event in OWN_TASK_EVENTS:
+            tid = tid_of(obj)
+        elif running is not None:
+            tid = tid_of(running)
+        else:
+            tid = ISR_TID
+        args = {'object': '0x%08x' % obj, 'value': value}
+        if event in (TASK_CREATE, TASK_NOTIFY, TASK_NOTIFY_FROM_ISR) or obj in names:
+            args['task'] = task_name(obj)
+        events.append({'ph': 'i', 's': 't', 'pid': PID, 'tid': tid, 'name': name, 'cat': 'kernel',
+                       'ts': ts, 'args': args})
+
+        if event in (TASK_NOTIFY, TASK_NOTIFY_FROM_ISR):
+            flow_id += 1
+            pending_flows.setdefault(obj, []).append(flow_id)
+            events.append({'ph': 's', 'pid': PID, 'tid': tid, 'name': 'notify', 'cat': 'notify',
+                           'id': flow_id, 'ts': ts})
+
+    if running is not None and records:
+        end = records[-1][0]
+        events.append({'ph': 'X', 'pid': PID, 'tid': tid_of(running), 'name': task_name(running),
+                       'cat': 'sched', 'ts': running_since, 'dur': end - running_since})
+    return events
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n', 1)[0])
+    parser.add_argument('dump', help='raw binary dump of g_TraceRecorder or of the RAM holding it')
+    parser.add_argument('-o', '--output', help='JSON output file, standard output if omitted')
+    options = parser.parse_args()
+
+    with open(options.dump, 'rb') as dump:
+        data = dump.read()
+    try:
+        names, records, lost = read_recorder(data)
+    except ValueError as error:
+        sys.exit('%s: %s' % (options.dump, error))
+
+    records = unwrap(records)
+    trace = {'traceEvents': decode(names, records), 'displayTimeUnit': 'ms'}
+    if options.output:
+        with open(options.output, 'w') as output:
+            json.dump(trace, output)
+    else:
+        json.dump(trace, sys.stdout)
+        sys.stdout.write('\n')
+
+    span = records[-1][0] if records else 0
+    sys.stderr.write('%d records over %.3f ms, %d older records overwritten\n' % (len(records), span / 1000.0, lost))
+
+
+if __name__ == '__main__':
+    main()
@@ -1,889 +1,781 @@
-/* Kernel includes. */
-#include "FreeRTOS.h"
-#include "task.h"
-#include "event_groups.h"
-#include "semphr.h"
-
-/* MCAL includes. */
-#include "uart0.h"
-#include "MCAL/ADC/adc.h"
-#include "MCAL/Temperatrue Sensor/lm35.h"
-#include "gpio.h"
-#include "tm4c123gh6pm_registers.h"
-#include "GPTM.h"
-/* Other includes */
-#include <stdlib.h>
-
-/* Delay function*/
-#define NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND 369
-void Delay_MS(unsigned long long n)
-{
-    volatile unsigned long long count = 0;
-    while(count++ < (NUMBER_OF_ITERATIONS_PER_ONE_MILI_SECOND * n) );
-}
-
-/* Definitions for the event bits in the event group. */
-#define mainSW2_INTERRUPT_BIT ( 1UL << 0UL )  /* Event bit 0, which is set by a SW2 Interrupt. */
-#define mainSW1_INTERRUPT_BIT ( 1UL << 1UL )  /* Event bit 1, which is set by a SW1 Interrupt. */
-
-#define Button_Control_Task_BIT ( 1UL << 0UL )          /* Event bit 0, which is set by ButtonControlTask for heat Control task. */
-#define Temperature_Sensing_Task_BIT ( 1UL << 1UL )     /* Event bit 1, which is set by Temperature Sensing Task for heat control task. */
-
-
-#define Button_Measure_Task_BIT ( 1UL << 0UL )
-#define Temperature_Sensing_Measure_Task_BIT ( 1UL << 1UL )
-#define LED_Measure_Task_BIT ( 1UL << 2UL )
-#define Heat_Measure_Task_BIT ( 1UL << 3UL )
-#define Display_Measure_Task_BIT ( 1UL << 4UL )
-#define Diganostics_Measure_Task_BIT ( 1UL << 5UL )
-
-#define Desired_Change_Display ( 1UL << 0UL )
-#define Current_Change_Display ( 1UL << 1UL )
-
-/*Task handles*/
-TaskHandle_t xvButtonControlTask;
-TaskHandle_t xvTemperatureSensingTask;
-TaskHandle_t xvHeatingControlTask;
-TaskHandle_t xvLedControlTask;
-TaskHandle_t xvDisplay;
-TaskHandle_t xvDiagnosticsTask;
-TaskHandle_t xvRunTimeMeasurementsTask;
-
-/*Event Groups*/
-EventGroupHandle_t xEventGroupForButtons;              /*Two bits are set from ISR which unblocks Button task*/
-EventGroupHandle_t xEventGroupForHeatingControlTask;   /*two bits are set, first from Button control and the other from Temp sensing*/
-EventGroupHandle_t xEventGroupForDisplayTask;          /*two bits are set from Button control and sensing temp to unblock display task indicating for change */
-EventGroupHandle_t xEventGroupForMeasurementTask;      /*bits are set from button task,sensing,heater, display,Led, Diagnostic to unblock Measurment task*/
-
-
-/*Mutex and sempahores*/
-xSemaphoreHandle xMutexPassengerControl;       /*Used by button control for passenger*/
-xSemaphoreHandle xMutexDriverControl;          /*Used by button control for passenger*/
-
-xSemaphoreHandle xMutexPassengerSensingTemperature; /*Used by Sensing Task for passenger*/
-xSemaphoreHandle xMutexDriverSensingTemperature;    /*Used by Sensing Task for Driver*/
-
-xSemaphoreHandle xMutexDriverControlSeatTemperature;    /*Used by Control Task for Driver*/
-xSemaphoreHandle xMutexPassengerControlSeatTemperature; /*Used by Control Task for Passenger*/
-
-xSemaphoreHandle xLeds;         /*Used by led task to unblock */
-
-xSemaphoreHandle xDiagnostic;   /*Used by heater control task to unblock */
-xSemaphoreHandle xTempToDig;    /*Used by Diagnostic task to unblock */
-
-/* shared resources*/
-typedef enum {Off,Low=25,Medium=30,High=35}Desierd_Heating_Levels;  /*Range of each level*/
-typedef enum {Offheat,Lowheat,Mediumheat,Highheat}Heater_Levels;    /*the heater output level based on desired*/
-
-uint32_t Passenger_Seat_Button_Interrupt_Flag=Off; /*Global Variable for the Passenger seat Button to be used by the interrupt*/
-uint32_t Driver_Seat_Button_Interrupt_Flag=Off;    /*Global Variable for the Driver seat Button to be used by the interrupt*/
-
-uint32_t Passenger_Current_Temperature=0;          /*Global Variable for the Passenger LM35(Temp sensor) Value*/
-uint32_t Driver_Current_Temperature=0;             /*Global Variable for the Driver LM35(Temp sensor) Value*/
-
-uint32_t Driver_Heater=Offheat;                    /*Global Variable for the Driver heater Value (default OFF)*/
-uint32_t Passenger_Heater=Offheat;                 /*Global Variable for the Passenger heater Value (default OFF)*/
-
-/*Global variable to calc and check execution time for each task*/
-uint32_t ButtonControlTaskExecutiontime=0;
-uint32_t SensingTempTaskExecutiontime=0;
-uint32_t DisplayTaskExecutiontime=0;
-uint32_t HeatingControlTaskExecutiontime=0;
-uint32_t LedControlTaskExecutiontime=0;
-uint32_t DiganosticsControlTaskExecutiontime=0;
-uint32_t ButtonTotalTime=0;
-uint32_t TempsenseTotalTime=0;
-uint32_t HeatControlTotalTime=0;
-uint32_t DisplayTotalTime=0;
-uint32_t LedControlTotalTime=0;
-uint32_t DiagnosticsTotalTime=0;
-
-/* The HW setup function */
-static void prvSetupHardware( void );
-
-/* FreeRTOS tasks */
-void vButtonControlTask(void *pvParameters);         /*Unblock by Port F Handler*/
-void vTemperatureSensingTask(void *pvParameters);    /*Used to Measure the LM-35 Temp is global variables*/
-void vHeatingControlTask(void *pvParameters);        /*Used to determine Heater level based on Temp. Sensing Task*/
-void vLedControlTask(void *pvParameters);            /*Control Led OutPut*/
-void vDisplayTask (void *pvParameters);              /*Display UART */
-void vDiagnosticsTask (void *pvParameters);          /*Task used to assure range of heater from 5 to 40*/
-void vRunTimeMeasurementsTask(void *pvParameters);   /*Measure runtimr for each task and cpu load*/
-
-/* Define the strings that will be passed in as the task parameters. */
-
-
-int main()
- {
-    /* Setup the hardware for use with the Tiva C board. */
-    prvSetupHardware();
-
-    /*Creating Mutex and Sempahores*/
-    xMutexPassengerControl = xSemaphoreCreateMutex();
-    xMutexDriverControl = xSemaphoreCreateMutex();
-
-    xMutexPassengerSensingTemperature = xSemaphoreCreateMutex();
-    xMutexDriverSensingTemperature = xSemaphoreCreateMutex();
-
-    xMutexDriverControlSeatTemperature = xSemaphoreCreateMutex();
-    xMutexPassengerControlSeatTemperature = xSemaphoreCreateMutex();
-
-
-    xLeds = xSemaphoreCreateBinary();
-
-    xDiagnostic = xSemaphoreCreateBinary();
-
-    xTempToDig= xSemaphoreCreateBinary();
-
-    /* Creating Event Groups */
-    xEventGroupForButtons = xEventGroupCreate();            /*Event for Button Task*/
-    xEventGroupForHeatingControlTask= xEventGroupCreate();  /*Event for Heater Task*/
-    xEventGroupForDisplayTask = xEventGroupCreate();        /*Event for Display Task*/
-    xEventGroupForMeasurementTask = xEventGroupCreate();    /*Event for Measurement Task*/
-
-
-    /* Create Tasks here */
-    /*
-     * Functionality:  Monitors button inputs to cycle through the heater states(Off,Low,Medium,High)
-     * Implementation: 1- Using GPIO to read Interrupts on the Button Clicks
-     *                 2- When button is pressed, the heating level should advance from Off-->Low-->Medium-->High-->Low
-     *                 3- Set the heating level using global shared variables
-     *                 (Passenger_Seat_Button_Interrupt_Flag,Driver_Seat_Button_Interrupt_Flag) which is protected using
-     *                 (xMutexPassengerControl,xMutexDriverControl)
-     * Interaction with Other Tasks:
-     *                 1-The Heating Control Task will read the updated heating level from the shared variable
-     *                  (Passenger_Seat_Button_Interrupt_Flag,Driver_Seat_Button_Interrupt_Flag)
-     *                 2-The Display Update Task will display the updated level on the shared screen
-     */
-    xTaskCreate(vButtonControlTask,         /* Pointer to the function that implements the task. */
-                "Task for button control",  /* Text name for the task.  This is to facilitate debugging only. */
-                256,                        /* Stack depth - most small microcontrollers will use much less stack than this. */
-                NULL,                       /* We are not passing a task parameter in this example. */
-                3,                          /* This task will run at priority 4. */
-                &xvButtonControlTask);                      /* We are not using the task handle. */
-
-    /*Temperature sensing task
-     * Functionality: 1-Reads temperature from the sensor (or potentiometer for testing purposes) and maps the analog value to a valid temperature range (5C to 40C).
-                      2-This task continuously monitors temperature changes.
-     * Implementation: 1-Use *ADC* to read the analog voltage from the sensor or potentiometer.
-                       2-Convert the ADC value to temperature using a formula.
-                       3-Store the current temperature in xMutexPassengerSensingTemperature and xMutexDriverSensingTemperature.
-     *Interaction with Other Tasks:
-     *                 1-The Heating Control Task reads the current temperature from this task.
-     *                 2-The Diagnostic Task will check if the temperature is within the valid range and act accordingly.
-     * */
-    xTaskCreate(vTemperatureSensingTask,             /* Pointer to the function that implements the task. */
-                "Task for Temperature sensing",      /* Text name for the task.  This is to facilitate debugging only. */
-                256,                                 /* Stack depth - most small microcontrollers will use much less stack than this. */
-                NULL,                                /* We are not passing a task parameter in this example. */
-                3,                                   /* This task will run at priority 3. */
-                &xvTemperatureSensingTask);
-    /*Heating control Task*/
-    xTaskCreate(vHeatingControlTask,                 /* Pointer to the function that implements the task. */
-                "Task for Heating Control",              /* Text name for the task.  This is to facilitate debugging only. */
-                256,                                     /* Stack depth - most small microcontrollers will use much less stack than this. */
-                NULL,                                    /* We are not passing a task parameter in this example. */
-                4,                                       /* This task will run at priority 2. */
-                &xvHeatingControlTask);
-    xTaskCreate(vLedControlTask,                 /* Pointer to the function that implements the task. */
-                "Task for LED Control",              /* Text name for the task.  This is to facilitate debugging only. */
-                256,                                     /* Stack depth - most small microcontrollers will use much less stack than this. */
-                NULL,                                    /* We are not passing a task parameter in this example. */
-                2,                                       /* This task will run at priority 2. */
-                &xvLedControlTask);
-
-    xTaskCreate(vDisplayTask,                 /* Pointer to the function that implements the task. */
-                   "DisplayTask",              /* Text name for the task.  This is to facilitate debugging only. */
-                   256,                                     /* Stack depth - most small microcontrollers will use much less stack than this. */
-                   NULL,                                    /* We are not passing a task parameter in this example. */
-                   1,                                       /* This task will run at priority 2. */
-                   &xvDisplay);
-    xTaskCreate(vDiagnosticsTask,                 /* Pointer to the function that implements the task. */
-                "DiagnosticsTask",              /* Text name for the task.  This is to facilitate debugging only. */
-                256,                                     /* Stack depth - most small microcontrollers will use much less stack than this. */
-                NULL,                                    /* We are not passing a task parameter in this example. */
-                5,                                       /* This task will run at priority 2. */
-                &xvDiagnosticsTask);
-    xTaskCreate(vRunTimeMeasurementsTask,                 /* Pointer to the function that implements the task. */
-                    "xvRunTimeMeasurementsTask",              /* Text name for the task.  This is to facilitate debugging only. */
-                    256,                                     /* Stack depth - most small microcontrollers will use much less stack than this. */
-                    NULL,                                    /* We are not passing a task parameter in this example. */
-                    6,                                       /* This task will run at priority 2. */
-                    &xvRunTimeMeasurementsTask);
-
-   // UART0_SendString("Main \r\n");
-
-    /* Now all the tasks have been started - start the scheduler.
-
-    NOTE : Tasks run in system mode and the scheduler runs in Supervisor mode.
-    The processor MUST be in supervisor mode when vTaskStartScheduler is
-    called.  The demo applications included in the FreeRTOS.org download switch
-    to supervisor mode prior to main being called.  If you are not using one of
-    these demo application projects then ensure Supervisor mode is used here. */
-    vTaskStartScheduler();
-
-    /* Should never reach here!  If you do then there was not enough heap
-    available for the idle task to be created. */
-    for (;;);
-
-}
-
-
-static void prvSetupHardware( void )
-{
-    /* Place here any needed HW initialization such as GPIO, UART, etc.  */
-    UART0_Init();
-    ADC_Init();
-    GPIO_BuiltinButtonsLedsInit();
-    GPIO_SW1EdgeTriggeredInterruptInit();
-    GPIO_SW2EdgeTriggeredInterruptInit();
-    GPTM_WTimer0Init();
-}
-void vButtonControlTask(void *pvParameters)
-{
-
-    uint32 GPTM1,GPTM2;
-    GPTM1=GPTM_WTimer0Read();
-    EventBits_t xEventGroupValue;
-
-    const EventBits_t xBitsToWaitFor = ( mainSW1_INTERRUPT_BIT | mainSW2_INTERRUPT_BIT);
-
-   // UART0_SendString("entered Buttom control task \r\n");
-    for (;;)
-    {
-        /* Block to wait for event bits to become set within the event group. */
-        xEventGroupValue = xEventGroupWaitBits( xEventGroupForButtons,    /* The event group to read. */
-                                                xBitsToWaitFor, /* Bits to test. */
-                                                pdTRUE,         /* Clear bits on exit if the unblock condition is met. */
-                                                pdFALSE,        /* Don't wait for all bits. */
-                                                portMAX_DELAY); /* Don't time out. */
-       // UART0_SendString(" Buttom control task - after event group \r\n");
-
-        /* In case PF0 edge triggered interrupt occurred, it will set event 0 bit */
-        if ((xEventGroupValue & mainSW2_INTERRUPT_BIT) != 0)
-        {
-            /* Acquire the Passenger mutex */
-            if (xSemaphoreTake(xMutexPassengerControl, portMAX_DELAY) == pdTRUE)
-            {
-                //UART0_SendString(" Buttom control task - xMutexPassengerControl true  \r\n");
-               // Delay_MS(60);
-               /// vTaskDelay(pdMS_TO_TICKS(100));
-
-            /* Access the Passenger Shared Button resource */
-                if(Passenger_Seat_Button_Interrupt_Flag==Off)
-                    {
-                    Passenger_Seat_Button_Interrupt_Flag=Low;
-                    //UART0_SendString(" Buttom control task - passenger heater low  \r\n");
-                    //Delay_MS(60);
-                    //vTaskDelay(pdMS_TO_TICKS(100));
-                    }
-                else if(Passenger_Seat_Button_Interrupt_Flag==Low)
-                    {
-                    Passenger_Seat_Button_Interrupt_Flag=Medium;
-                    //UART0_SendString(" Buttom control task - passenger heater Medium  \r\n");
-                  //  Delay_MS(60);
-                   // vTaskDelay(pdMS_TO_TICKS(100));
-
-                    }
-                else if(Passenger_Seat_Button_Interrupt_Flag==Medium)
-                    {
-                    Passenger_Seat_Button_Interrupt_Flag=High;
-                   // UART0_SendString(" Buttom control task - passenger heater high  \r\n");
-                    //Delay_MS(60);
-                    //vTaskDelay(pdMS_TO_TICKS(100));
-
-                    }
-                else if(Passenger_Seat_Button_Interrupt_Flag==High)
-                    {
-                    Passenger_Seat_Button_Interrupt_Flag=Off;
-                   // UART0_SendString(" Buttom control task - passenger heater off  \r\n");
-                    //Delay_MS(60);
-                    //vTaskDelay(pdMS_TO_TICKS(100));
-                    }
-            /* Release the Passenger mutex */
-            xSemaphoreGive(xMutexPassengerControl);
-            }
-        }
-        /* In case PF4 edge triggered interrupt occurred, it will set event 1 bit */
-        if ((xEventGroupValue & mainSW1_INTERRUPT_BIT) != 0)
-        {
-           if (xSemaphoreTake(xMutexDriverControl, portMAX_DELAY) == pdTRUE)
-           {
-              // UART0_SendString(" Buttom control task - xMutexDriverControl true  \r\n");
-                   //vTaskDelay(pdMS_TO_TICKS(100));
-            /* Access the Driver Shared Button resource */
-                if(Driver_Seat_Button_Interrupt_Flag==Off)
-                   {
-                    Driver_Seat_Button_Interrupt_Flag=Low;
-                   // UART0_SendString(" Buttom control task - driver heater low  \r\n");
-                    //Delay_MS(60);
-                    //vTaskDelay(pdMS_TO_TICKS(100));
-
-                   }
-                else if(Driver_Seat_Button_Interrupt_Flag==Low)
-                   {
-                    Driver_Seat_Button_Interrupt_Flag=Medium;
-                   // UART0_SendString(" Buttom control task - driver medium   \r\n");
-                   // Delay_MS(60);
-                   // vTaskDelay(pdMS_TO_TICKS(100));
-
-                   }
-                else if(Driver_Seat_Button_Interrupt_Flag==Medium)
-                   {
-                    Driver_Seat_Button_Interrupt_Flag=High;
-                   // UART0_SendString(" Buttom control task - driver high  \r\n");
-                    // Delay_MS(60);
-                    //vTaskDelay(pdMS_TO_TICKS(100));
-
-                   }
-                else if(Driver_Seat_Button_Interrupt_Flag==High)
-                   {
-                    Driver_Seat_Button_Interrupt_Flag=Off;
-                   // UART0_SendString(" Buttom control task - driver off  \r\n");
-                     //Delay_MS(60);
-                    //vTaskDelay(pdMS_TO_TICKS(100));
-
-                   }
-             /* Release the Driver mutex */
-              xSemaphoreGive(xMutexDriverControl);
-            }
-        }
-        xEventGroupSetBits(xEventGroupForHeatingControlTask, Button_Control_Task_BIT);/*Setting the bit for Heating control task to start working*/
-        xEventGroupSetBits(xEventGroupForDisplayTask ,Desired_Change_Display );/*Setting the bit for Heating control task to start working*/
-        xEventGroupSetBits(xEventGroupForMeasurementTask,Button_Measure_Task_BIT );
-       GPTM2=GPTM_WTimer0Read();
-       ButtonControlTaskExecutiontime=(GPTM2-GPTM1)*10;
-       ButtonTotalTime=GPTM_WTimer0Read()*10;
-       vTaskDelay(pdMS_TO_TICKS(500));
-    }
-}
-
-
-void vTemperatureSensingTask(void *pvParameters)
-{
-    uint32 GPTM1,GPTM2;
-    GPTM1=GPTM_WTimer0Read();
-    TickType_t xLastWakeTime = xTaskGetTickCount(); /*Getting the current time to start counting from their*/
-        for (;;)
-        {
-          //  UART0_SendString("vTemperatureSensingTask\r\n:");
-
-            /*Getting both mutex to make sure we update the temperature values at the same time  */
-            if ((xSemaphoreTake(xMutexPassengerSensingTemperature, portMAX_DELAY) == pdTRUE) )
-              {
-                            //UART0_SendString("passenger temp is:");/*PE3 - PASSENGER*/
-                       Passenger_Current_Temperature=LM35_getTemperature(SENSOR0_CHANNEL_ID);/*calculating temperature on passenger sensor*/
-                            //UART0_SendInteger(Passenger_Current_Temperature);
-                           // UART0_SendString("\r\n");
-              }
-
-            if ( (xSemaphoreTake(xMutexDriverSensingTemperature, portMAX_DELAY)) == pdTRUE  )
-            {
-                    Driver_Current_Temperature=LM35_getTemperature(SENSOR1_CHANNEL_ID);   /*calculating temperature on driver sensor*/
-                              // UART0_SendString(" Driver temp is:"); /*PE2 - DRIVER*/
-
-                               //UART0_SendInteger(Driver_Current_Temperature);
-                               //UART0_SendString("\r\n");
-            }
-
-
-             /*release The Driver and Passenger Temp Mutexes*/
-            xSemaphoreGive(xMutexPassengerSensingTemperature);
-            xSemaphoreGive(xMutexDriverSensingTemperature);
-            xEventGroupSetBits(xEventGroupForHeatingControlTask, Temperature_Sensing_Task_BIT);/*Setting the bit for Heating control task to start working*/
-
-            xEventGroupSetBits(xEventGroupForDisplayTask ,Current_Change_Display );/*Setting the bit for D task to start working*/
-
-            xSemaphoreGive(xTempToDig);
-            xEventGroupSetBits(xEventGroupForMeasurementTask, Temperature_Sensing_Measure_Task_BIT );
-
-
-
-            GPTM2=GPTM_WTimer0Read();
-            SensingTempTaskExecutiontime=(GPTM2-GPTM1)*10;
-            TempsenseTotalTime=GPTM_WTimer0Read();
-
-            /*blocking the function for 1 second*/
-            vTaskDelay(pdMS_TO_TICKS(500));
-
-
-        }
-}
-
-
-
-void vHeatingControlTask(void *pvParameters)
-{
-    uint32 GPTM1,GPTM2;
-    GPTM1=GPTM_WTimer0Read();
-    EventBits_t xEventGroupValue;
-    const EventBits_t xBitsToWaitFor = (Button_Control_Task_BIT | Temperature_Sensing_Task_BIT );
-    char DriverTemperatureDifference=0;
-    char PassengerTemperatureDifference=0;
-    for (;;)
-    {
-    if((xSemaphoreTake(xDiagnostic, portMAX_DELAY) == pdTRUE) )
-    {
-            //UART0_SendString("HeatingControlTask before \r\n");
-
-            /* Block to wait for event bits to become set within the event group. */
-            xEventGroupValue = xEventGroupWaitBits( xEventGroupForHeatingControlTask,    /* The event group to read. */
-                                                    xBitsToWaitFor,                      /* Bits to test. */
-                                                    pdTRUE,                              /* Clear bits on exit if the unblock condition is met. */
-                                                    pdFALSE,                             /* Don't Wait for all bits. */
-                                                    portMAX_DELAY);                      /* Don't time out. */
-
-     if ((xSemaphoreTake(xMutexDriverControlSeatTemperature, portMAX_DELAY) == pdTRUE) && (xSemaphoreTake(xMutexDriverControl, portMAX_DELAY) == pdTRUE)   )
-     {
-         //DriverTemperatureDifference=Driver_Seat_Button_Interrupt_Flag - Driver_Current_Temperature ;
-
-       //  UART0_SendString("semaphore Driver TRUE\r\n");
-       if( Driver_Seat_Button_Interrupt_Flag==Off)
-           {
-                  // UART0_SendString("DDRIVER SEAT OFF\r\n");
-                   Driver_Heater=Offheat;
-
-           }
-       else if ( Driver_Seat_Button_Interrupt_Flag != Off)
-           {
-               DriverTemperatureDifference=Driver_Seat_Button_Interrupt_Flag - Driver_Current_Temperature ;
-               if(Driver_Seat_Button_Interrupt_Flag >Driver_Current_Temperature)
-               {
-                  // UART0_SendString("DriverTemperatureDifference>0 \r\n");
-                   if(DriverTemperatureDifference>=10)
-                       {
-                           Driver_Heater=Highheat;
-                          // UART0_SendString("Driver is high \r\n");
-
-                       }
-
-                   else if((DriverTemperatureDifference>=5) && (DriverTemperatureDifference<10))
-                       {
-                           Driver_Heater=Mediumheat;
-                          // UART0_SendString("Driver is medium \r\n");
-
-                       }
-
-                   else if((DriverTemperatureDifference>=2) && (DriverTemperatureDifference<5))
-                       {
-                          // UART0_SendString("Driver is low \r\n");
-                           Driver_Heater=Lowheat;
-
-                       }
-
-                   else
-                       {
-                           Driver_Heater=Offheat;
-                           //UART0_SendString(" DriverTemperatureDifference =OFF \r\n");
-
-                       }
-               }
-
-               else
-               {
-                   Driver_Heater=Offheat;
-               }
-
-           }
-
-     }
-
-     if ( (xSemaphoreTake(xMutexPassengerControlSeatTemperature, portMAX_DELAY) == pdTRUE)&& (xSemaphoreTake(xMutexPassengerControl, portMAX_DELAY) == pdTRUE)  )
-       {
-        // PassengerTemperatureDifference=Passenger_Seat_Button_Interrupt_Flag - Passenger_Current_Temperature ;
-
-             //UART0_SendString("semaphore Passenger TRUE\r\n");
-         if (Passenger_Seat_Button_Interrupt_Flag==Off )
-           {
-
-                           //  UART0_SendString(" Driver_Heater=Offheat \r\n");
-                             Passenger_Heater=Offheat;
-                            //vTaskDelay(pdMS_TO_TICKS(100));
-           }
-
-         else if (Passenger_Seat_Button_Interrupt_Flag !=Off )
-         {
-             PassengerTemperatureDifference=Passenger_Seat_Button_Interrupt_Flag - Passenger_Current_Temperature ;
-
-
-               if(Passenger_Seat_Button_Interrupt_Flag>Passenger_Current_Temperature)
-              {
-                   if(PassengerTemperatureDifference>=10)
-                        {
-                           Passenger_Heater=Highheat;
-                           //UART0_SendString(" Passenger is HIGH\r\n");
-
-                        }
-                   else if((PassengerTemperatureDifference>=5) && (PassengerTemperatureDifference<10))
-                        {
-                           Passenger_Heater=Mediumheat;
-                           //UART0_SendString(" Passenger is MEDIUM\r\n");
-
-                        }
-                   else if((PassengerTemperatureDifference>=2) && (PassengerTemperatureDifference<5))
-                        {
-                           Passenger_Heater=Lowheat;
-                           //UART0_SendString(" Passenger is LOW\r\n");
-
-                        }
-                   else
-                        {
-                           Passenger_Heater=Offheat;
-                          //UART0_SendString(" Passenger is LOW\r\n");
-
-                        }
-                }
-                else
-                {
-                    Passenger_Heater=Offheat;
-                    //UART0_SendString(" Passenger is LOW\r\n");
-                }
-            }
-
-
-        }
-
-     xSemaphoreGive(xMutexDriverControlSeatTemperature);
-     xSemaphoreGive(xMutexPassengerControlSeatTemperature);
-
-     xSemaphoreGive(xMutexDriverControl);
-     xSemaphoreGive(xMutexPassengerControl);
-
-     xSemaphoreGive(xLeds);
-     xEventGroupSetBits(xEventGroupForMeasurementTask, Heat_Measure_Task_BIT );
-     GPTM2=GPTM_WTimer0Read();
-     HeatingControlTaskExecutiontime=(GPTM2-GPTM1)*10;
-     HeatControlTotalTime=GPTM_WTimer0Read()*10;
-
-
-    // UART0_SendString(" END OF HeatingControlTask  \r\n");
-
-     //vTaskDelay(pdMS_TO_TICKS(1000));
-
-    }
-    } /*for*/
- } /*function */
-
-
-
-void vLedControlTask(void *pvParameters)
-{
-    uint32 GPTM1,GPTM2;
-    GPTM1=GPTM_WTimer0Read();
-    for(;;)
-    {
-
-
-    if (xSemaphoreTake(xLeds, portMAX_DELAY) == pdTRUE)
-        {
-
-
-            if(Driver_Heater==Offheat)
-            {
-                GPIO_BlueLedOff();
-                GPIO_GreenLedOff();
-               //ART0_SendString(" ****************DRIVER__OFF****************  \r\n");
-
-               // GPIO_RedLedToggle(); ////test
-            }
-            else if(Driver_Heater==Lowheat)
-            {
-                GPIO_GreenLedOn();
-               //ART0_SendString(" ****************DRIVER_LOW****************  \r\n");
-
-
-            }
-            else if(Driver_Heater==Mediumheat)
-            {
-                GPIO_GreenLedOff();
-               GPIO_BlueLedOn();
-               // UART0_SendString(" ****************DRIVER_MEDIUM****************  \r\n");
-
-            }
-            else if (Driver_Heater==Highheat)
-            {
-                GPIO_GreenLedOn();
-                GPIO_BlueLedOn();
-               // UART0_SendString(" ****************DRIVER_HIGH****************  \r\n");
-
-            }
-            if(Passenger_Heater==Offheat)
-            {
-                GPIO_BlueLedOff();
-                GPIO_GreenLedOff();
-               // UART0_SendString(" ****************PASSENGER_OFF****************  \r\n");
-
-            }
-            else if(Passenger_Heater==Lowheat)
-            {
-                GPIO_GreenLedOn();
-               // UART0_SendString(" ****************PASSENGER_LOW****************  \r\n");
-
-            }
-            else if(Passenger_Heater==Mediumheat)
-            {
-                GPIO_GreenLedOff();
-                GPIO_BlueLedOn();
-               // UART0_SendString(" ****************PASSENGER_MEDIUM****************  \r\n");
-
-            }
-            else if (Passenger_Heater==Highheat)
-            {
-                GPIO_GreenLedOn();
-                GPIO_BlueLedOn();
-               // UART0_SendString(" ****************PASSENGER_HIGH****************  \r\n");
-
-            }
-        }
-
-
-
-
-
-    xEventGroupSetBits(xEventGroupForMeasurementTask, LED_Measure_Task_BIT );
-    GPTM2=GPTM_WTimer0Read();
-    LedControlTaskExecutiontime=(GPTM2-GPTM1)*10;
-    LedControlTotalTime=GPTM_WTimer0Read()*10;
-    ///vTaskDelay(pdMS_TO_TICKS(2000));
-    }
-}
-
-
-void vDisplayTask (void *pvParameters)
-{
-    uint32 GPTM1,GPTM2;
-    GPTM1=GPTM_WTimer0Read();
-        EventBits_t xEventGroupValue;
-        const EventBits_t xBitsToWaitFor = ( Current_Change_Display| Desired_Change_Display);
-
-
-
-        for (;;)
-        {
-
-    /* Block to wait for event bits to become set within the event group. */
-          xEventGroupValue = xEventGroupWaitBits( xEventGroupForDisplayTask,    /* The event group to read. */
-                                                  xBitsToWaitFor,                      /* Bits to test. */
-                                                   pdTRUE,                              /* Clear bits on exit if the unblock condition is met. */
-                                                   pdFALSE,                             /* Don't Wait for all bits. */
-                                                   portMAX_DELAY);                      /* Don't time out. */
-
-
-
-
-          if (  (xSemaphoreTake(xMutexPassengerControl, portMAX_DELAY) == pdTRUE)  && (xSemaphoreTake(xMutexPassengerSensingTemperature, portMAX_DELAY) == pdTRUE) && (xSemaphoreTake(xMutexPassengerControlSeatTemperature, portMAX_DELAY) == pdTRUE)  )
-          {
-
-              UART0_SendString("Passenger Desired Temp =");
-              UART0_SendInteger(Passenger_Seat_Button_Interrupt_Flag);
-              UART0_SendString("\r\n");
-
-              UART0_SendString("Passenger Current Temp =");
-              UART0_SendInteger(Passenger_Current_Temperature);
-               UART0_SendString("\r\n");
-
-
-               if ( Passenger_Heater == Offheat)
-               {
-                   UART0_SendString("Passenger Heater Level OFF HEAT\r\n");
-
-               }
-               else if (Passenger_Heater ==Lowheat )
-               {
-                   UART0_SendString("Passenger Heater Level LOW HEAT\r\n");
-
-               }
-
-               else if (Passenger_Heater ==Mediumheat )
-               {
-                   UART0_SendString("Passenger Heater Level MEDIUM HEAT\r\n");
-
-                }
-               else if (Passenger_Heater == Highheat )
-               {
-                 UART0_SendString("Passenger Heater Level HIGH HEAT\r\n");
-
-               }
-
-
-          }
-
-          if (  (xSemaphoreTake(xMutexDriverControl, portMAX_DELAY) == pdTRUE)  && (xSemaphoreTake(xMutexDriverSensingTemperature, portMAX_DELAY) == pdTRUE) && (xSemaphoreTake(xMutexDriverControlSeatTemperature, portMAX_DELAY) == pdTRUE)  )
-           {
-
-              UART0_SendString("Driver Desired Temp =");
-              UART0_SendInteger(Driver_Seat_Button_Interrupt_Flag);
-              UART0_SendString("\r\n");
-
-                UART0_SendString("Driver Current Temp =");
-                UART0_SendInteger(Driver_Current_Temperature);
-                UART0_SendString("\r\n");
-
-
-              if ( Driver_Heater == Offheat)
-             {
-                 UART0_SendString("Driver Heater Level OFF HEAT\r\n");
-
-              }
-              else if (Driver_Heater ==Lowheat )
-                {
-                    UART0_SendString("Driver Heater Level LOW HEAT");
-
-               }
-
-              else if (Driver_Heater ==Mediumheat )
-               {
-                  UART0_SendString("Driver Heater Level MEDIUM HEAT");
-
-                  }
-                   else if (Driver_Heater == Highheat )
-                    {
-                   UART0_SendString("Driver Heater Level HIGH HEAT");
-
-                  }
-
-                            Delay_MS(3000);
-
-           }
-
-          xSemaphoreGive(xMutexDriverControlSeatTemperature);
-          xSemaphoreGive(xMutexPassengerControlSeatTemperature);
-
-          xSemaphoreGive(xMutexDriverControl);
-          xSemaphoreGive(xMutexPassengerControl);
-
-          xSemaphoreGive(xMutexPassengerSensingTemperature);
-          xSemaphoreGive(xMutexDriverSensingTemperature);
-          xEventGroupSetBits(xEventGroupForMeasurementTask, Display_Measure_Task_BIT );
-          GPTM2=GPTM_WTimer0Read();
-          DisplayTaskExecutiontime=(GPTM2-GPTM1)*10;
-          DisplayTotalTime=GPTM_WTimer0Read()*10;
-
-
-
-         // vTaskDelay(pdMS_TO_TICKS(1000));
-        }
-}
-void vDiagnosticsTask (void *pvParameters)
-{
-    uint32 GPTM1,GPTM2;
-    GPTM1=GPTM_WTimer0Read();
-    for(;;)
-    {
-        if (xSemaphoreTake(xTempToDig, portMAX_DELAY) == pdTRUE)
-        {
-
-             if ((xSemaphoreTake(xMutexPassengerSensingTemperature, portMAX_DELAY) == pdTRUE) && (xSemaphoreTake(xMutexDriverSensingTemperature, portMAX_DELAY) == pdTRUE))
-             {
-               if(Passenger_Current_Temperature<5 || Passenger_Current_Temperature>40 || Driver_Current_Temperature<5 || Driver_Current_Temperature>40 )
-               {
-                   uint32_t GPTM=GPTM_WTimer0Read()*10;
-
-                    Driver_Heater=Offheat;                    /*Global Variable for the Driver heater Value*/
-                    Passenger_Heater=Offheat;
-
-                    GPIO_BlueLedOff();
-                    GPIO_GreenLedOff();
-
-                   GPIO_RedLedOn();
-                   UART0_SendString("Error Time stamp at:");
-                   UART0_SendInteger(GPTM);
-                   UART0_SendString("\r\n");
-
-                   UART0_SendString("Driver Current Temp:");
-                   UART0_SendInteger(Driver_Current_Temperature);
-                   UART0_SendString("\r\n");
-
-                   UART0_SendString("Passenger Current Temp:");
-                   UART0_SendInteger(Passenger_Current_Temperature);
-                   UART0_SendString("\r\n");
-
-                  // xSemaphoreGive(xDiagnostic);
-
-
-               }
-               else
-               {
-                   GPIO_RedLedOff();
-                   xSemaphoreGive(xDiagnostic);
-               }
-
-
-
-           }
-             xSemaphoreGive(xMutexPassengerSensingTemperature);
-             xSemaphoreGive(xMutexDriverSensingTemperature);
-      }
-        xEventGroupSetBits(xEventGroupForMeasurementTask, Diganostics_Measure_Task_BIT );
-        GPTM2=GPTM_WTimer0Read();
-        DiganosticsControlTaskExecutiontime=(GPTM2-GPTM1)*10;
-        DiagnosticsTotalTime=GPTM_WTimer0Read()*10;
-    }
-}
-void vRunTimeMeasurementsTask(void *pvParameters)
-{
-    EventBits_t xEventGroupValue;
-    uint32 ullCPU_Load;
-    const EventBits_t xBitsToWaitFor = (Button_Measure_Task_BIT|Temperature_Sensing_Measure_Task_BIT|
-                                        LED_Measure_Task_BIT|Heat_Measure_Task_BIT| Display_Measure_Task_BIT|
-                                        Diganostics_Measure_Task_BIT);
-    for(;;)
-    {
-        xEventGroupValue = xEventGroupWaitBits( xEventGroupForMeasurementTask,    /* The event group to read. */
-                                                         xBitsToWaitFor,                      /* Bits to test. */
-                                                          pdTRUE,                              /* Clear bits on exit if the unblock condition is met. */
-                                                          pdTRUE,                             /* Wait for all bits. */
-                                                          portMAX_DELAY);                      /* Don't time out. */
-
-        UART0_SendString("ButtonTaskExecutionTime=");
-        UART0_SendInteger(ButtonControlTaskExecutiontime);
-        UART0_SendString("\r\n");
-        UART0_SendString("SensingTemperatureTaskExecutionTime=");
-        UART0_SendInteger(SensingTempTaskExecutiontime);
-        UART0_SendString("\r\n");
-        UART0_SendString("DisplayTaskExecutionTime=:");
-        UART0_SendInteger(DisplayTaskExecutiontime);
-        UART0_SendString("\r\n");
-        UART0_SendString("HeatingControlTaskExecutionTime=");
-        UART0_SendInteger(HeatingControlTaskExecutiontime);
-        UART0_SendString("\r\n");
-        UART0_SendString("LedControlTaskExecutionTime=");
-        UART0_SendInteger(LedControlTaskExecutiontime);
-        UART0_SendString("\r\n");
-        UART0_SendString("DiaganosticsTaskExecutionTime=");
-        UART0_SendInteger(DiganosticsControlTaskExecutiontime);
-        UART0_SendString("\r\n");
-        ullCPU_Load=(ButtonTotalTime+TempsenseTotalTime+HeatControlTotalTime+DisplayTotalTime+LedControlTotalTime+DiagnosticsTotalTime)*100/GPTM_WTimer0Read();
-        UART0_SendString("CPULoad=");
-        UART0_SendInteger(ullCPU_Load);
-        UART0_SendString("\r\n");
-
-    }
-}
-
-
-/* GPIO PORTF External Interrupt - ISR */
-void GPIOPortF_Handler(void)
-{
-    UART0_SendString("ISR \r\n");
-
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    if(GPIO_PORTF_RIS_REG & (1<<0))           /* PF0 handler code */
-    {
-        Delay_MS(200);
-        xEventGroupSetBitsFromISR(xEventGroupForButtons, mainSW2_INTERRUPT_BIT,&xHigherPriorityTaskWoken);
-        GPIO_PORTF_ICR_REG   |= (1<<0);       /* Clear Trigger flag for PF0 (Interrupt Flag) */
-
-    }
-    else if(GPIO_PORTF_RIS_REG & (1<<4))      /* PF4 handler code */
-    {
-        Delay_MS(200);
-        xEventGroupSetBitsFromISR(xEventGroupForButtons, mainSW1_INTERRUPT_BIT,&xHigherPriorityTaskWoken);
-        GPIO_PORTF_ICR_REG   |= (1<<4);       /* Clear Trigger flag for PF4 (Interrupt Flag) */
-
-    }
-
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-}
-
-/*-----------------------------------------------------------*/
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* MCAL includes. */
+#include "uart0.h"
+#include "MCAL/ADC/adc.h"
+#include "MCAL/Temperatrue Sensor/lm35.h"
+#include "gpio.h"
+#include "tm4c123gh6pm_registers.h"
+#include "GPTM.h"
+/* Application includes. */
+#include "APP/SEAT_STATE/seat_state.h"
+#include "APP/SIGNALS/signals.h"
+#include "APP/PROFILER/profiler.h"
+#include "APP/BENCHMARK/benchmark.h"
+#include "APP/SCHEDULE/schedule.h"
+#include "APP/DEBOUNCE/debounce.h"
+#include "APP/DEADLINE/deadline.h"
+#ifdef SIMULATION
+#include "sim_hw.h"
+#include "sim_clock.h"
+#endif
+/* Other includes */
+#include <stdlib.h>
+#ifdef SIMULATION
+#include <stdio.h>
+#endif
+
+/* Definitions for the signal bits, each set of bits is owned by the task that waits on it. */
+#define mainSW2_PRESS_BIT ( 1UL << 0UL )       /* Event bit 0, which is set by a debounced SW2 press. */
+#define mainSW1_PRESS_BIT ( 1UL << 1UL )       /* Event bit 1, which is set by a debounced SW1 press. */
+#define mainSW2_LONG_PRESS_BIT ( 1UL << 2UL )  /* Event bit 2, which is set when SW2 is held. */
+#define mainSW1_LONG_PRESS_BIT ( 1UL << 3UL )  /* Event bit 3, which is set when SW1 is held. */
+
+#define Button_Control_Task_BIT ( 1UL << 0UL )          /* Event bit 0, which is set by ButtonControlTask for heat Control task. */
+#define Temperature_Sensing_Task_BIT ( 1UL << 1UL )     /* Event bit 1, which is set by Temperature Sensing Task for heat control task. */
+#define Diagnostics_Ok_Task_BIT ( 1UL << 2UL )          /* Event bit 2, which is set by Diagnostics Task when both temperatures are in range. */
+
+#define Heater_Change_LED_BIT ( 1UL << 0UL )            /* Event bit 0, which is set by heat control task for the LED task. */
+#define Temperature_Change_Diagnostics_BIT ( 1UL << 0UL ) /* Event bit 0, which is set by Temperature Sensing Task for the Diagnostics task. */
+
+#define Desired_Change_Display ( 1UL << 0UL )
+#define Current_Change_Display ( 1UL << 1UL )
+
+/* Shortest time between two reports of the display task */
+#define mainDISPLAY_INTERVAL_MS     3000
+
+/*Task handles*/
+TaskHandle_t xvButtonControlTask;
+TaskHandle_t xvTemperatureSensingTask;
+TaskHandle_t xvHeatingControlTask;
+TaskHandle_t xvLedControlTask;
+TaskHandle_t xvDisplay;
+TaskHandle_t xvDiagnosticsTask;
+TaskHandle_t xvRunTimeMeasurementsTask;
+#if ( configAPP_KERNEL_BENCHMARK == 1 )
+TaskHandle_t xvBenchmarkTask;
+#endif
+
+/* Signals
+ * The tasks unblock each other through the signal bits kept in the notification value
+ * of the receiving task (APP/SIGNALS), no event group or semaphore is allocated:
+ * Button task      <-- press and long press bits of both buttons, set by the debouncing (APP/DEBOUNCE)
+ * Heating task     <-- bits from Button control and Temp sensing, plus the Diagnostics ok bit
+ * LED task         <-- bit set by the Heating task when the heater levels are published
+ * Display task     <-- bits from Button control and Temp sensing indicating for change
+ * Diagnostics task <-- bit set by Temp sensing for each new reading */
+
+/* shared resources
+ * The desired levels, current temperatures and heater levels of both seats live in
+ * a single SeatState_t snapshot (APP/SEAT_STATE): writers publish their fields for both
+ * seats at once and readers take a copy without blocking. */
+
+/* Buttons
+ * The Port F ISR only takes the edges, the button events are raised by the debouncing
+ * once the level settled. The release of a button is not used. */
+static const DebounceButton_t xButtonEvents[DEBOUNCE_BUTTONS] =
+{
+    /* Receiver                Press               Long press              Release */
+    { &xvButtonControlTask,    mainSW1_PRESS_BIT,  mainSW1_LONG_PRESS_BIT, 0 },     /* DEBOUNCE_SW1 */
+    { &xvButtonControlTask,    mainSW2_PRESS_BIT,  mainSW2_LONG_PRESS_BIT, 0 }      /* DEBOUNCE_SW2 */
+};
+
+/* Task storage
+ * With the static allocation profile (configSUPPORT_DYNAMIC_ALLOCATION 0 in FreeRTOSConfig.h)
+ * there is no heap: every task, and the idle and timer tasks of the kernel, run from the
+ * compile time buffers below. The default profile takes the TCBs and stacks from the heap. */
+#define mainNUMBER_OF_TASKS     ( 7 + configAPP_KERNEL_BENCHMARK )
+#define mainTASK_STACK_DEPTH    256
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+static StaticTask_t xTaskBuffers[mainNUMBER_OF_TASKS];
+static StackType_t xTaskStacks[mainNUMBER_OF_TASKS][mainTASK_STACK_DEPTH];
+static StaticTask_t xIdleTaskBuffer;
+static StackType_t xIdleTaskStack[configMINIMAL_STACK_SIZE];
+#if ( configUSE_TIMERS == 1 )
+static StaticTask_t xTimerTaskBuffer;
+static StackType_t xTimerTaskStack[configTIMER_TASK_STACK_DEPTH];
+#endif
+#endif
+
+/* The HW setup function */
+static void prvSetupHardware( void );
+
+/* Creates a task from the heap or, in the static profile, from the next task buffers */
+static void prvCreateTask( TaskFunction_t pxTaskCode, const char * const pcName, uint16 usStackDepth,
+                           void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask );
+
+/* Heating level helpers */
+static uint32 prvNextHeatingLevel( uint32 uLevel );
+static uint32 prvComputeHeaterLevel( uint32 uDesiredTemperature, uint32 uCurrentTemperature );
+
+/* FreeRTOS tasks */
+void vButtonControlTask(void *pvParameters);         /*Unblock by the button events*/
+void vTemperatureSensingJob(void);                   /*Used to Measure the LM-35 Temp is global variables*/
+void vHeatingControlTask(void *pvParameters);        /*Used to determine Heater level based on Temp. Sensing Task*/
+void vLedControlTask(void *pvParameters);            /*Control Led OutPut*/
+void vDisplayTask (void *pvParameters);              /*Display UART */
+void vDiagnosticsTask (void *pvParameters);          /*Task used to assure range of heater from 5 to 40*/
+#if ( configAPP_KERNEL_BENCHMARK == 1 )
+static void prvBenchmarkTask(void *pvParameters);    /*Runs the kernel micro-benchmarks once*/
+#endif
+
+/* Task table
+ * Periodic tasks (Job) are released every PeriodMs by Schedule_PeriodicTask, sporadic
+ * tasks (TaskCode) by the signals of other tasks, PeriodMs being the shortest time
+ * between two of their releases. The priorities are assigned from the deadlines by
+ * Schedule_Init, which rejects the table if a deadline cannot be met with the budgets:
+ * Diagnostics, LED     20ms  the error output and the LEDs follow a reading at once
+ * Sensing, Heating     50ms  heating is released by the readings and the buttons, twice per 500ms at worst
+ * Button              100ms  a press is handled at most every 500ms
+ * Measurements       1000ms  one profiler report per window
+ * Display            3000ms  one report per mainDISPLAY_INTERVAL_MS */
+static ScheduleTask_t xTaskTable[] =
+{
+    /* Priority and ResponseTimeUs are left at 0 and set by Schedule_Init */
+    {
+        .Job        = NULL_PTR,
+        .TaskCode   = vButtonControlTask,
+        .Name       = "Task for button control",
+        .PeriodMs   = 500,
+        .DeadlineMs = 100,
+        .WcetUs     = 150,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvButtonControlTask,
+    },
+    {
+        .Job        = vTemperatureSensingJob,
+        .TaskCode   = NULL_PTR,
+        .Name       = "Task for Temperature sensing",
+        .PeriodMs   = 500,
+        .DeadlineMs = 50,
+        .WcetUs     = 200,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvTemperatureSensingTask,
+    },
+    {
+        .Job        = NULL_PTR,
+        .TaskCode   = vHeatingControlTask,
+        .Name       = "Task for Heating Control",
+        .PeriodMs   = 250,
+        .DeadlineMs = 50,
+        .WcetUs     = 100,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvHeatingControlTask,
+    },
+    {
+        .Job        = NULL_PTR,
+        .TaskCode   = vLedControlTask,
+        .Name       = "Task for LED Control",
+        .PeriodMs   = 250,
+        .DeadlineMs = 20,
+        .WcetUs     = 50,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvLedControlTask,
+    },
+    {
+        .Job        = NULL_PTR,
+        .TaskCode   = vDisplayTask,
+        .Name       = "DisplayTask",
+        .PeriodMs   = mainDISPLAY_INTERVAL_MS,
+        .DeadlineMs = mainDISPLAY_INTERVAL_MS,
+        .WcetUs     = 1500,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvDisplay,
+    },
+    {
+        .Job        = NULL_PTR,
+        .TaskCode   = vDiagnosticsTask,
+        .Name       = "DiagnosticsTask",
+        .PeriodMs   = 500,
+        .DeadlineMs = 20,
+        .WcetUs     = 400,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvDiagnosticsTask,
+    },
+    {
+        .Job        = Profiler_SendReport,
+        .TaskCode   = NULL_PTR,
+        .Name       = "xvRunTimeMeasurementsTask",
+        .PeriodMs   = PROFILER_REPORT_PERIOD_MS,
+        .DeadlineMs = PROFILER_REPORT_PERIOD_MS,
+        .WcetUs     = 3000,
+        .StackDepth = mainTASK_STACK_DEPTH,
+        .Handle     = &xvRunTimeMeasurementsTask,
+    },
+};
+
+#define mainTASK_TABLE_SIZE     ( sizeof( xTaskTable ) / sizeof( xTaskTable[ 0 ] ) )
+
+#ifdef SIMULATION
+/* Host run
+ * The idle hook advances the virtual clock (MCAL/SIM) whenever every task is blocked,
+ * and ends the scheduler after mainSIM_RUN_TIME_US of virtual time. The script below
+ * sets both seats to 20C, raises the driver seat to Medium and the passenger seat to
+ * Low with bouncing presses, warms the driver seat to 30C, then holds SW2 to turn the
+ * passenger seat Off. The display reports go to the standard output. */
+#ifndef mainSIM_RUN_TIME_US
+#define mainSIM_RUN_TIME_US     10000000ULL
+#endif
+
+#define mainSIM_20C             1820    /* Raw 12 bit samples of the LM35 channels */
+#define mainSIM_30C             2730
+
+static const SimEvent_t xSimScript[] =
+{
+    /* Time(us)  Event               Target           Value */
+    { 0,         SIM_EVENT_INPUT,    AIN0_CHANNEL,    mainSIM_20C },
+    { 0,         SIM_EVENT_INPUT,    AIN1_CHANNEL,    mainSIM_20C },
+    { 1000000,   SIM_EVENT_BUTTON,   SIM_HW_SW1_PIN,  1 },
+    { 1000400,   SIM_EVENT_BUTTON,   SIM_HW_SW1_PIN,  0 },      /* Bounce */
+    { 1000900,   SIM_EVENT_BUTTON,   SIM_HW_SW1_PIN,  1 },
+    { 1200000,   SIM_EVENT_BUTTON,   SIM_HW_SW1_PIN,  0 },
+    { 2000000,   SIM_EVENT_BUTTON,   SIM_HW_SW1_PIN,  1 },
+    { 2200000,   SIM_EVENT_BUTTON,   SIM_HW_SW1_PIN,  0 },
+    { 2600000,   SIM_EVENT_BUTTON,   SIM_HW_SW2_PIN,  1 },
+    { 2800000,   SIM_EVENT_BUTTON,   SIM_HW_SW2_PIN,  0 },
+    { 4000000,   SIM_EVENT_INPUT,    AIN1_CHANNEL,    mainSIM_30C },
+    { 5000000,   SIM_EVENT_BUTTON,   SIM_HW_SW2_PIN,  1 },      /* Held 1.5s */
+    { 6500000,   SIM_EVENT_BUTTON,   SIM_HW_SW2_PIN,  0 },
+};
+
+#define mainSIM_SCRIPT_LENGTH   ( sizeof( xSimScript ) / sizeof( xSimScript[ 0 ] ) )
+
+/* Raises the next interrupt of the virtual clock, run through vPortRunInterrupt */
+static void prvSimClockStep( void );
+#endif
+
+
+int main()
+ {
+    boolean bSchedulable;
+    uint32 uIndex;
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+    boolean bMonitored;
+#endif
+
+    /* Setup the hardware for use with the Tiva C board. */
+    prvSetupHardware();
+
+    /* An overloaded table is a design error, stop here before any task runs */
+    bSchedulable = Schedule_Init(xTaskTable, mainTASK_TABLE_SIZE);
+    configASSERT( bSchedulable == TRUE );
+    ( void ) bSchedulable;
+
+    /* Create the tasks of the table here */
+    /*Button control task
+     * Functionality:  Monitors button inputs to cycle through the heater states(Off,Low,Medium,High)
+     * Implementation: 1- Using the debounced press events of the buttons (APP/DEBOUNCE)
+     *                 2- When button is pressed, the heating level should advance from Off-->Low-->Medium-->High-->Low
+     *                    and when it is held (long press) the heating of that seat is turned Off
+     *                 3- Publish the desired levels of both seats in the shared seat state snapshot
+     * Interaction with Other Tasks:
+     *                 1-The Heating Control Task will read the updated heating level from the seat state snapshot
+     *                 2-The Display Update Task will display the updated level on the shared screen
+     */
+    /*Temperature sensing task
+     * Functionality: 1-Reads temperature from the sensor (or potentiometer for testing purposes) and maps the analog value to a valid temperature range (5C to 40C).
+                      2-This task continuously monitors temperature changes.
+     * Implementation: 1-Use *ADC* to read the analog voltage from the sensor or potentiometer.
+                       2-Convert the ADC value to temperature using a formula.
+                       3-Publish the current temperatures of both seats in the seat state snapshot.
+     *Interaction with Other Tasks:
+     *                 1-The Heating Control Task reads the current temperature from this task.
+     *                 2-The Diagnostic Task will check if the temperature is within the valid range and act accordingly.
+     * */
+    for (uIndex = 0; uIndex < mainTASK_TABLE_SIZE; uIndex++)
+    {
+        if (xTaskTable[uIndex].Job != NULL_PTR)
+        {
+            prvCreateTask(Schedule_PeriodicTask, xTaskTable[uIndex].Name, xTaskTable[uIndex].StackDepth,
+                          &xTaskTable[uIndex], xTaskTable[uIndex].Priority, xTaskTable[uIndex].Handle);
+        }
+        else
+        {
+            prvCreateTask(xTaskTable[uIndex].TaskCode, xTaskTable[uIndex].Name, xTaskTable[uIndex].StackDepth,
+                          NULL, xTaskTable[uIndex].Priority, xTaskTable[uIndex].Handle);
+        }
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+        /* The kernel runs the ready job with the earliest deadline first */
+        vTaskSetDeadline(*xTaskTable[uIndex].Handle, pdMS_TO_TICKS(xTaskTable[uIndex].DeadlineMs));
+#endif
+
+#if ( configAPP_DEADLINE_MONITOR == 1 )
+        /* Each job is checked against the deadline of the table, the misses show in the profiler report */
+        bMonitored = Deadline_Register(*xTaskTable[uIndex].Handle, xTaskTable[uIndex].DeadlineMs * 1000UL);
+        configASSERT( bMonitored == TRUE );
+        ( void ) bMonitored;
+#endif
+    }
+
+#if ( configAPP_KERNEL_BENCHMARK == 1 )
+    /* Above every task of the table, so it runs before any of them */
+    prvCreateTask(prvBenchmarkTask, "Benchmark", mainTASK_STACK_DEPTH, NULL, SCHEDULE_HIGHEST_PRIORITY + 1, &xvBenchmarkTask);
+#endif
+
+   // UART0_SendString("Main \r\n");
+
+    /* Now all the tasks have been started - start the scheduler.
+
+    NOTE : Tasks run in system mode and the scheduler runs in Supervisor mode.
+    The processor MUST be in supervisor mode when vTaskStartScheduler is
+    called.  The demo applications included in the FreeRTOS.org download switch
+    to supervisor mode prior to main being called.  If you are not using one of
+    these demo application projects then ensure Supervisor mode is used here. */
+    vTaskStartScheduler();
+
+#ifdef SIMULATION
+    /* The idle hook ended the scheduler at the end of the run */
+    configASSERT( SimHw_Overflowed() == FALSE );
+    return 0;
+#endif
+
+    /* Should never reach here!  If you do then there was not enough heap
+    available for the idle task to be created (default profile only). */
+    for (;;);
+
+}
+
+
+static void prvSetupHardware( void )
+{
+#ifdef SIMULATION
+    /* The register file and the virtual clock come before any driver */
+    SimHw_Init();
+    SimClock_Init(xSimScript, mainSIM_SCRIPT_LENGTH);
+#endif
+
+    /* Place here any needed HW initialization such as GPIO, UART, etc.  */
+    UART0_Init();
+    ADC_TimerTriggeredInit();
+    GPIO_BuiltinButtonsLedsInit();
+    GPTM_WTimer0Init();
+    Debounce_Init(xButtonEvents);   /* Enables the button interrupts, uses the WTimer0 timestamp */
+}
+
+static void prvCreateTask( TaskFunction_t pxTaskCode, const char * const pcName, uint16 usStackDepth,
+                           void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask )
+{
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    static uint32 uNextTask = 0;
+
+    /* A task that does not fit the buffers is a build time sizing error, stop here */
+    configASSERT( uNextTask < mainNUMBER_OF_TASKS );
+    configASSERT( usStackDepth <= mainTASK_STACK_DEPTH );
+
+    *pxCreatedTask = xTaskCreateStatic( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority,
+                                        xTaskStacks[uNextTask], &xTaskBuffers[uNextTask] );
+    uNextTask++;
+#else
+    BaseType_t xStatus = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask );
+
+    configASSERT( xStatus == pdPASS );
+    ( void ) xStatus;
+#endif
+}
+
+/* Next desired level on a button press: Off-->Low-->Medium-->High-->Off */
+static uint32 prvNextHeatingLevel( uint32 uLevel )
+{
+    if(uLevel==Off)
+    {
+        return Low;
+    }
+    else if(uLevel==Low)
+    {
+        return Medium;
+    }
+    else if(uLevel==Medium)
+    {
+        return High;
+    }
+    return Off;
+}
+
+/* Heater level needed to bring the seat from its current to its desired temperature */
+static uint32 prvComputeHeaterLevel( uint32 uDesiredTemperature, uint32 uCurrentTemperature )
+{
+    uint32 uTemperatureDifference;
+
+    if((uDesiredTemperature==Off) || (uDesiredTemperature<=uCurrentTemperature))
+    {
+        return Offheat;
+    }
+
+    uTemperatureDifference=uDesiredTemperature - uCurrentTemperature;
+    if(uTemperatureDifference>=10)
+    {
+        return Highheat;
+    }
+    else if(uTemperatureDifference>=5)
+    {
+        return Mediumheat;
+    }
+    else if(uTemperatureDifference>=2)
+    {
+        return Lowheat;
+    }
+    return Offheat;
+}
+void vButtonControlTask(void *pvParameters)
+{
+    Signals_t uSignals;
+    SeatState_t xSeatState;
+
+    const Signals_t uSignalsToWaitFor = ( mainSW1_PRESS_BIT | mainSW2_PRESS_BIT | mainSW1_LONG_PRESS_BIT | mainSW2_LONG_PRESS_BIT);
+
+    (void)pvParameters;
+
+    for (;;)
+    {
+        /* Block until any of the button bits is set, the received bits are cleared. */
+        uSignals = Signal_WaitAny(uSignalsToWaitFor, portMAX_DELAY);
+        Deadline_JobStarted();
+
+        /* This task is the only writer of the desired levels, so the snapshot is up to date */
+        SeatState_Read(&xSeatState);
+
+        /* In case SW2 (PF0) was pressed, it will set event 0 bit */
+        if ((uSignals & mainSW2_PRESS_BIT) != 0)
+        {
+            /* Advance the Passenger level Off-->Low-->Medium-->High-->Off */
+            xSeatState.Passenger.Desired_Temperature = prvNextHeatingLevel(xSeatState.Passenger.Desired_Temperature);
+        }
+        /* In case SW1 (PF4) was pressed, it will set event 1 bit */
+        if ((uSignals & mainSW1_PRESS_BIT) != 0)
+        {
+            /* Advance the Driver level Off-->Low-->Medium-->High-->Off */
+            xSeatState.Driver.Desired_Temperature = prvNextHeatingLevel(xSeatState.Driver.Desired_Temperature);
+        }
+        /* A held button turns its seat Off, after the press that advanced it */
+        if ((uSignals & mainSW2_LONG_PRESS_BIT) != 0)
+        {
+            xSeatState.Passenger.Desired_Temperature = Off;
+        }
+        if ((uSignals & mainSW1_LONG_PRESS_BIT) != 0)
+        {
+            xSeatState.Driver.Desired_Temperature = Off;
+        }
+        SeatState_SetDesiredTemperatures(xSeatState.Driver.Desired_Temperature, xSeatState.Passenger.Desired_Temperature);
+
+        Signal_Send(xvHeatingControlTask, Button_Control_Task_BIT);/*Setting the bit for Heating control task to start working*/
+        Signal_Send(xvDisplay ,Desired_Change_Display );/*Setting the bit for Display task to start working*/
+        Deadline_JobCompleted();
+       vTaskDelay(pdMS_TO_TICKS(500));  /*At most one press every 500ms, the PeriodMs of the table*/
+    }
+}
+
+
+/* Released every 500ms by Schedule_PeriodicTask */
+void vTemperatureSensingJob(void)
+{
+    uint8 uTemperature;
+    SeatState_t xSeatState;
+
+    /* This task is the only writer of the current temperatures, the last value is kept if no sample is ready */
+    SeatState_Read(&xSeatState);
+
+    /*consuming the samples taken by the timer triggered ADC*/
+    if(LM35_getLatestTemperature(SENSOR0_CHANNEL_ID, &uTemperature))
+    {
+        xSeatState.Passenger.Current_Temperature=uTemperature;/*calculating temperature on passenger sensor*/
+    }
+    if(LM35_getLatestTemperature(SENSOR1_CHANNEL_ID, &uTemperature))
+    {
+        xSeatState.Driver.Current_Temperature=uTemperature;   /*calculating temperature on driver sensor*/
+    }
+
+    /*publishing both temperatures at the same time*/
+    SeatState_SetCurrentTemperatures(xSeatState.Driver.Current_Temperature, xSeatState.Passenger.Current_Temperature);
+
+    Signal_Send(xvHeatingControlTask, Temperature_Sensing_Task_BIT);/*Setting the bit for Heating control task to start working*/
+
+    Signal_Send(xvDisplay ,Current_Change_Display );/*Setting the bit for D task to start working*/
+
+    Signal_Send(xvDiagnosticsTask, Temperature_Change_Diagnostics_BIT);
+}
+
+
+
+void vHeatingControlTask(void *pvParameters)
+{
+    const Signals_t uSignalsToWaitFor = (Button_Control_Task_BIT | Temperature_Sensing_Task_BIT );
+    SeatState_t xSeatState;
+    (void)pvParameters;
+    for (;;)
+    {
+    if(Signal_WaitAll(Diagnostics_Ok_Task_BIT, portMAX_DELAY) != 0)
+    {
+            /* Block until the desired level or the current temperature changes. */
+            (void)Signal_WaitAny(uSignalsToWaitFor, portMAX_DELAY);
+            Deadline_JobStarted();
+
+     /* Compute both heater levels from one consistent snapshot and publish them together */
+     SeatState_Read(&xSeatState);
+     SeatState_SetHeaters(prvComputeHeaterLevel(xSeatState.Driver.Desired_Temperature, xSeatState.Driver.Current_Temperature),
+                          prvComputeHeaterLevel(xSeatState.Passenger.Desired_Temperature, xSeatState.Passenger.Current_Temperature));
+
+     Signal_Send(xvLedControlTask, Heater_Change_LED_BIT);
+     Deadline_JobCompleted();
+
+    }
+    } /*for*/
+ } /*function */
+
+
+
+void vLedControlTask(void *pvParameters)
+{
+    SeatState_t xSeatState;
+    (void)pvParameters;
+    for(;;)
+    {
+
+
+    if (Signal_WaitAll(Heater_Change_LED_BIT, portMAX_DELAY) != 0)
+        {
+            Deadline_JobStarted();
+            SeatState_Read(&xSeatState);
+
+            if(xSeatState.Driver.Heater==Offheat)
+            {
+                GPIO_BlueLedOff();
+                GPIO_GreenLedOff();
+            }
+            else if(xSeatState.Driver.Heater==Lowheat)
+            {
+                GPIO_GreenLedOn();
+            }
+            else if(xSeatState.Driver.Heater==Mediumheat)
+            {
+                GPIO_GreenLedOff();
+               GPIO_BlueLedOn();
+            }
+            else if (xSeatState.Driver.Heater==Highheat)
+            {
+                GPIO_GreenLedOn();
+                GPIO_BlueLedOn();
+            }
+            if(xSeatState.Passenger.Heater==Offheat)
+            {
+                GPIO_BlueLedOff();
+                GPIO_GreenLedOff();
+            }
+            else if(xSeatState.Passenger.Heater==Lowheat)
+            {
+                GPIO_GreenLedOn();
+            }
+            else if(xSeatState.Passenger.Heater==Mediumheat)
+            {
+                GPIO_GreenLedOff();
+                GPIO_BlueLedOn();
+            }
+            else if (xSeatState.Passenger.Heater==Highheat)
+            {
+                GPIO_GreenLedOn();
+                GPIO_BlueLedOn();
+            }
+            Deadline_JobCompleted();
+        }
+    }
+}
+
+
+void vDisplayTask (void *pvParameters)
+{
+        const Signals_t uSignalsToWaitFor = ( Current_Change_Display| Desired_Change_Display);
+        SeatState_t xSeatState;
+        (void)pvParameters;
+
+
+
+        for (;;)
+        {
+
+    /* Block until any of the change bits is set, the received bits are cleared. */
+          (void)Signal_WaitAny(uSignalsToWaitFor, portMAX_DELAY);
+          Deadline_JobStarted();
+
+          /* Both seats are displayed from the same snapshot */
+          SeatState_Read(&xSeatState);
+
+              UART0_SendString("Passenger Desired Temp =");
+              UART0_SendInteger(xSeatState.Passenger.Desired_Temperature);
+              UART0_SendString("\r\n");
+
+              UART0_SendString("Passenger Current Temp =");
+              UART0_SendInteger(xSeatState.Passenger.Current_Temperature);
+               UART0_SendString("\r\n");
+
+
+               if ( xSeatState.Passenger.Heater == Offheat)
+               {
+                   UART0_SendString("Passenger Heater Level OFF HEAT\r\n");
+
+               }
+               else if (xSeatState.Passenger.Heater ==Lowheat )
+               {
+                   UART0_SendString("Passenger Heater Level LOW HEAT\r\n");
+
+               }
+
+               else if (xSeatState.Passenger.Heater ==Mediumheat )
+               {
+                   UART0_SendString("Passenger Heater Level MEDIUM HEAT\r\n");
+
+                }
+               else if (xSeatState.Passenger.Heater == Highheat )
+               {
+                 UART0_SendString("Passenger Heater Level HIGH HEAT\r\n");
+
+               }
+
+
+              UART0_SendString("Driver Desired Temp =");
+              UART0_SendInteger(xSeatState.Driver.Desired_Temperature);
+              UART0_SendString("\r\n");
+
+                UART0_SendString("Driver Current Temp =");
+                UART0_SendInteger(xSeatState.Driver.Current_Temperature);
+                UART0_SendString("\r\n");
+
+
+              if ( xSeatState.Driver.Heater == Offheat)
+             {
+                 UART0_SendString("Driver Heater Level OFF HEAT\r\n");
+
+              }
+              else if (xSeatState.Driver.Heater ==Lowheat )
+                {
+                    UART0_SendString("Driver Heater Level LOW HEAT");
+
+               }
+
+              else if (xSeatState.Driver.Heater ==Mediumheat )
+               {
+                  UART0_SendString("Driver Heater Level MEDIUM HEAT");
+
+                  }
+                   else if (xSeatState.Driver.Heater == Highheat )
+                    {
+                   UART0_SendString("Driver Heater Level HIGH HEAT");
+
+                  }
+              Deadline_JobCompleted();
+
+              /* Block instead of busy waiting, the CPU is free for the idle task and the low power mode */
+              vTaskDelay(pdMS_TO_TICKS(mainDISPLAY_INTERVAL_MS));
+
+
+
+        }
+}
+void vDiagnosticsTask (void *pvParameters)
+{
+    SeatState_t xSeatState;
+    (void)pvParameters;
+    for(;;)
+    {
+        if (Signal_WaitAll(Temperature_Change_Diagnostics_BIT, portMAX_DELAY) != 0)
+        {
+               Deadline_JobStarted();
+               SeatState_Read(&xSeatState);
+
+               if(xSeatState.Passenger.Current_Temperature<5 || xSeatState.Passenger.Current_Temperature>40 || xSeatState.Driver.Current_Temperature<5 || xSeatState.Driver.Current_Temperature>40 )
+               {
+                   uint64 uTimestampMs=GPTM_WTimer0ReadUs()/1000;
+
+                    SeatState_SetHeaters(Offheat, Offheat);   /*Turn off both heaters*/
+
+                    GPIO_BlueLedOff();
+                    GPIO_GreenLedOff();
+
+                   GPIO_RedLedOn();
+                   UART0_SendString("Error Time stamp at:");
+                   UART0_SendInteger(uTimestampMs);
+                   UART0_SendString("\r\n");
+
+                   UART0_SendString("Driver Current Temp:");
+                   UART0_SendInteger(xSeatState.Driver.Current_Temperature);
+                   UART0_SendString("\r\n");
+
+                   UART0_SendString("Passenger Current Temp:");
+                   UART0_SendInteger(xSeatState.Passenger.Current_Temperature);
+                   UART0_SendString("\r\n");
+               }
+               else
+               {
+                   GPIO_RedLedOff();
+                   Signal_Send(xvHeatingControlTask, Diagnostics_Ok_Task_BIT);
+               }
+               Deadline_JobCompleted();
+      }
+    }
+}
+#if ( configAPP_KERNEL_BENCHMARK == 1 )
+/* Runs before the tasks of the table have blocked on a delay, then deletes itself */
+static void prvBenchmarkTask(void *pvParameters)
+{
+    (void)pvParameters;
+    Benchmark_Run();
+    vTaskDelete(NULL);
+}
+#endif
+
+
+#ifdef SIMULATION
+static void prvSimClockStep( void )
+{
+    (void)SimClock_Step(mainSIM_RUN_TIME_US);
+}
+
+/* Every task is blocked: move the virtual time to the next interrupt and raise it */
+void vApplicationIdleHook( void )
+{
+    if (SimClock_NowUs() < mainSIM_RUN_TIME_US)
+    {
+        vPortRunInterrupt(prvSimClockStep);
+    }
+    else
+    {
+        vTaskEndScheduler();
+    }
+}
+
+/* configASSERT of the SIMULATION build */
+void vAssertCalled( const char * pcFile, unsigned long ulLine )
+{
+    (void)fflush(stdout);
+    (void)fprintf(stderr, "Assertion failed at %s:%lu\n", pcFile, ulLine);
+    abort();
+}
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+/* Memory of the idle task, required by the kernel when static allocation is supported */
+void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                    StackType_t ** ppxIdleTaskStackBuffer,
+                                    uint32_t * pulIdleTaskStackSize )
+{
+    *ppxIdleTaskTCBBuffer = &xIdleTaskBuffer;
+    *ppxIdleTaskStackBuffer = xIdleTaskStack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+#if ( configUSE_TIMERS == 1 )
+/* Memory of the timer service task, its command queue is created static by the kernel */
+void vApplicationGetTimerTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer,
+                                     StackType_t ** ppxTimerTaskStackBuffer,
+                                     uint32_t * pulTimerTaskStackSize )
+{
+    *ppxTimerTaskTCBBuffer = &xTimerTaskBuffer;
+    *ppxTimerTaskStackBuffer = xTimerTaskStack;
+    *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+#endif
+#endif
+
+/*-----------------------------------------------------------*/
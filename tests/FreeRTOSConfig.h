@@ -0,0 +1,81 @@
+/*
+ * -------------------------------------------------------------------------
+ * Kernel configuration of the host tests (tests/CMakeLists.txt).
+ *
+ * The tests build the kernel on the POSIX port of the SIMULATION target with
+ * this file instead of the application one. The kernel options a test varies
+ * (configUSE_EDF_SCHEDULING, configUSE_TASK_TIMING_WHEEL...) are not set here,
+ * they keep the default of FreeRTOS.h unless the test target defines them.
+ * -------------------------------------------------------------------------
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/* Same clock and tick as the application, a tick is 10ms */
+#define configCPU_CLOCK_HZ                    (( unsigned long )16000000)
+#define configTICK_RATE_HZ                    ((TickType_t)100)
+
+#define configMINIMAL_STACK_SIZE              (128)
+#define configMAX_PRIORITIES                  (7)
+#define configUSE_PREEMPTION                  (1)
+#define configUSE_16_BIT_TICKS                0
+#define configEDF_PRIORITY                    ( configMAX_PRIORITIES - 2 )
+
+/* The heap is heap_2.c unless the test selects heap_tlsf.c */
+#define configSUPPORT_STATIC_ALLOCATION       1
+#define configSUPPORT_DYNAMIC_ALLOCATION      1
+#ifndef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE                 ((size_t)(65536))
+#endif
+
+#define INCLUDE_vTaskDelay                     1
+#define INCLUDE_vTaskDelete                    1
+#define INCLUDE_xTimerPendFunctionCall         1
+#define INCLUDE_xTaskDelayUntil                1
+#define INCLUDE_vTaskSuspend                   1
+#define INCLUDE_uxTaskPriorityGet              1
+#define INCLUDE_vTaskPrioritySet               1
+#define INCLUDE_xTaskGetCurrentTaskHandle      1
+#define configUSE_MUTEXES                      1
+#define configUSE_COUNTING_SEMAPHORES          1
+#define configUSE_TRACE_FACILITY               1
+
+#define configUSE_TIMERS                      1
+#define configTIMER_TASK_PRIORITY             (configMAX_PRIORITIES - 1)
+#ifndef configTIMER_QUEUE_LENGTH
+#define configTIMER_QUEUE_LENGTH              10
+#endif
+#define configTIMER_TASK_STACK_DEPTH          configMINIMAL_STACK_SIZE
+
+/* The idle hook of tests/test_support.c raises the tick whenever every task is
+ * blocked, so the time only passes while nothing is ready to run. */
+#define configUSE_IDLE_HOOK                   1
+#define configUSE_TICK_HOOK                   0
+
+/* A test of the tickless idle sets configUSE_TICKLESS_IDLE to 1 and runs the
+ * virtual clock of MCAL/SIM from its own idle hook, with the hooks of the
+ * application: WTimer1 measures the sleep and the DWT skips it. */
+#ifndef configUSE_TICKLESS_IDLE
+#define configUSE_TICKLESS_IDLE               0
+#endif
+
+#if ( configUSE_TICKLESS_IDLE == 1 )
+#include "GPTM.h"
+#include "DWT/dwt.h"
+#include "sim_clock.h"
+#define configUSE_LOW_POWER_TICKLESS_TIMER        1
+#define configLOW_POWER_TIMER_CLOCK_HZ            GPTM_SLEEP_TIMER_CLOCK_HZ
+#define configLOW_POWER_TIMER_INIT()              GPTM_WTimer1SleepTimerInit()
+#define configLOW_POWER_TIMER_START( ulCounts )   GPTM_WTimer1SleepStart( ulCounts )
+#define configLOW_POWER_TIMER_STOP()              DWT_CycleCounterSkip( GPTM_WTimer1SleepStop() )
+#define configTICK_TIMER_STOP()                   SimClock_TickStop()
+#define configTICK_TIMER_START( ulCounts )        SimClock_TickStart( ulCounts )
+#define configWAIT_FOR_INTERRUPT()                vPortRunInterrupt( SimClock_Sleep )
+#endif
+
+/* A failed assertion ends the test, see tests/test_support.c */
+void vAssertCalled( const char * pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) { vAssertCalled( __FILE__, __LINE__ ); }
+
+#endif /* FREERTOS_CONFIG_H */
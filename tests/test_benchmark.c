@@ -0,0 +1,114 @@
+/*
+ * Host run of the kernel micro-benchmarks (APP/BENCHMARK).
+ *
+ * The SIMULATION build of the benchmarks times the kernel calls with the
+ * monotonic clock of the host, so the CSV report can be produced and compared
+ * without the board.  The UART0 functions are replaced by ones that collect
+ * the report, which is then checked line by line: the header, every benchmark
+ * in the documented order, BENCHMARK_ITERATIONS samples each and
+ * min <= avg <= max.  The collected report is printed as it would appear on
+ * UART0, the ns themselves are host figures and not checked.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test_support.h"
+#include "uart0.h"
+#include "APP/BENCHMARK/benchmark.h"
+
+#define testREPORT_SIZE    2048U
+
+static const char * const pcNames[] =
+{
+    "task_switch",     "tick_increment",  "queue_send",      "queue_receive",
+    "queue_copy_4",    "queue_buffer_4",  "queue_copy_16",   "queue_buffer_16",
+    "queue_copy_64",   "queue_buffer_64", "queue_copy_256",  "queue_buffer_256",
+    "spsc_ring",       "semaphore_give",  "semaphore_take",  "event_group_set",
+    "event_group_wake", "semaphore_wake", "signal_wake",     "timer_reset"
+};
+
+static char cReport[ testREPORT_SIZE ];
+static size_t xReportLength = 0;
+
+/*-----------------------------------------------------------*/
+
+void UART0_SendByte( uint8 data )
+{
+    TEST_CHECK( xReportLength < ( testREPORT_SIZE - 1U ) );
+    cReport[ xReportLength++ ] = ( char ) data;
+}
+/*-----------------------------------------------------------*/
+
+void UART0_SendString( const uint8 * pData )
+{
+    while( *pData != '\0' )
+    {
+        UART0_SendByte( *pData++ );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void UART0_SendInteger( sint64 sNumber )
+{
+    char cNumber[ 24 ];
+
+    ( void ) snprintf( cNumber, sizeof( cNumber ), "%lld", ( long long ) sNumber );
+    UART0_SendString( ( const uint8 * ) cNumber );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckReport( void )
+{
+    char * pcLine;
+    char * pcNext;
+    char * pcField;
+    size_t xIndex;
+    unsigned long ulIterations, ulMin, ulAvg, ulMax;
+
+    cReport[ xReportLength ] = '\0';
+
+    pcLine = strtok_r( cReport, "\r\n", &pcNext );
+    TEST_CHECK( pcLine != NULL );
+    TEST_CHECK( strcmp( pcLine, "benchmark,iterations,min_ns,avg_ns,max_ns" ) == 0 );
+    ( void ) printf( "%s\n", pcLine );
+
+    for( xIndex = 0; xIndex < ( sizeof( pcNames ) / sizeof( pcNames[ 0 ] ) ); xIndex++ )
+    {
+        pcLine = strtok_r( NULL, "\r\n", &pcNext );
+        TEST_CHECK( pcLine != NULL );
+        ( void ) printf( "%s\n", pcLine );
+
+        pcField = strchr( pcLine, ',' );
+        TEST_CHECK( pcField != NULL );
+        *pcField = '\0';
+        TEST_CHECK( strcmp( pcLine, pcNames[ xIndex ] ) == 0 );
+
+        TEST_CHECK( sscanf( pcField + 1, "%lu,%lu,%lu,%lu", &ulIterations, &ulMin, &ulAvg, &ulMax ) == 4 );
+        TEST_CHECK( ulIterations == BENCHMARK_ITERATIONS );
+        TEST_CHECK( ( ulMin <= ulAvg ) && ( ulAvg <= ulMax ) );
+    }
+
+    TEST_CHECK( strtok_r( NULL, "\r\n", &pcNext ) == NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    Benchmark_Run();
+    prvCheckReport();
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    /* The timer benchmark needs the timer task at the priority of the caller. */
+    vTestRun( prvBenchmarkTask, configTIMER_TASK_PRIORITY );
+
+    return 0;
+}
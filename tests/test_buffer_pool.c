@@ -0,0 +1,474 @@
+/*
+ * Host test of the buffer pools and buffer queues (Source/buffer_pool.c).
+ *
+ * - Pool: the buffers of a static and of a dynamic pool are distinct, aligned
+ *   and of the rounded size, a take from an empty pool returns NULL, and the
+ *   free and minimum ever free counts follow the takes and gives.
+ * - Ownership: a writer task and a reader task of higher priority pass random
+ *   frames by pointer, the reader keeping some of them a while.  Each frame
+ *   carries a sequence number and a check word over its bytes, written by the
+ *   owner before the hand-off and checked by the next owner.  A send that
+ *   finds the queue full leaves the buffer with the writer, which gives it
+ *   back.  Every buffer is always in exactly one of the pool, the queue or the
+ *   hands of a task.
+ * - Interrupts: an interrupt takes a buffer, fills it and sends it, which
+ *   switches to the blocked reader when the handler returns, and an interrupt
+ *   gives back a buffer the task took.
+ *
+ * The cost part then sends and receives items of 4 bytes to 4 KB, by copy on
+ * an item queue and by pointer on a buffer queue with the take and give, and
+ * prints a CSV line for each:
+ *   queue_copy|queue_buffer,item bytes,host ns per item
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_support.h"
+#include "queue.h"
+#include "buffer_pool.h"
+
+#define testBUFFER_SIZE        100U
+#define testBUFFERS            8U
+#define testQUEUE_LENGTH       4U
+#define testKEPT               4U
+#define testFRAMES             20000U
+#define testISR_FRAMES         1000U
+
+/* Items of the cost part. */
+#define testCOST_SIZES         4U
+#define testCOST_ITERATIONS    20000U
+#define testCOST_MAX_SIZE      4096U
+
+/* The start of every frame, the data follows. */
+typedef struct
+{
+    uint32_t ulSequence;
+    uint32_t ulLength;
+    uint32_t ulCheck;
+} FrameHeader_t;
+
+static BufferPoolHandle_t xPool = NULL;
+static QueueHandle_t xQueue = NULL;
+static TaskHandle_t xReaderTask = NULL;
+
+static volatile uint32_t ulFramesReceived = 0;
+static volatile uint32_t ulFramesRead = 0;
+static volatile BaseType_t xReaderWaiting = pdFALSE;
+static volatile uint32_t ulFramesHeld = 0;
+static uint32_t ulNextSequence = 0;
+
+/* Data of the interrupt handlers. */
+static void * pvISRBuffer;
+static BaseType_t xISRWoken;
+
+static const uint32_t ulCostSizes[ testCOST_SIZES ] = { 4U, 256U, 1024U, testCOST_MAX_SIZE };
+static uint8_t ucItemIn[ testCOST_MAX_SIZE ];
+static uint8_t ucItemOut[ testCOST_MAX_SIZE ];
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x2545F491UL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNowNs( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvCheckWord( const FrameHeader_t * pxFrame )
+{
+    const uint8_t * pucData = ( const uint8_t * ) &( pxFrame[ 1 ] );
+    uint32_t ulCheck = pxFrame->ulSequence ^ 0xA5A5A5A5UL;
+    uint32_t ulIndex;
+
+    for( ulIndex = 0; ulIndex < pxFrame->ulLength; ulIndex++ )
+    {
+        ulCheck = ( ulCheck * 31U ) + pucData[ ulIndex ];
+    }
+
+    return ulCheck;
+}
+/*-----------------------------------------------------------*/
+
+/* Fills a frame of random length, the caller owns the buffer. */
+static void prvWriteFrame( FrameHeader_t * pxFrame )
+{
+    uint8_t * pucData = ( uint8_t * ) &( pxFrame[ 1 ] );
+    uint32_t ulIndex;
+
+    pxFrame->ulSequence = ulNextSequence++;
+    pxFrame->ulLength = prvRandom() % ( testBUFFER_SIZE - sizeof( FrameHeader_t ) + 1U );
+
+    for( ulIndex = 0; ulIndex < pxFrame->ulLength; ulIndex++ )
+    {
+        pucData[ ulIndex ] = ( uint8_t ) prvRandom();
+    }
+
+    pxFrame->ulCheck = prvCheckWord( pxFrame );
+}
+/*-----------------------------------------------------------*/
+
+/* Every buffer is free, queued or held by a task. */
+static void prvCheckCounts( void )
+{
+    TEST_CHECK( ( uxBufferPoolGetFreeCount( xPool ) + uxQueueMessagesWaiting( xQueue ) + ulFramesHeld ) == testBUFFERS );
+}
+/*-----------------------------------------------------------*/
+
+/* Gives a frame read back to the pool. */
+static void prvGiveFrame( FrameHeader_t * pxFrame )
+{
+    ( void ) memset( pxFrame, 0xEE, testBUFFER_SIZE );
+    ulFramesHeld--;
+    vBufferPoolGive( xPool, pxFrame );
+    ulFramesRead++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReaderTask( void * pvParameters )
+{
+    FrameHeader_t * pxKept[ testKEPT + 1U ];
+    FrameHeader_t * pxFrame;
+    uint32_t ulKept = 0, ulExpected = 0, ulTarget;
+
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        pxFrame = NULL;
+
+        if( xBufferQueueReceive( xQueue, ( void ** ) &pxFrame, 0 ) != pdPASS )
+        {
+            /* Nothing to read, what is kept goes back before blocking. */
+            while( ulKept > 0U )
+            {
+                prvGiveFrame( pxKept[ --ulKept ] );
+            }
+
+            xReaderWaiting = pdTRUE;
+            TEST_CHECK( xBufferQueueReceive( xQueue, ( void ** ) &pxFrame, portMAX_DELAY ) == pdPASS );
+            xReaderWaiting = pdFALSE;
+        }
+
+        ulFramesReceived++;
+        ulFramesHeld++;
+
+        /* The frames come in the order they were sent, as written. */
+        TEST_CHECK( pxFrame != NULL );
+        TEST_CHECK( pxFrame->ulSequence == ulExpected );
+        TEST_CHECK( pxFrame->ulCheck == prvCheckWord( pxFrame ) );
+        ulExpected = pxFrame->ulSequence + 1U;
+        prvCheckCounts();
+
+        /* The reader keeps a few frames a while, the writer then finds the
+         * queue full or the pool empty. */
+        pxKept[ ulKept++ ] = pxFrame;
+        ulTarget = prvRandom() % ( testKEPT + 1U );
+
+        while( ulKept > ulTarget )
+        {
+            prvGiveFrame( pxKept[ --ulKept ] );
+        }
+
+        if( ( prvRandom() % 4U ) == 0U )
+        {
+            vTaskDelay( 1 );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Waits until the reader gave back what it kept and blocked on the queue. */
+static void prvWaitForReader( void )
+{
+    while( xReaderWaiting == pdFALSE )
+    {
+        vTaskDelay( 1 );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPool( BufferPoolHandle_t xTestPool,
+                         size_t xBufferSize,
+                         UBaseType_t uxBufferCount )
+{
+    void * pvBuffers[ testBUFFERS ];
+    void * pvTaken[ testBUFFERS ];
+    UBaseType_t uxIndex, uxOther;
+
+    TEST_CHECK( xTestPool != NULL );
+    TEST_CHECK( xBufferPoolGetBufferSize( xTestPool ) == bufferpoolBUFFER_SIZE( xBufferSize ) );
+    TEST_CHECK( xBufferPoolGetBufferSize( xTestPool ) >= xBufferSize );
+    TEST_CHECK( uxBufferPoolGetFreeCount( xTestPool ) == uxBufferCount );
+
+    for( uxIndex = 0; uxIndex < uxBufferCount; uxIndex++ )
+    {
+        pvBuffers[ uxIndex ] = ( ( uxIndex % 2U ) == 0U ) ? pvBufferPoolTake( xTestPool ) : pvBufferPoolTakeFromISR( xTestPool );
+        TEST_CHECK( pvBuffers[ uxIndex ] != NULL );
+        TEST_CHECK( ( ( uintptr_t ) pvBuffers[ uxIndex ] & ( uintptr_t ) portBYTE_ALIGNMENT_MASK ) == 0U );
+        TEST_CHECK( uxBufferPoolGetFreeCount( xTestPool ) == ( uxBufferCount - uxIndex - 1U ) );
+
+        /* The whole buffer is usable, and overlaps no other. */
+        ( void ) memset( pvBuffers[ uxIndex ], ( int ) uxIndex, xBufferPoolGetBufferSize( xTestPool ) );
+
+        for( uxOther = 0; uxOther < uxIndex; uxOther++ )
+        {
+            TEST_CHECK( ( ( uint8_t * ) pvBuffers[ uxIndex ] >= ( ( uint8_t * ) pvBuffers[ uxOther ] + xBufferPoolGetBufferSize( xTestPool ) ) ) ||
+                        ( ( uint8_t * ) pvBuffers[ uxOther ] >= ( ( uint8_t * ) pvBuffers[ uxIndex ] + xBufferPoolGetBufferSize( xTestPool ) ) ) );
+        }
+    }
+
+    TEST_CHECK( pvBufferPoolTake( xTestPool ) == NULL );
+    TEST_CHECK( pvBufferPoolTakeFromISR( xTestPool ) == NULL );
+    TEST_CHECK( uxBufferPoolGetMinimumEverFreeCount( xTestPool ) == 0U );
+
+    for( uxIndex = 0; uxIndex < uxBufferCount; uxIndex++ )
+    {
+        TEST_CHECK( *( ( uint8_t * ) pvBuffers[ uxIndex ] ) == ( uint8_t ) uxIndex );
+
+        if( ( uxIndex % 2U ) == 0U )
+        {
+            vBufferPoolGive( xTestPool, pvBuffers[ uxIndex ] );
+        }
+        else
+        {
+            vBufferPoolGiveFromISR( xTestPool, pvBuffers[ uxIndex ] );
+        }
+    }
+
+    TEST_CHECK( uxBufferPoolGetFreeCount( xTestPool ) == uxBufferCount );
+    TEST_CHECK( uxBufferPoolGetMinimumEverFreeCount( xTestPool ) == 0U );
+
+    /* Every buffer given back is taken again, each once. */
+    for( uxIndex = 0; uxIndex < uxBufferCount; uxIndex++ )
+    {
+        pvTaken[ uxIndex ] = pvBufferPoolTake( xTestPool );
+
+        for( uxOther = 0; uxOther < uxIndex; uxOther++ )
+        {
+            TEST_CHECK( pvTaken[ uxIndex ] != pvTaken[ uxOther ] );
+        }
+
+        for( uxOther = 0; uxOther < uxBufferCount; uxOther++ )
+        {
+            if( pvTaken[ uxIndex ] == pvBuffers[ uxOther ] )
+            {
+                break;
+            }
+        }
+
+        TEST_CHECK( uxOther < uxBufferCount );
+    }
+
+    TEST_CHECK( pvBufferPoolTake( xTestPool ) == NULL );
+
+    for( uxIndex = 0; uxIndex < uxBufferCount; uxIndex++ )
+    {
+        vBufferPoolGive( xTestPool, pvTaken[ uxIndex ] );
+    }
+
+    vBufferPoolDelete( xTestPool );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestOwnership( void )
+{
+    FrameHeader_t * pxFrame;
+    uint32_t ulFrame, ulFull = 0, ulEmpty = 0;
+
+    for( ulFrame = 0; ulFrame < testFRAMES; ulFrame++ )
+    {
+        pxFrame = ( FrameHeader_t * ) pvBufferPoolTake( xPool );
+
+        if( pxFrame == NULL )
+        {
+            /* Every buffer is queued or kept by the reader. */
+            ulEmpty++;
+            prvCheckCounts();
+            vTaskDelay( 1 );
+            continue;
+        }
+
+        ulFramesHeld++;
+        prvWriteFrame( pxFrame );
+        prvCheckCounts();
+
+        /* The reader may run before the send returns, it then holds the
+         * frame. */
+        ulFramesHeld--;
+
+        if( xBufferQueueSend( xQueue, pxFrame, 0 ) != pdPASS )
+        {
+            /* Still the writer's, the frame is dropped and its sequence
+             * number used again.  The writer then waits for the reader. */
+            ulFull++;
+            TEST_CHECK( pxFrame->ulCheck == prvCheckWord( pxFrame ) );
+            ulNextSequence--;
+            vBufferPoolGive( xPool, pxFrame );
+            vTaskDelay( 1 );
+        }
+
+        prvCheckCounts();
+    }
+
+    prvWaitForReader();
+    TEST_CHECK( ulFramesRead == ulNextSequence );
+    TEST_CHECK( uxBufferPoolGetFreeCount( xPool ) == testBUFFERS );
+    TEST_CHECK( ( ulFull > 0U ) && ( ulEmpty > 0U ) );
+
+    ( void ) printf( "%lu frames passed by pointer, %lu sends found the queue full, %lu takes the pool empty\n",
+                     ( unsigned long ) ulFramesRead, ( unsigned long ) ulFull, ( unsigned long ) ulEmpty );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSendFromISR( void )
+{
+    xISRWoken = pdFALSE;
+    pvISRBuffer = pvBufferPoolTakeFromISR( xPool );
+    TEST_CHECK( pvISRBuffer != NULL );
+    prvWriteFrame( ( FrameHeader_t * ) pvISRBuffer );
+    TEST_CHECK( xBufferQueueSendFromISR( xQueue, pvISRBuffer, &xISRWoken ) == pdPASS );
+    portYIELD_FROM_ISR( xISRWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvGiveFromISR( void )
+{
+    vBufferPoolGiveFromISR( xPool, pvISRBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestFromISR( void )
+{
+    uint32_t ulFrame, ulReceived;
+    UBaseType_t uxFree;
+
+    for( ulFrame = 0; ulFrame < testISR_FRAMES; ulFrame++ )
+    {
+        prvWaitForReader();
+
+        /* The reader, blocked on the empty queue, runs as the handler
+         * returns, before this task runs again. */
+        ulReceived = ulFramesReceived;
+        vPortRunInterrupt( prvSendFromISR );
+        TEST_CHECK( xISRWoken != pdFALSE );
+        TEST_CHECK( ulFramesReceived == ( ulReceived + 1U ) );
+
+        /* Once it blocks again it gave the buffer back. */
+        prvWaitForReader();
+        TEST_CHECK( uxBufferPoolGetFreeCount( xPool ) == testBUFFERS );
+
+        /* A buffer an interrupt takes and gives back. */
+        uxFree = uxBufferPoolGetFreeCount( xPool );
+        pvISRBuffer = pvBufferPoolTake( xPool );
+        TEST_CHECK( pvISRBuffer != NULL );
+        vPortRunInterrupt( prvGiveFromISR );
+        TEST_CHECK( uxBufferPoolGetFreeCount( xPool ) == uxFree );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureCost( uint32_t ulSize )
+{
+    QueueHandle_t xItemQueue, xBufferQueue;
+    BufferPoolHandle_t xCostPool;
+    void * pvBuffer;
+    uint64_t ullCopyNs, ullBufferNs;
+    uint32_t ulIteration;
+
+    xItemQueue = xQueueCreate( 1, ulSize );
+    xBufferQueue = xBufferQueueCreate( 1 );
+    xCostPool = xBufferPoolCreate( ulSize, 1 );
+    TEST_CHECK( ( xItemQueue != NULL ) && ( xBufferQueue != NULL ) && ( xCostPool != NULL ) );
+
+    ullCopyNs = prvNowNs();
+
+    for( ulIteration = 0; ulIteration < testCOST_ITERATIONS; ulIteration++ )
+    {
+        ucItemIn[ 0 ] = ( uint8_t ) ulIteration;
+        ( void ) xQueueSend( xItemQueue, ucItemIn, 0 );
+        ( void ) xQueueReceive( xItemQueue, ucItemOut, 0 );
+    }
+
+    ullCopyNs = prvNowNs() - ullCopyNs;
+    TEST_CHECK( ucItemOut[ 0 ] == ( uint8_t ) ( testCOST_ITERATIONS - 1U ) );
+
+    ullBufferNs = prvNowNs();
+
+    for( ulIteration = 0; ulIteration < testCOST_ITERATIONS; ulIteration++ )
+    {
+        pvBuffer = pvBufferPoolTake( xCostPool );
+        *( ( uint8_t * ) pvBuffer ) = ( uint8_t ) ulIteration;
+        ( void ) xBufferQueueSend( xBufferQueue, pvBuffer, 0 );
+        ( void ) xBufferQueueReceive( xBufferQueue, &pvBuffer, 0 );
+        ucItemOut[ 0 ] = *( ( uint8_t * ) pvBuffer );
+        vBufferPoolGive( xCostPool, pvBuffer );
+    }
+
+    ullBufferNs = prvNowNs() - ullBufferNs;
+    TEST_CHECK( ucItemOut[ 0 ] == ( uint8_t ) ( testCOST_ITERATIONS - 1U ) );
+
+    ( void ) printf( "queue_copy,%lu,%lu\n", ( unsigned long ) ulSize, ( unsigned long ) ( ullCopyNs / testCOST_ITERATIONS ) );
+    ( void ) printf( "queue_buffer,%lu,%lu\n", ( unsigned long ) ulSize, ( unsigned long ) ( ullBufferNs / testCOST_ITERATIONS ) );
+
+    vQueueDelete( xItemQueue );
+    vQueueDelete( xBufferQueue );
+    vBufferPoolDelete( xCostPool );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTask( void * pvParameters )
+{
+    static uint64_t ullStorage[ bufferpoolSTORAGE_SIZE( 20U, testBUFFERS ) / sizeof( uint64_t ) ];
+    static StaticBufferPool_t xStaticPool;
+    uint32_t ulIndex;
+
+    ( void ) pvParameters;
+
+    prvTestPool( xBufferPoolCreateStatic( 20U, testBUFFERS, ( uint8_t * ) ullStorage, &xStaticPool ), 20U, testBUFFERS );
+    prvTestPool( xBufferPoolCreate( 1U, 3U ), 1U, 3U );
+    prvTestPool( xBufferPoolCreate( testBUFFER_SIZE, testBUFFERS ), testBUFFER_SIZE, testBUFFERS );
+
+    xPool = xBufferPoolCreate( testBUFFER_SIZE, testBUFFERS );
+    xQueue = xBufferQueueCreate( testQUEUE_LENGTH );
+    TEST_CHECK( ( xPool != NULL ) && ( xQueue != NULL ) );
+
+    /* The reader runs at once and blocks on the empty queue. */
+    TEST_CHECK( xTaskCreate( prvReaderTask, "Reader", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &xReaderTask ) == pdPASS );
+
+    prvTestOwnership();
+    prvTestFromISR();
+
+    vTaskDelete( xReaderTask );
+    vQueueDelete( xQueue );
+    vBufferPoolDelete( xPool );
+
+    for( ulIndex = 0; ulIndex < testCOST_SIZES; ulIndex++ )
+    {
+        prvMeasureCost( ulCostSizes[ ulIndex ] );
+    }
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    vTestRun( prvTestTask, tskIDLE_PRIORITY + 1 );
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+/*
+ * Response time statistics of the deadline monitor (APP/DEADLINE) on the
+ * WTimer0 of MCAL/SIM.
+ *
+ * The monitored task is created but never runs: before the scheduler starts
+ * it is the current task of the kernel, so main() marks its jobs for it.  The
+ * test stands in for the kernel and calls the ready hook, and the virtual
+ * clock, with the kernel tick stopped, times each job.  It checks:
+ *   - a response on each edge of the quarters of the deadline lands in the
+ *     bin ( response - 1 ) / quarter, a response of 0 in the first,
+ *   - the responses over the deadline count as misses, the last bin takes
+ *     every one past 7/4 of the deadline,
+ *   - the maximum lateness is the one of the latest job, negative when every
+ *     job of the window met its deadline,
+ *   - a job is released the last time the task was ready before it started,
+ *     one not released is not counted, and a job across the wrap of the 32
+ *     bit timestamp is timed right,
+ *   - Deadline_TakeWindow() starts a new window, and clears the statistics of
+ *     a task that is not monitored.
+ *
+ * It prints a CSV line of the histogram of the edge window:
+ *   deadline,jobs,misses,max lateness us,bin 0,...,bin 7
+ */
+
+#include <stdio.h>
+
+#include "test_support.h"
+#include "sim_clock.h"
+#include "sim_hw.h"
+#include "GPTM.h"
+#include "APP/DEADLINE/deadline.h"
+
+#define testDEADLINE_US    1000U
+#define testQUARTER_US     ( testDEADLINE_US / 4U )
+#define testWRAP_US        0x100000000ULL
+
+/* Response times of the edge window, on both sides of every bin edge. */
+static const uint32 ulResponses[] =
+{
+    0U, 1U,
+    testQUARTER_US, testQUARTER_US + 1U,
+    2U * testQUARTER_US, ( 2U * testQUARTER_US ) + 1U,
+    3U * testQUARTER_US, ( 3U * testQUARTER_US ) + 1U,
+    testDEADLINE_US, testDEADLINE_US + 1U,
+    5U * testQUARTER_US, ( 5U * testQUARTER_US ) + 1U,
+    6U * testQUARTER_US, ( 6U * testQUARTER_US ) + 1U,
+    7U * testQUARTER_US, ( 7U * testQUARTER_US ) + 1U,
+    8U * testQUARTER_US, 1000U * testDEADLINE_US
+};
+
+static const uint32 ulExpectedBins[ DEADLINE_HISTOGRAM_BINS ] = { 3U, 2U, 2U, 2U, 2U, 2U, 2U, 3U };
+
+#define testRESPONSES    ( sizeof( ulResponses ) / sizeof( ulResponses[ 0 ] ) )
+#define testMISSES       9U
+
+static TaskHandle_t xTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+/* Port F interrupt of MCAL/SIM, no edge is scripted. */
+void GPIOPortF_Handler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+/* Only the current task of the kernel, the scheduler is never started. */
+static void prvMonitoredTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunTo( uint64_t ullUntilUs )
+{
+    while( SimClock_NowUs() < ullUntilUs )
+    {
+        ( void ) SimClock_Step( ullUntilUs );
+    }
+
+    TEST_CHECK( GPTM_WTimer0ReadUs() == ullUntilUs );
+}
+/*-----------------------------------------------------------*/
+
+/* A job released at ullReleaseUs that responds ulResponseUs later.  An older
+ * wake comes first, the job starts a little after its release. */
+static void prvJob( uint64_t ullReleaseUs,
+                    uint32 ulResponseUs )
+{
+    prvRunTo( ullReleaseUs - 50ULL );
+    Deadline_TaskReady( xTask );
+    prvRunTo( ullReleaseUs );
+    Deadline_TaskReady( xTask );
+
+    if( ulResponseUs > 0U )
+    {
+        prvRunTo( ullReleaseUs + 1ULL );
+    }
+
+    Deadline_JobStarted();
+    prvRunTo( ullReleaseUs + ulResponseUs );
+    Deadline_JobCompleted();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    DeadlineStats_t xStats;
+    uint64_t ullReleaseUs = 10000ULL;
+    uint32_t ulIndex;
+
+    SimHw_Init();
+    SimClock_Init( NULL, 0 );
+    ( void ) SimClock_TickStop();
+    GPTM_WTimer0Init();
+
+    TEST_CHECK( xTaskCreate( prvMonitoredTask, "Monitored", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xTask ) == pdPASS );
+    TEST_CHECK( xTaskGetCurrentTaskHandle() == xTask );
+    TEST_CHECK( Deadline_Register( xTask, testDEADLINE_US ) == TRUE );
+
+    /* Not released since it was registered: neither job is counted. */
+    Deadline_JobStarted();
+    prvRunTo( 5000ULL );
+    Deadline_JobCompleted();
+    Deadline_JobCompleted();
+    TEST_CHECK( Deadline_TakeWindow( xTask, &xStats ) == TRUE );
+    TEST_CHECK( xStats.Jobs == 0U );
+
+    /* Edge window: one job per response, far enough apart not to overlap. */
+    for( ulIndex = 0; ulIndex < testRESPONSES; ulIndex++ )
+    {
+        prvJob( ullReleaseUs, ulResponses[ ulIndex ] );
+        ullReleaseUs += ( uint64_t ) ulResponses[ ulIndex ] + 10000ULL;
+    }
+
+    TEST_CHECK( Deadline_TakeWindow( xTask, &xStats ) == TRUE );
+
+    ( void ) printf( "deadline,%lu,%lu,%ld",
+                     ( unsigned long ) xStats.Jobs,
+                     ( unsigned long ) xStats.Misses,
+                     ( long ) xStats.MaxLatenessUs );
+
+    for( ulIndex = 0; ulIndex < DEADLINE_HISTOGRAM_BINS; ulIndex++ )
+    {
+        ( void ) printf( ",%lu", ( unsigned long ) xStats.Histogram[ ulIndex ] );
+    }
+
+    ( void ) printf( "\n" );
+
+    TEST_CHECK( xStats.Jobs == testRESPONSES );
+    TEST_CHECK( xStats.Misses == testMISSES );
+    TEST_CHECK( xStats.MaxLatenessUs == ( sint32 ) ( ( 1000U * testDEADLINE_US ) - testDEADLINE_US ) );
+
+    for( ulIndex = 0; ulIndex < DEADLINE_HISTOGRAM_BINS; ulIndex++ )
+    {
+        TEST_CHECK( xStats.Histogram[ ulIndex ] == ulExpectedBins[ ulIndex ] );
+    }
+
+    /* The window was taken, the next starts empty. */
+    TEST_CHECK( Deadline_TakeWindow( xTask, &xStats ) == TRUE );
+    TEST_CHECK( xStats.Jobs == 0U );
+    TEST_CHECK( xStats.Histogram[ DEADLINE_HISTOGRAM_BINS - 1U ] == 0U );
+
+    /* Every job met its deadline: the lateness is the largest, still negative.
+     * The second job straddles the wrap of the 32 bit timestamp. */
+    prvJob( ullReleaseUs, 600U );
+    prvJob( testWRAP_US - 100ULL, testDEADLINE_US - 100U );
+    prvJob( testWRAP_US + 10000ULL, 400U );
+
+    TEST_CHECK( Deadline_TakeWindow( xTask, &xStats ) == TRUE );
+    TEST_CHECK( xStats.Jobs == 3U );
+    TEST_CHECK( xStats.Misses == 0U );
+    TEST_CHECK( xStats.MaxLatenessUs == -100 );
+    TEST_CHECK( xStats.Histogram[ 1 ] == 1U );
+    TEST_CHECK( xStats.Histogram[ 2 ] == 1U );
+    TEST_CHECK( xStats.Histogram[ 3 ] == 1U );
+
+    /* A task that is not monitored has no window. */
+    xStats.Jobs = 1U;
+    TEST_CHECK( Deadline_TakeWindow( ulResponses, &xStats ) == FALSE );
+    TEST_CHECK( xStats.Jobs == 0U );
+
+    return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Debouncing of the Port F buttons (APP/DEBOUNCE) on the virtual clock of
+ * MCAL/SIM.
+ *
+ * Bouncing presses and releases of both buttons are scripted on the virtual
+ * clock, which runs from main() with the kernel tick stopped, so only the
+ * button edges and the WTimer0 compare move it.  The events are sent as
+ * signals to a receiver task that is created but never runs: after every
+ * step of the clock the test takes its notification value and records which
+ * signals were raised, at which virtual time and by which interrupt.  The
+ * record must match the expected events exactly:
+ *   - a bouncing press or release gives one event, DEBOUNCE_WINDOW_US after
+ *     its first edge,
+ *   - a bounce back to the settled level gives none,
+ *   - a press held for DEBOUNCE_LONG_PRESS_US gives a long press event, timed
+ *     from the press edge,
+ *   - both buttons in overlapping windows each get their own event,
+ *   - an edge at the very time the window of the other button ends finds the
+ *     compare deadline already passed in Debounce_Arm(), which serves that
+ *     button from the Port F interrupt instead of the WTimer0 interrupt.
+ */
+
+#include <stdio.h>
+
+#include "test_support.h"
+#include "sim_clock.h"
+#include "sim_hw.h"
+#include "GPTM.h"
+#include "APP/DEBOUNCE/debounce.h"
+
+#define testSW1_PRESS         0x01U
+#define testSW1_LONG_PRESS    0x02U
+#define testSW1_RELEASE       0x04U
+#define testSW2_PRESS         0x10U
+#define testSW2_LONG_PRESS    0x20U
+#define testSW2_RELEASE       0x40U
+
+#define testW                 DEBOUNCE_WINDOW_US
+#define testL                 DEBOUNCE_LONG_PRESS_US
+
+/* Start of each scenario, far enough apart that none overlaps the next. */
+#define testT_WINDOW          100000ULL
+#define testT_SAME_LEVEL      1000000ULL
+#define testT_LONG_PRESS      2000000ULL
+#define testT_OVERLAP         5000000ULL
+#define testT_PAST_DEADLINE   7000000ULL
+#define testT_END             8000000ULL
+
+#define testPRESS( t, pin )      { ( t ), SIM_EVENT_BUTTON, ( pin ), 1U }
+#define testRELEASE( t, pin )    { ( t ), SIM_EVENT_BUTTON, ( pin ), 0U }
+
+#define testSW1    SIM_HW_SW1_PIN
+#define testSW2    SIM_HW_SW2_PIN
+
+typedef struct
+{
+    uint64_t ullTimeUs;
+    uint32_t ulSignals;
+    SimEventType_t eRaisedBy;
+} Event_t;
+
+static const SimEvent_t xScript[] =
+{
+    /* Window: the bounces after the first edge are masked, the level is read
+     * once, testW after the first edge, for the press and for the release. */
+    testPRESS( testT_WINDOW, testSW1 ),
+    testRELEASE( testT_WINDOW + 300ULL, testSW1 ),
+    testPRESS( testT_WINDOW + 900ULL, testSW1 ),
+    testRELEASE( testT_WINDOW + 1500ULL, testSW1 ),
+    testPRESS( testT_WINDOW + 2000ULL, testSW1 ),
+    testRELEASE( testT_WINDOW + 200000ULL, testSW1 ),
+    testPRESS( testT_WINDOW + 200400ULL, testSW1 ),
+    testRELEASE( testT_WINDOW + 200700ULL, testSW1 ),
+
+    /* Same level: a glitch that is over before the window ends. */
+    testPRESS( testT_SAME_LEVEL, testSW2 ),
+    testRELEASE( testT_SAME_LEVEL + 500ULL, testSW2 ),
+
+    /* Long press: held 1.5 s, the long press comes testL after the press edge. */
+    testPRESS( testT_LONG_PRESS, testSW2 ),
+    testRELEASE( testT_LONG_PRESS + 1500000ULL, testSW2 ),
+
+    /* Overlap: SW2 is pressed while SW1 is still settling, and released while
+     * SW1 is. */
+    testPRESS( testT_OVERLAP, testSW1 ),
+    testRELEASE( testT_OVERLAP + 100ULL, testSW1 ),
+    testPRESS( testT_OVERLAP + 200ULL, testSW1 ),
+    testPRESS( testT_OVERLAP + 5000ULL, testSW2 ),
+    testRELEASE( testT_OVERLAP + 300000ULL, testSW1 ),
+    testRELEASE( testT_OVERLAP + 310000ULL, testSW2 ),
+
+    /* Past deadline: the SW2 edge comes at the end of the SW1 window, the
+     * scripted event is raised before the compare of the same time. */
+    testPRESS( testT_PAST_DEADLINE, testSW1 ),
+    testPRESS( testT_PAST_DEADLINE + testW, testSW2 ),
+    testRELEASE( testT_PAST_DEADLINE + 400000ULL, testSW1 ),
+    testRELEASE( testT_PAST_DEADLINE + 410000ULL, testSW2 ),
+};
+
+static const Event_t xExpected[] =
+{
+    { testT_WINDOW + testW,                      testSW1_PRESS,      SIM_EVENT_TIMER  },
+    { testT_WINDOW + 200000ULL + testW,          testSW1_RELEASE,    SIM_EVENT_TIMER  },
+    { testT_LONG_PRESS + testW,                  testSW2_PRESS,      SIM_EVENT_TIMER  },
+    { testT_LONG_PRESS + testL,                  testSW2_LONG_PRESS, SIM_EVENT_TIMER  },
+    { testT_LONG_PRESS + 1500000ULL + testW,     testSW2_RELEASE,    SIM_EVENT_TIMER  },
+    { testT_OVERLAP + testW,                     testSW1_PRESS,      SIM_EVENT_TIMER  },
+    { testT_OVERLAP + 5000ULL + testW,           testSW2_PRESS,      SIM_EVENT_TIMER  },
+    { testT_OVERLAP + 300000ULL + testW,         testSW1_RELEASE,    SIM_EVENT_TIMER  },
+    { testT_OVERLAP + 310000ULL + testW,         testSW2_RELEASE,    SIM_EVENT_TIMER  },
+    { testT_PAST_DEADLINE + testW,               testSW1_PRESS,      SIM_EVENT_BUTTON },
+    { testT_PAST_DEADLINE + testW + testW,       testSW2_PRESS,      SIM_EVENT_TIMER  },
+    { testT_PAST_DEADLINE + 400000ULL + testW,   testSW1_RELEASE,    SIM_EVENT_TIMER  },
+    { testT_PAST_DEADLINE + 410000ULL + testW,   testSW2_RELEASE,    SIM_EVENT_TIMER  },
+};
+
+#define testSCRIPT_LENGTH    ( sizeof( xScript ) / sizeof( xScript[ 0 ] ) )
+#define testEXPECTED         ( sizeof( xExpected ) / sizeof( xExpected[ 0 ] ) )
+
+static TaskHandle_t xReceiver = NULL;
+
+static const DebounceButton_t xButtons[ DEBOUNCE_BUTTONS ] =
+{
+    { &xReceiver, testSW1_PRESS, testSW1_LONG_PRESS, testSW1_RELEASE },
+    { &xReceiver, testSW2_PRESS, testSW2_LONG_PRESS, testSW2_RELEASE }
+};
+
+/*-----------------------------------------------------------*/
+
+/* Only holds the signals, the scheduler is never started. */
+static void prvReceiverTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    Event_t xEvents[ testEXPECTED + 1U ];
+    uint32_t ulEvents = 0, ulSignals, ulIndex;
+    SimEventType_t eRaised;
+
+    SimHw_Init();
+    SimClock_Init( xScript, testSCRIPT_LENGTH );
+    ( void ) SimClock_TickStop();
+    GPTM_WTimer0Init();
+
+    TEST_CHECK( xTaskCreate( prvReceiverTask, "Receiver", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &xReceiver ) == pdPASS );
+    Debounce_Init( xButtons );
+
+    while( SimClock_NowUs() < testT_END )
+    {
+        eRaised = SimClock_Step( testT_END );
+        ulSignals = ulTaskNotifyValueClear( xReceiver, 0xFFFFFFFFUL );
+
+        if( ulSignals != 0U )
+        {
+            TEST_CHECK( ulEvents < ( testEXPECTED + 1U ) );
+            xEvents[ ulEvents ].ullTimeUs = SimClock_NowUs();
+            xEvents[ ulEvents ].ulSignals = ulSignals;
+            xEvents[ ulEvents ].eRaisedBy = eRaised;
+            ulEvents++;
+        }
+    }
+
+    for( ulIndex = 0; ulIndex < ulEvents; ulIndex++ )
+    {
+        ( void ) printf( "debounce,%lu,0x%02lx,%s\n",
+                         ( unsigned long ) xEvents[ ulIndex ].ullTimeUs,
+                         ( unsigned long ) xEvents[ ulIndex ].ulSignals,
+                         ( xEvents[ ulIndex ].eRaisedBy == SIM_EVENT_BUTTON ) ? "port_f" : "wtimer0" );
+    }
+
+    TEST_CHECK( ulEvents == testEXPECTED );
+
+    for( ulIndex = 0; ulIndex < testEXPECTED; ulIndex++ )
+    {
+        TEST_CHECK( xEvents[ ulIndex ].ullTimeUs == xExpected[ ulIndex ].ullTimeUs );
+        TEST_CHECK( xEvents[ ulIndex ].ulSignals == xExpected[ ulIndex ].ulSignals );
+        TEST_CHECK( xEvents[ ulIndex ].eRaisedBy == xExpected[ ulIndex ].eRaisedBy );
+    }
+
+    TEST_CHECK( SimHw_Overflowed() == FALSE );
+
+    return 0;
+}
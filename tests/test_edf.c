@@ -0,0 +1,298 @@
+/*
+ * Earliest deadline first against deadline monotonic priorities, both run by
+ * the kernel (configUSE_EDF_SCHEDULING).
+ *
+ * Four periodic tasks with non-harmonic periods and implicit deadlines run one
+ * hyperperiod per trial, released together.  Each job executes by raising its
+ * execution time in ticks itself (vTestTicks()), so the releases of the other
+ * tasks preempt it exactly where the tick would on the target.  The execution
+ * times are scaled up from trial to trial, and every trial is run twice: once
+ * with the tasks at deadline monotonic priorities, once all at
+ * configEDF_PRIORITY with their deadlines set.
+ *
+ * The deadline misses of each trial must be the ones the theory predicts:
+ * under deadline monotonic priorities where the response time analysis fails,
+ * under EDF only once the utilisation exceeds 1.  Where EDF meets every
+ * deadline, every tick of an EDF job also checks the ready list of the kernel:
+ * the running job has the deadline of its release, and no other released job
+ * has an earlier one.
+ */
+
+#include <stdio.h>
+
+#include "test_support.h"
+#include "semphr.h"
+
+#define testTASKS          4U
+
+/* Periods in ticks, their hyperperiod, and the share of the utilisation of
+ * each task in percent. */
+#define testHYPERPERIOD    1260U
+#define testSHARE          25U
+
+/* Utilisations of the trials in percent. */
+#define testFIRST_STEP     70U
+#define testLAST_STEP      110U
+#define testSTEP           2U
+
+typedef struct
+{
+    TickType_t xPeriod;    /* Also the relative deadline. */
+    TickType_t xExecution; /* Ticks executed by each job. */
+    volatile UBaseType_t uxJobsDone;
+    TaskHandle_t xHandle;
+} PeriodicTask_t;
+
+static PeriodicTask_t xTasks[ testTASKS ] =
+{
+    { 20U, 0U, 0U, NULL },
+    { 28U, 0U, 0U, NULL },
+    { 45U, 0U, 0U, NULL },
+    { 63U, 0U, 0U, NULL }
+};
+
+/* Execution times of a utilisation of exactly 1. */
+static const TickType_t xFullUtilisation[ testTASKS ] = { 5U, 9U, 10U, 13U };
+
+static SemaphoreHandle_t xTasksDone = NULL;
+static TickType_t xTrialStart;
+static BaseType_t xTrialCheckOrder;
+static volatile uint32_t ulTrialMisses;
+
+/*-----------------------------------------------------------*/
+
+/* The running EDF job is the one the ready list must put first. */
+static void prvCheckOrder( const PeriodicTask_t * pxTask )
+{
+    const TickType_t xNow = xTaskGetTickCount();
+    const TickType_t xDeadline = xTrialStart + ( ( pxTask->uxJobsDone + 1U ) * pxTask->xPeriod );
+    const PeriodicTask_t * pxOther;
+    UBaseType_t uxReleased;
+    uint32_t ulIndex;
+
+    TEST_CHECK( xTaskGetDeadline( NULL ) == xDeadline );
+
+    for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+    {
+        pxOther = &( xTasks[ ulIndex ] );
+        uxReleased = ( UBaseType_t ) ( ( ( xNow - xTrialStart ) / pxOther->xPeriod ) + 1U );
+
+        if( uxReleased > ( testHYPERPERIOD / pxOther->xPeriod ) )
+        {
+            uxReleased = testHYPERPERIOD / pxOther->xPeriod;
+        }
+
+        if( pxOther->uxJobsDone < uxReleased )
+        {
+            TEST_CHECK( xDeadline <= ( xTrialStart + ( ( pxOther->uxJobsDone + 1U ) * pxOther->xPeriod ) ) );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTask( void * pvParameters )
+{
+    PeriodicTask_t * pxTask = ( PeriodicTask_t * ) pvParameters;
+    TickType_t xRelease = xTrialStart;
+    TickType_t xExecuted;
+
+    for( ; ; )
+    {
+        for( xExecuted = 0; xExecuted < pxTask->xExecution; xExecuted++ )
+        {
+            if( xTrialCheckOrder != pdFALSE )
+            {
+                prvCheckOrder( pxTask );
+            }
+
+            vTestTicks( 1 );
+        }
+
+        if( xTaskGetTickCount() > ( xRelease + pxTask->xPeriod ) )
+        {
+            ulTrialMisses++;
+        }
+
+        pxTask->uxJobsDone++;
+
+        if( pxTask->uxJobsDone == ( testHYPERPERIOD / pxTask->xPeriod ) )
+        {
+            break;
+        }
+
+        ( void ) xTaskDelayUntil( &xRelease, pxTask->xPeriod );
+    }
+
+    ( void ) xSemaphoreGive( xTasksDone );
+    vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+/* Response time analysis of the deadline monotonic priorities, the tasks are
+ * in deadline order. */
+static BaseType_t prvFixedPriorityMeetsDeadlines( void )
+{
+    uint32_t ulTask, ulHigher;
+    TickType_t xResponse, xNext;
+
+    for( ulTask = 0; ulTask < testTASKS; ulTask++ )
+    {
+        xNext = xTasks[ ulTask ].xExecution;
+
+        do
+        {
+            xResponse = xNext;
+            xNext = xTasks[ ulTask ].xExecution;
+
+            for( ulHigher = 0; ulHigher < ulTask; ulHigher++ )
+            {
+                xNext += ( ( xResponse + xTasks[ ulHigher ].xPeriod - 1U ) / xTasks[ ulHigher ].xPeriod ) * xTasks[ ulHigher ].xExecution;
+            }
+        } while( ( xNext != xResponse ) && ( xNext <= xTasks[ ulTask ].xPeriod ) );
+
+        if( xNext > xTasks[ ulTask ].xPeriod )
+        {
+            return pdFALSE;
+        }
+    }
+
+    return pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+/* Runs one hyperperiod of the task set, returns the deadline misses. */
+static uint32_t prvRunTrial( BaseType_t xEDF,
+                             BaseType_t xCheckOrder )
+{
+    uint32_t ulIndex;
+    UBaseType_t uxPriority;
+
+    xTrialStart = xTaskGetTickCount();
+    xTrialCheckOrder = xCheckOrder;
+    ulTrialMisses = 0;
+
+    /* The tasks are created above the EDF level and deadline monotonic
+     * order is the table order.  This task runs above them all, so they are
+     * all released at xTrialStart once it blocks. */
+    for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+    {
+        xTasks[ ulIndex ].uxJobsDone = 0;
+        uxPriority = ( xEDF != pdFALSE ) ? configEDF_PRIORITY : ( configEDF_PRIORITY - 1U - ulIndex );
+        TEST_CHECK( xTaskCreate( prvPeriodicTask, "Periodic", configMINIMAL_STACK_SIZE, &( xTasks[ ulIndex ] ),
+                                 uxPriority, &( xTasks[ ulIndex ].xHandle ) ) == pdPASS );
+
+        if( xEDF != pdFALSE )
+        {
+            vTaskSetDeadline( xTasks[ ulIndex ].xHandle, xTasks[ ulIndex ].xPeriod );
+        }
+    }
+
+    for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+    {
+        ( void ) xSemaphoreTake( xTasksDone, portMAX_DELAY );
+    }
+
+    for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+    {
+        vTaskDelete( xTasks[ ulIndex ].xHandle );
+    }
+
+    /* Let the idle task free the deleted tasks. */
+    vTaskDelay( 1 );
+
+    return ulTrialMisses;
+}
+/*-----------------------------------------------------------*/
+
+/* Runs the trials of the current execution times under both policies and
+ * checks their misses, returns the utilisation in tenths of a percent. */
+static uint32_t prvRunStep( uint32_t * pulMissesDM,
+                            uint32_t * pulMissesEDF )
+{
+    uint32_t ulIndex, ulUtilisation, ulDemand = 0;
+
+    /* Ticks the jobs demand in a hyperperiod. */
+    for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+    {
+        ulDemand += ( uint32_t ) ( xTasks[ ulIndex ].xExecution * ( testHYPERPERIOD / xTasks[ ulIndex ].xPeriod ) );
+    }
+
+    ulUtilisation = ( ulDemand * 1000U ) / testHYPERPERIOD;
+
+    *pulMissesDM = prvRunTrial( pdFALSE, pdFALSE );
+
+    /* Every EDF job ends by its deadline at a utilisation up to 1, its order
+     * is checked there. */
+    *pulMissesEDF = prvRunTrial( pdTRUE, ( ulDemand <= testHYPERPERIOD ) ? pdTRUE : pdFALSE );
+
+    ( void ) printf( "utilisation %lu.%lu%%, misses DM %lu, EDF %lu\n",
+                     ( unsigned long ) ( ulUtilisation / 10U ), ( unsigned long ) ( ulUtilisation % 10U ),
+                     ( unsigned long ) *pulMissesDM, ( unsigned long ) *pulMissesEDF );
+
+    TEST_CHECK( ( *pulMissesDM == 0U ) == ( prvFixedPriorityMeetsDeadlines() != pdFALSE ) );
+    TEST_CHECK( ( *pulMissesEDF == 0U ) == ( ulDemand <= testHYPERPERIOD ) );
+
+    return ulUtilisation;
+}
+/*-----------------------------------------------------------*/
+
+static void prvControlTask( void * pvParameters )
+{
+    uint32_t ulStep, ulIndex, ulUtilisation;
+    uint32_t ulFirstMissDM = 0, ulFirstMissEDF = 0;
+    uint32_t ulMissesDM, ulMissesEDF;
+
+    ( void ) pvParameters;
+
+    for( ulStep = testFIRST_STEP; ulStep <= testLAST_STEP; ulStep += testSTEP )
+    {
+        /* Execution times of the step, rounded to whole ticks. */
+        for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+        {
+            xTasks[ ulIndex ].xExecution = ( TickType_t ) ( ( ( testSHARE * ulStep * xTasks[ ulIndex ].xPeriod ) + 5000U ) / 10000U );
+        }
+
+        ulUtilisation = prvRunStep( &ulMissesDM, &ulMissesEDF );
+
+        if( ( ulMissesDM != 0U ) && ( ulFirstMissDM == 0U ) )
+        {
+            ulFirstMissDM = ulUtilisation;
+        }
+
+        if( ( ulMissesEDF != 0U ) && ( ulFirstMissEDF == 0U ) )
+        {
+            ulFirstMissEDF = ulUtilisation;
+        }
+    }
+
+    /* The set is one deadline monotonic priorities cannot schedule at a
+     * utilisation EDF meets. */
+    TEST_CHECK( ( ulFirstMissDM != 0U ) && ( ulFirstMissDM <= 1000U ) );
+    TEST_CHECK( ulFirstMissEDF > 1000U );
+
+    /* At a utilisation of exactly 1 the processor never idles and jobs end
+     * on the release of their next one. */
+    for( ulIndex = 0; ulIndex < testTASKS; ulIndex++ )
+    {
+        xTasks[ ulIndex ].xExecution = xFullUtilisation[ ulIndex ];
+    }
+
+    TEST_CHECK( prvRunStep( &ulMissesDM, &ulMissesEDF ) == 1000U );
+
+    ( void ) printf( "utilisation at first miss: DM %lu.%lu%%, EDF %lu.%lu%%\n",
+                     ( unsigned long ) ( ulFirstMissDM / 10U ), ( unsigned long ) ( ulFirstMissDM % 10U ),
+                     ( unsigned long ) ( ulFirstMissEDF / 10U ), ( unsigned long ) ( ulFirstMissEDF % 10U ) );
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    xTasksDone = xSemaphoreCreateCounting( testTASKS, 0 );
+    TEST_CHECK( xTasksDone != NULL );
+
+    vTestRun( prvControlTask, configEDF_PRIORITY + 1U );
+
+    return 0;
+}
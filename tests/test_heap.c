@@ -0,0 +1,264 @@
+/*
+ * Fragmentation and timing of the heap, built once with heap_2.c
+ * (test_heap_2) and once with heap_tlsf.c (test_heap_tlsf).
+ *
+ * The workload creates and deletes objects of mixed sizes in random order, as
+ * tasks, queues and buffers created and deleted at run time would.  Every
+ * block is filled with a pattern that is checked when it is freed, so blocks
+ * handed out twice are caught.  Once everything is freed again the largest
+ * block the heap can still hand out shows how much the workload fragmented
+ * it: heap_2 never merges free blocks, TLSF merges them with their
+ * neighbours and must get the whole heap back as one free block.  The heap is
+ * sized so that TLSF never runs out of memory, heap_2 does.
+ *
+ * Each run prints a CSV line:
+ *   heap,allocations,failures,largest block after the workload,
+ *   mean and worst pvPortMalloc() ns, mean and worst vPortFree() ns
+ * The times are host times, only checked to be there, compare the lines of
+ * the two runs.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "test_support.h"
+
+/* Objects alive at most, rounds of the workload. */
+#define testSLOTS          48U
+#define testROUNDS         50000U
+
+/* Most objects are small, one in four is a large buffer. */
+#define testSMALL_MAX      128U
+#define testLARGE_MIN      256U
+#define testLARGE_MAX      1024U
+
+#if ( configUSE_TLSF_HEAP == 1 )
+    #define testHEAP_NAME    "heap_tlsf"
+#else
+    #define testHEAP_NAME    "heap_2"
+#endif
+
+typedef struct
+{
+    uint8_t * pucBlock;
+    size_t xSize;
+    uint8_t ucPattern;
+} Slot_t;
+
+typedef struct
+{
+    uint64_t ullTotalNs;
+    uint64_t ullWorstNs;
+    uint32_t ulCount;
+} Timing_t;
+
+static Slot_t xSlots[ testSLOTS ];
+static Timing_t xMallocTiming;
+static Timing_t xFreeTiming;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x1234567UL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNowNs( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecord( Timing_t * pxTiming,
+                       uint64_t ullStartNs )
+{
+    uint64_t ullNs = prvNowNs() - ullStartNs;
+
+    pxTiming->ullTotalNs += ullNs;
+    pxTiming->ulCount++;
+
+    if( ullNs > pxTiming->ullWorstNs )
+    {
+        pxTiming->ullWorstNs = ullNs;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvAllocate( Slot_t * pxSlot,
+                               size_t xSize )
+{
+    uint64_t ullStartNs = prvNowNs();
+
+    pxSlot->pucBlock = ( uint8_t * ) pvPortMalloc( xSize );
+    prvRecord( &xMallocTiming, ullStartNs );
+
+    if( pxSlot->pucBlock == NULL )
+    {
+        return pdFAIL;
+    }
+
+    TEST_CHECK( ( ( uintptr_t ) pxSlot->pucBlock & portBYTE_ALIGNMENT_MASK ) == 0U );
+
+    pxSlot->xSize = xSize;
+    pxSlot->ucPattern = ( uint8_t ) prvRandom();
+    ( void ) memset( pxSlot->pucBlock, pxSlot->ucPattern, xSize );
+
+    return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFree( Slot_t * pxSlot )
+{
+    size_t xIndex;
+    uint64_t ullStartNs;
+
+    /* No other block was handed out over this one. */
+    for( xIndex = 0; xIndex < pxSlot->xSize; xIndex++ )
+    {
+        TEST_CHECK( pxSlot->pucBlock[ xIndex ] == pxSlot->ucPattern );
+    }
+
+    ullStartNs = prvNowNs();
+    vPortFree( pxSlot->pucBlock );
+    prvRecord( &xFreeTiming, ullStartNs );
+
+    pxSlot->pucBlock = NULL;
+}
+/*-----------------------------------------------------------*/
+
+/* Largest block pvPortMalloc() hands out, found by bisection. */
+static size_t prvLargestBlock( void )
+{
+    size_t xLow = 0, xHigh = configTOTAL_HEAP_SIZE, xMiddle;
+    void * pv;
+
+    while( xLow < xHigh )
+    {
+        xMiddle = ( xLow + xHigh + 1U ) / 2U;
+        pv = pvPortMalloc( xMiddle );
+
+        if( pv != NULL )
+        {
+            vPortFree( pv );
+            xLow = xMiddle;
+        }
+        else
+        {
+            xHigh = xMiddle - 1U;
+        }
+    }
+
+    return xLow;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    uint32_t ulRound, ulIndex, ulFailures = 0;
+    size_t xSize, xLargest, xFreeStart;
+    Slot_t * pxSlot;
+    void * pv;
+
+    /* The first allocation sets the heap up. */
+    pv = pvPortMalloc( 1 );
+    TEST_CHECK( pv != NULL );
+    vPortFree( pv );
+    xFreeStart = xPortGetFreeHeapSize();
+
+    #if ( configUSE_TLSF_HEAP == 1 )
+    {
+        size_t xFreeBefore, xCost64;
+
+        /* A request already aligned is not padded: 65 bytes cost one alignment
+         * unit more than 64.  heap_2 pads it, as TLSF once did. */
+        xFreeBefore = xPortGetFreeHeapSize();
+        pv = pvPortMalloc( 64 );
+        TEST_CHECK( pv != NULL );
+        xCost64 = xFreeBefore - xPortGetFreeHeapSize();
+        vPortFree( pv );
+
+        xFreeBefore = xPortGetFreeHeapSize();
+        pv = pvPortMalloc( 65 );
+        TEST_CHECK( pv != NULL );
+        TEST_CHECK( ( xFreeBefore - xPortGetFreeHeapSize() ) == ( xCost64 + portBYTE_ALIGNMENT ) );
+        vPortFree( pv );
+    }
+    #endif
+
+    for( ulRound = 0; ulRound < testROUNDS; ulRound++ )
+    {
+        pxSlot = &( xSlots[ prvRandom() % testSLOTS ] );
+
+        if( pxSlot->pucBlock != NULL )
+        {
+            prvFree( pxSlot );
+        }
+        else
+        {
+            if( ( prvRandom() % 4U ) == 0U )
+            {
+                xSize = testLARGE_MIN + ( prvRandom() % ( testLARGE_MAX - testLARGE_MIN + 1U ) );
+            }
+            else
+            {
+                xSize = 1U + ( prvRandom() % testSMALL_MAX );
+            }
+
+            if( prvAllocate( pxSlot, xSize ) == pdFAIL )
+            {
+                ulFailures++;
+            }
+        }
+    }
+
+    for( ulIndex = 0; ulIndex < testSLOTS; ulIndex++ )
+    {
+        if( xSlots[ ulIndex ].pucBlock != NULL )
+        {
+            prvFree( &( xSlots[ ulIndex ] ) );
+        }
+    }
+
+    xLargest = prvLargestBlock();
+
+    #if ( configUSE_TLSF_HEAP == 1 )
+    {
+        HeapStats_t xStats;
+
+        /* The workload never runs out of memory, and merging the free blocks
+         * gives the whole heap back as a single block. */
+        TEST_CHECK( ulFailures == 0U );
+
+        vPortGetHeapStats( &xStats );
+        TEST_CHECK( xStats.xNumberOfFreeBlocks == 1U );
+        TEST_CHECK( xStats.xSizeOfLargestFreeBlockInBytes == xFreeStart );
+    }
+    #endif
+
+    /* Every byte comes back, whether or not the free blocks were merged. */
+    TEST_CHECK( xPortGetFreeHeapSize() == xFreeStart );
+
+    TEST_CHECK( ( xMallocTiming.ulCount > 0U ) && ( xFreeTiming.ulCount > 0U ) );
+
+    ( void ) printf( "%s,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n",
+                     testHEAP_NAME,
+                     ( unsigned long ) xMallocTiming.ulCount,
+                     ( unsigned long ) ulFailures,
+                     ( unsigned long ) xLargest,
+                     ( unsigned long ) ( xMallocTiming.ullTotalNs / xMallocTiming.ulCount ),
+                     ( unsigned long ) xMallocTiming.ullWorstNs,
+                     ( unsigned long ) ( xFreeTiming.ullTotalNs / xFreeTiming.ulCount ),
+                     ( unsigned long ) xFreeTiming.ullWorstNs );
+
+    return 0;
+}
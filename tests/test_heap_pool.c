@@ -0,0 +1,181 @@
+/*
+ * The fixed size pools of heap_pool.c in front of the general heap.
+ *
+ * The test builds a task pool and a stack pool (tests/CMakeLists.txt) and
+ * checks, from main() without a scheduler:
+ *   - a size a pool serves never touches the general heap,
+ *   - a size no pool serves, and the size of an exhausted pool, are served by
+ *     pvPortMallocGeneral() and counted as a fallback of that pool,
+ *   - vPortFree() gives a block back to the pool its address is in, or to the
+ *     general heap, and a freed pool block is handed out again,
+ *   - uxPortGetPoolStats() reports the free blocks, the high-water mark and
+ *     the fallbacks of each pool.
+ *
+ * It prints a CSV line:
+ *   heap_pool,stack block size,stack blocks used at most,stack fallbacks
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_support.h"
+
+#define testTASK_POOL     0U
+#define testSTACK_POOL    1U
+
+static PoolStats_t xStats[ 4 ];
+
+/*-----------------------------------------------------------*/
+
+static void prvGetStats( void )
+{
+    /* Only the pools with blocks are reported, in the order of heap_pool.c. */
+    TEST_CHECK( uxPortGetPoolStats( xStats, 4 ) == 2U );
+    TEST_CHECK( xStats[ testTASK_POOL ].xNumberOfBlocks == configPOOL_TASK_COUNT );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfBlocks == configPOOL_STACK_COUNT );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInPool( const void * pv,
+                             uint8_t * const pucBlocks[],
+                             UBaseType_t uxCount )
+{
+    UBaseType_t x;
+
+    for( x = 0; x < uxCount; x++ )
+    {
+        if( ( const uint8_t * ) pv == pucBlocks[ x ] )
+        {
+            return pdTRUE;
+        }
+    }
+
+    return pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    uint8_t * pucStacks[ configPOOL_STACK_COUNT ];
+    uint8_t * pucTask, * pucFallback, * pucRounded, * pucOther, * pucAgain;
+    size_t xStackSize, xTaskSize, xFreeStart;
+    UBaseType_t x;
+    void * pv;
+
+    /* Nothing was carved yet, every block is free. */
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFreeBlocks == configPOOL_STACK_COUNT );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xMaximumEverUsedBlocks == 0U );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFallbacks == 0U );
+
+    xTaskSize = xStats[ testTASK_POOL ].xBlockSizeInBytes;
+    xStackSize = xStats[ testSTACK_POOL ].xBlockSizeInBytes;
+    TEST_CHECK( xStackSize == configPOOL_STACK_SIZE );
+    TEST_CHECK( xTaskSize != xStackSize );
+
+    /* The first allocation sets the general heap up. */
+    pv = pvPortMallocGeneral( 1 );
+    TEST_CHECK( pv != NULL );
+    vPortFreeGeneral( pv );
+    xFreeStart = xPortGetFreeHeapSize();
+
+    /* The stack pool hands its blocks out from the lowest address, one block
+     * apart, and the general heap does not move. */
+    for( x = 0; x < configPOOL_STACK_COUNT; x++ )
+    {
+        pucStacks[ x ] = ( uint8_t * ) pvPortMalloc( xStackSize );
+        TEST_CHECK( pucStacks[ x ] != NULL );
+        TEST_CHECK( ( ( uintptr_t ) pucStacks[ x ] & portBYTE_ALIGNMENT_MASK ) == 0U );
+        ( void ) memset( pucStacks[ x ], ( int ) x, xStackSize );
+
+        if( x > 0U )
+        {
+            TEST_CHECK( pucStacks[ x ] == ( pucStacks[ x - 1U ] + xStackSize ) );
+        }
+    }
+
+    TEST_CHECK( xPortGetFreeHeapSize() == xFreeStart );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFreeBlocks == 0U );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xMaximumEverUsedBlocks == configPOOL_STACK_COUNT );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFallbacks == 0U );
+
+    /* The pool is exhausted: the same size, and a size that rounds up to it,
+     * come from the general heap and count as fallbacks of the stack pool. */
+    pucFallback = ( uint8_t * ) pvPortMalloc( xStackSize );
+    TEST_CHECK( pucFallback != NULL );
+    TEST_CHECK( prvInPool( pucFallback, pucStacks, configPOOL_STACK_COUNT ) == pdFALSE );
+    TEST_CHECK( xPortGetFreeHeapSize() < xFreeStart );
+
+    pucRounded = ( uint8_t * ) pvPortMalloc( xStackSize - 1U );
+    TEST_CHECK( pucRounded != NULL );
+    TEST_CHECK( prvInPool( pucRounded, pucStacks, configPOOL_STACK_COUNT ) == pdFALSE );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFallbacks == 2U );
+    TEST_CHECK( xStats[ testTASK_POOL ].xNumberOfFallbacks == 0U );
+
+    /* A size no pool serves is not a fallback. */
+    pucOther = ( uint8_t * ) pvPortMalloc( xStackSize + portBYTE_ALIGNMENT + 1U );
+    TEST_CHECK( pucOther != NULL );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFallbacks == 2U );
+    TEST_CHECK( xStats[ testTASK_POOL ].xNumberOfFallbacks == 0U );
+
+    /* The task pool serves its own size, apart from the stack pool. */
+    pucTask = ( uint8_t * ) pvPortMalloc( xTaskSize );
+    TEST_CHECK( pucTask != NULL );
+    TEST_CHECK( prvInPool( pucTask, pucStacks, configPOOL_STACK_COUNT ) == pdFALSE );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testTASK_POOL ].xNumberOfFreeBlocks == ( configPOOL_TASK_COUNT - 1U ) );
+
+    /* A block freed in the middle goes back to the stack pool, not to the
+     * general heap, and is the next one handed out.  Its neighbours keep
+     * their contents. */
+    vPortFree( pucStacks[ 1 ] );
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFreeBlocks == 1U );
+    TEST_CHECK( ( pucStacks[ 0 ][ xStackSize - 1U ] == 0U ) && ( pucStacks[ 2 ][ 0 ] == 2U ) );
+
+    pucAgain = ( uint8_t * ) pvPortMalloc( xStackSize );
+    TEST_CHECK( pucAgain == pucStacks[ 1 ] );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFreeBlocks == 0U );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFallbacks == 2U );
+
+    /* The blocks from the general heap go back to it, found by their address. */
+    vPortFree( pucFallback );
+    vPortFree( pucRounded );
+    vPortFree( pucOther );
+    TEST_CHECK( xPortGetFreeHeapSize() == xFreeStart );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFreeBlocks == 0U );
+
+    /* Every pool block back, the high-water mark and the fallbacks stay. */
+    for( x = 0; x < configPOOL_STACK_COUNT; x++ )
+    {
+        vPortFree( pucStacks[ x ] );
+    }
+
+    vPortFree( pucTask );
+    TEST_CHECK( xPortGetFreeHeapSize() == xFreeStart );
+
+    prvGetStats();
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFreeBlocks == configPOOL_STACK_COUNT );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xMaximumEverUsedBlocks == configPOOL_STACK_COUNT );
+    TEST_CHECK( xStats[ testSTACK_POOL ].xNumberOfFallbacks == 2U );
+    TEST_CHECK( xStats[ testTASK_POOL ].xNumberOfFreeBlocks == configPOOL_TASK_COUNT );
+    TEST_CHECK( xStats[ testTASK_POOL ].xMaximumEverUsedBlocks == 1U );
+
+    ( void ) printf( "heap_pool,%lu,%lu,%lu\n",
+                     ( unsigned long ) xStats[ testSTACK_POOL ].xBlockSizeInBytes,
+                     ( unsigned long ) xStats[ testSTACK_POOL ].xMaximumEverUsedBlocks,
+                     ( unsigned long ) xStats[ testSTACK_POOL ].xNumberOfFallbacks );
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Torture test of the seat state seqlock (APP/SEAT_STATE).
+ *
+ * main() reads the snapshot in a loop while a host interval timer interrupts
+ * it at arbitrary points.  The signal handler publishes a new update, as an
+ * interrupt of the target would in the middle of a read.  Every update writes
+ * the same value to both seats and the values only grow, so a snapshot that
+ * mixes two updates has different driver and passenger values, and one that
+ * reads a half written update goes back in time.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "test_support.h"
+#include "APP/SEAT_STATE/seat_state.h"
+
+/* Updates published before the test ends, and the timer interval. */
+#define testUPDATES        20000U
+#define testINTERVAL_US    20
+
+static volatile uint32_t ulUpdates = 0;
+static volatile uint32_t ulUpdatesDuringRead = 0;
+static volatile BaseType_t xReading = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+static void prvPublish( int iSignal )
+{
+    const uint32_t ulValue = ulUpdates + 1U;
+
+    ( void ) iSignal;
+
+    /* The three writers take turns. */
+    switch( ulValue % 3U )
+    {
+        case 0U:
+            SeatState_SetDesiredTemperatures( ulValue, ulValue );
+            break;
+
+        case 1U:
+            SeatState_SetCurrentTemperatures( ulValue, ulValue );
+            break;
+
+        default:
+            SeatState_SetHeaters( ulValue, ulValue );
+            break;
+    }
+
+    if( xReading != pdFALSE )
+    {
+        ulUpdatesDuringRead++;
+    }
+
+    ulUpdates = ulValue;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckSeat( const SeatValues_t * pxDriver,
+                          const SeatValues_t * pxPassenger,
+                          const SeatValues_t * pxLast )
+{
+    TEST_CHECK( pxDriver->Desired_Temperature == pxPassenger->Desired_Temperature );
+    TEST_CHECK( pxDriver->Current_Temperature == pxPassenger->Current_Temperature );
+    TEST_CHECK( pxDriver->Heater == pxPassenger->Heater );
+
+    TEST_CHECK( pxDriver->Desired_Temperature >= pxLast->Desired_Temperature );
+    TEST_CHECK( pxDriver->Current_Temperature >= pxLast->Current_Temperature );
+    TEST_CHECK( pxDriver->Heater >= pxLast->Heater );
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    struct sigaction xAction;
+    struct itimerval xTimer;
+    SeatState_t xState;
+    SeatValues_t xLast;
+    uint32_t ulReads = 0;
+
+    ( void ) memset( &xLast, 0, sizeof( xLast ) );
+
+    ( void ) memset( &xAction, 0, sizeof( xAction ) );
+    xAction.sa_handler = prvPublish;
+    TEST_CHECK( sigaction( SIGALRM, &xAction, NULL ) == 0 );
+
+    xTimer.it_interval.tv_sec = 0;
+    xTimer.it_interval.tv_usec = testINTERVAL_US;
+    xTimer.it_value = xTimer.it_interval;
+    TEST_CHECK( setitimer( ITIMER_REAL, &xTimer, NULL ) == 0 );
+
+    while( ulUpdates < testUPDATES )
+    {
+        xReading = pdTRUE;
+        SeatState_Read( &xState );
+        xReading = pdFALSE;
+
+        prvCheckSeat( &xState.Driver, &xState.Passenger, &xLast );
+        xLast = xState.Driver;
+        ulReads++;
+    }
+
+    ( void ) memset( &xTimer, 0, sizeof( xTimer ) );
+    TEST_CHECK( setitimer( ITIMER_REAL, &xTimer, NULL ) == 0 );
+
+    /* The torture only means something if the writers did interrupt reads. */
+    TEST_CHECK( ulUpdatesDuringRead > ( testUPDATES / 10U ) );
+
+    ( void ) printf( "%lu reads, %lu updates, %lu of them in the middle of a read\n",
+                     ( unsigned long ) ulReads, ( unsigned long ) ulUpdates, ( unsigned long ) ulUpdatesDuringRead );
+
+    return 0;
+}
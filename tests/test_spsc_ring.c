@@ -0,0 +1,407 @@
+/*
+ * Stress test of the single producer single consumer ring (Source/spsc_ring.c).
+ *
+ * Each item carries a sequence number, two words made from it and a check
+ * word over the three, so a lost, duplicated, reordered or torn item fails the
+ * test.  Rings of 1, 4 and 64 items are tested in two parts.
+ *
+ * - Polled: before the scheduler starts, main() pops in a loop while a host
+ *   interval timer interrupts it at arbitrary points and the signal handler
+ *   pushes a burst, as an interrupt of the target would in the middle of a
+ *   pop.  Then the other way round, main() pushes and the handler pops.  The
+ *   ring has no consumer task, so neither side calls the kernel.
+ * - Notified: a consumer task waits in xSpscRingReceive().  A producer task of
+ *   lower priority pushes bursts from interrupts and from the task, with
+ *   random pauses, and the consumer runs interrupts that push between its own
+ *   receives.  The push that finds the ring empty wakes the consumer, so once
+ *   a burst of the producer task ends the consumer has emptied the ring and
+ *   waits again.  The interrupts of the host port run where they are called,
+ *   so this part checks the wake-up at those points, not inside
+ *   xSpscRingReceive().
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "test_support.h"
+#include "spsc_ring.h"
+
+#define testLENGTHS            3U
+#define testMAX_LENGTH         64U
+
+/* Signals of each polled run, and the timer interval. */
+#define testSIGNALS            10000U
+#define testINTERVAL_US        20
+
+/* Items of each notified run. */
+#define testNOTIFIED_ITEMS     50000U
+#define testNOTIFY_BIT         0x10UL
+
+typedef struct
+{
+    uint32_t ulSequence;
+    uint32_t ulWords[ 2 ];
+    uint32_t ulCheck;
+} Item_t;
+
+static const uint32_t ulLengths[ testLENGTHS ] = { 1U, 4U, testMAX_LENGTH };
+
+static SpscRing_t xRing;
+static Item_t xStorage[ testMAX_LENGTH ];
+static uint32_t ulLength;
+
+/* Sequence numbers of the next item pushed and popped. */
+static volatile uint32_t ulPushed;
+static volatile uint32_t ulPopped;
+static uint32_t ulPushLimit;
+
+static volatile uint32_t ulSignals;
+static volatile uint32_t ulSignalsInCall;
+static volatile BaseType_t xInCall = pdFALSE;
+
+static uint32_t ulBurst;
+static uint32_t ulNotifications;
+static TaskHandle_t xConsumerTask = NULL;
+static volatile BaseType_t xConsumerDone;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x9E3779B9UL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvCheckWord( const Item_t * pxItem )
+{
+    return ( pxItem->ulSequence * 2654435761UL ) ^ ( pxItem->ulWords[ 0 ] + ( pxItem->ulWords[ 1 ] * 40503UL ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMakeItem( Item_t * pxItem )
+{
+    pxItem->ulSequence = ulPushed;
+    pxItem->ulWords[ 0 ] = ~ulPushed;
+    pxItem->ulWords[ 1 ] = ulPushed * 0x01000193UL;
+    pxItem->ulCheck = prvCheckWord( pxItem );
+}
+/*-----------------------------------------------------------*/
+
+/* The item is the next one, whole. */
+static void prvCheckItem( const Item_t * pxItem )
+{
+    TEST_CHECK( pxItem->ulSequence == ulPopped );
+    TEST_CHECK( pxItem->ulWords[ 0 ] == ~ulPopped );
+    TEST_CHECK( pxItem->ulWords[ 1 ] == ( uint32_t ) ( ulPopped * 0x01000193UL ) );
+    TEST_CHECK( pxItem->ulCheck == prvCheckWord( pxItem ) );
+    ulPopped++;
+}
+/*-----------------------------------------------------------*/
+
+/* Pushes up to ulCount items, and no more than ulPushLimit in all, returns the
+ * number the ring took. */
+static uint32_t prvPushBurst( uint32_t ulCount,
+                              BaseType_t * pxHigherPriorityTaskWoken )
+{
+    Item_t xItem;
+    uint32_t ulDone;
+    BaseType_t xResult;
+
+    for( ulDone = 0; ( ulDone < ulCount ) && ( ulPushed < ulPushLimit ); ulDone++ )
+    {
+        /* Counted first, the push can switch to the consumer, which may push
+         * the next item itself. */
+        prvMakeItem( &xItem );
+        ulPushed++;
+
+        xResult = ( pxHigherPriorityTaskWoken != NULL ) ? xSpscRingPushFromISR( &xRing, &xItem, pxHigherPriorityTaskWoken ) :
+                  xSpscRingPush( &xRing, &xItem );
+
+        if( xResult == pdFAIL )
+        {
+            ulPushed--;
+            break;
+        }
+    }
+
+    return ulDone;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSignalPush( int iSignal )
+{
+    ( void ) iSignal;
+
+    ( void ) prvPushBurst( 1U + ( prvRandom() % ( 2U * ulLength ) ), NULL );
+
+    if( xInCall != pdFALSE )
+    {
+        ulSignalsInCall++;
+    }
+
+    ulSignals++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSignalPop( int iSignal )
+{
+    Item_t xItem;
+    uint32_t ulCount = 1U + ( prvRandom() % ( 2U * ulLength ) );
+
+    ( void ) iSignal;
+
+    while( ( ulCount > 0U ) && ( xSpscRingPop( &xRing, &xItem ) != pdFAIL ) )
+    {
+        prvCheckItem( &xItem );
+        ulCount--;
+    }
+
+    if( xInCall != pdFALSE )
+    {
+        ulSignalsInCall++;
+    }
+
+    ulSignals++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvStartSignals( void ( * pxHandler )( int ) )
+{
+    struct sigaction xAction;
+    struct itimerval xTimer;
+
+    vSpscRingInitialise( &xRing, xStorage, sizeof( Item_t ), ulLength );
+    ulPushed = 0;
+    ulPopped = 0;
+    ulPushLimit = 0xFFFFFFFFUL;
+    ulSignals = 0;
+    ulSignalsInCall = 0;
+
+    ( void ) memset( &xAction, 0, sizeof( xAction ) );
+    xAction.sa_handler = pxHandler;
+    TEST_CHECK( sigaction( SIGALRM, &xAction, NULL ) == 0 );
+
+    xTimer.it_interval.tv_sec = 0;
+    xTimer.it_interval.tv_usec = testINTERVAL_US;
+    xTimer.it_value = xTimer.it_interval;
+    TEST_CHECK( setitimer( ITIMER_REAL, &xTimer, NULL ) == 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStopSignals( const char * pcName )
+{
+    struct itimerval xTimer;
+
+    ( void ) memset( &xTimer, 0, sizeof( xTimer ) );
+    TEST_CHECK( setitimer( ITIMER_REAL, &xTimer, NULL ) == 0 );
+
+    /* The torture only means something if the handler did interrupt the
+     * ring calls. */
+    TEST_CHECK( ulSignalsInCall > ( testSIGNALS / 10U ) );
+
+    ( void ) printf( "%s, length %lu: %lu items, %lu signals, %lu of them in the middle of a ring call\n",
+                     pcName, ( unsigned long ) ulLength, ( unsigned long ) ulPopped,
+                     ( unsigned long ) ulSignals, ( unsigned long ) ulSignalsInCall );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestPolled( void )
+{
+    Item_t xItem;
+    BaseType_t xResult;
+
+    /* The handler pushes, main() pops. */
+    prvStartSignals( prvSignalPush );
+
+    while( ulSignals < testSIGNALS )
+    {
+        xInCall = pdTRUE;
+        xResult = xSpscRingPop( &xRing, &xItem );
+        xInCall = pdFALSE;
+
+        if( xResult != pdFAIL )
+        {
+            prvCheckItem( &xItem );
+        }
+    }
+
+    prvStopSignals( "pop polled" );
+
+    while( xSpscRingPop( &xRing, &xItem ) != pdFAIL )
+    {
+        prvCheckItem( &xItem );
+    }
+
+    TEST_CHECK( ulPopped == ulPushed );
+
+    /* main() pushes, the handler pops. */
+    prvStartSignals( prvSignalPop );
+
+    while( ulSignals < testSIGNALS )
+    {
+        prvMakeItem( &xItem );
+        xInCall = pdTRUE;
+        xResult = xSpscRingPush( &xRing, &xItem );
+        xInCall = pdFALSE;
+
+        if( xResult != pdFAIL )
+        {
+            ulPushed++;
+        }
+    }
+
+    prvStopSignals( "push polled" );
+
+    while( xSpscRingPop( &xRing, &xItem ) != pdFAIL )
+    {
+        prvCheckItem( &xItem );
+    }
+
+    TEST_CHECK( ulPopped == ulPushed );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPushFromISR( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    ( void ) prvPushBurst( ulBurst, &xHigherPriorityTaskWoken );
+
+    if( xHigherPriorityTaskWoken != pdFALSE )
+    {
+        ulNotifications++;
+    }
+
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void * pvParameters )
+{
+    Item_t xItem;
+
+    ( void ) pvParameters;
+
+    vSpscRingSetConsumer( &xRing, NULL, 0U );
+    vSpscRingSetConsumer( &xRing, xTaskGetCurrentTaskHandle(), testNOTIFY_BIT );
+
+    while( ulPopped < testNOTIFIED_ITEMS )
+    {
+        TEST_CHECK( xSpscRingReceive( &xRing, &xItem, portMAX_DELAY ) == pdPASS );
+        prvCheckItem( &xItem );
+
+        /* An interrupt of the consumer pushes between two receives, the
+         * ring may be empty or not. */
+        if( ( ( prvRandom() % 8U ) == 0U ) && ( ulPushed < testNOTIFIED_ITEMS ) )
+        {
+            ulBurst = 1U + ( prvRandom() % 2U );
+            vPortRunInterrupt( prvPushFromISR );
+        }
+    }
+
+    /* Nothing is left, a receive times out. */
+    TEST_CHECK( xSpscRingReceive( &xRing, &xItem, 2 ) == pdFAIL );
+
+    vSpscRingSetConsumer( &xRing, NULL, 0U );
+    xConsumerDone = pdTRUE;
+    vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestNotified( void )
+{
+    uint32_t ulCount;
+
+    vSpscRingInitialise( &xRing, xStorage, sizeof( Item_t ), ulLength );
+    ulPushed = 0;
+    ulPopped = 0;
+    ulPushLimit = testNOTIFIED_ITEMS;
+    ulNotifications = 0;
+    xConsumerDone = pdFALSE;
+
+    /* The consumer runs at once and waits on the empty ring. */
+    TEST_CHECK( xTaskCreate( prvConsumerTask, "Consumer", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &xConsumerTask ) == pdPASS );
+
+    while( ulPushed < testNOTIFIED_ITEMS )
+    {
+        ulCount = 1U + ( prvRandom() % ( 2U * ulLength ) );
+
+        if( ( prvRandom() % 2U ) == 0U )
+        {
+            ulBurst = ulCount;
+            vPortRunInterrupt( prvPushFromISR );
+        }
+        else
+        {
+            ( void ) prvPushBurst( ulCount, NULL );
+        }
+
+        /* The consumer was woken and emptied the ring, then waited again. */
+        TEST_CHECK( ulPopped == ulPushed );
+        TEST_CHECK( ( xConsumerDone != pdFALSE ) || ( eTaskGetState( xConsumerTask ) == eBlocked ) );
+
+        if( ( prvRandom() % 16U ) == 0U )
+        {
+            vTaskDelay( 1U + ( prvRandom() % 3U ) );
+        }
+    }
+
+    while( xConsumerDone == pdFALSE )
+    {
+        vTaskDelay( 1 );
+    }
+
+    TEST_CHECK( ulPopped == testNOTIFIED_ITEMS );
+    TEST_CHECK( ulNotifications > 0U );
+
+    ( void ) printf( "notified, length %lu: %lu items, %lu interrupts woke the consumer\n",
+                     ( unsigned long ) ulLength, ( unsigned long ) ulPopped, ( unsigned long ) ulNotifications );
+
+    vTaskDelete( xConsumerTask );
+
+    /* Let the idle task free the deleted task. */
+    vTaskDelay( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTask( void * pvParameters )
+{
+    uint32_t ulIndex;
+
+    ( void ) pvParameters;
+
+    for( ulIndex = 0; ulIndex < testLENGTHS; ulIndex++ )
+    {
+        ulLength = ulLengths[ ulIndex ];
+        prvTestNotified();
+    }
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    struct sigaction xAction;
+    uint32_t ulIndex;
+
+    for( ulIndex = 0; ulIndex < testLENGTHS; ulIndex++ )
+    {
+        ulLength = ulLengths[ ulIndex ];
+        prvTestPolled();
+    }
+
+    ( void ) memset( &xAction, 0, sizeof( xAction ) );
+    xAction.sa_handler = SIG_DFL;
+    TEST_CHECK( sigaction( SIGALRM, &xAction, NULL ) == 0 );
+
+    vTestRun( prvTestTask, tskIDLE_PRIORITY + 1 );
+
+    return 0;
+}
@@ -0,0 +1,285 @@
+/*
+ * Host test of the stream and message buffers (Source/stream_buffer.c).
+ *
+ * - Wrap: random length sends and receives go round a small stream buffer
+ *   and a small message buffer many times, the bytes come out in order and
+ *   the messages whole.
+ * - Trigger level: a receiver of higher priority only unblocks once the
+ *   trigger level is reached, also after the level was changed.
+ * - Send from an interrupt: a send from an interrupt handler that reaches
+ *   the trigger level switches to the receiver when the handler returns, a
+ *   send below it does not, and a send into a full buffer sends what fits.
+ */
+
+#include <string.h>
+
+#include "test_support.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/* Buffer sizes, and the rounds of the wrap tests. */
+#define testSTREAM_SIZE     32U
+#define testMESSAGE_SIZE    64U
+#define testWRAP_ROUNDS     5000U
+
+#define testTRIGGER_LEVEL   8U
+#define testISR_TRIGGER     4U
+
+/* A receiver task, blocked on xBuffer for up to testRECEIVE_LENGTH bytes. */
+#define testRECEIVE_LENGTH  16U
+
+typedef struct
+{
+    StreamBufferHandle_t xBuffer;
+    volatile uint32_t ulReceives;
+    volatile size_t xLastLength;
+    uint8_t ucData[ testRECEIVE_LENGTH ];
+} Receiver_t;
+
+static Receiver_t xTriggerReceiver;
+static Receiver_t xISRReceiver;
+static TaskHandle_t xISRReceiverTask = NULL;
+
+/* Data of the interrupt handlers. */
+static const uint8_t * pucISRData;
+static size_t xISRLength;
+static size_t xISRSent;
+static BaseType_t xISRWoken;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x5eed1234UL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiverTask( void * pvParameters )
+{
+    Receiver_t * const pxReceiver = ( Receiver_t * ) pvParameters;
+
+    for( ; ; )
+    {
+        pxReceiver->xLastLength = xStreamBufferReceive( pxReceiver->xBuffer, pxReceiver->ucData, testRECEIVE_LENGTH, portMAX_DELAY );
+        pxReceiver->ulReceives++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestStreamWrap( void )
+{
+    static uint8_t ucStorage[ testSTREAM_SIZE + 1U ];
+    static StaticStreamBuffer_t xStatic;
+    StreamBufferHandle_t xBuffer;
+    uint8_t ucData[ testSTREAM_SIZE ];
+    uint8_t ucNextIn = 0, ucNextOut = 0;
+    size_t xLength, xExpected, xDone, xIndex, xStored = 0, xTotal = 0;
+    uint32_t ulRound;
+
+    xBuffer = xStreamBufferCreateStatic( sizeof( ucStorage ), 1, ucStorage, &xStatic );
+    TEST_CHECK( xBuffer != NULL );
+
+    for( ulRound = 0; ulRound < testWRAP_ROUNDS; ulRound++ )
+    {
+        /* Send what fits of a random length. */
+        xLength = 1U + ( prvRandom() % 20U );
+        xExpected = ( xLength < xStreamBufferSpacesAvailable( xBuffer ) ) ? xLength : xStreamBufferSpacesAvailable( xBuffer );
+
+        for( xIndex = 0; xIndex < xLength; xIndex++ )
+        {
+            ucData[ xIndex ] = ( uint8_t ) ( ucNextIn + xIndex );
+        }
+
+        xDone = xStreamBufferSend( xBuffer, ucData, xLength, 0 );
+        TEST_CHECK( xDone == xExpected );
+        ucNextIn = ( uint8_t ) ( ucNextIn + xDone );
+        xStored += xDone;
+        TEST_CHECK( xStreamBufferBytesAvailable( xBuffer ) == xStored );
+
+        /* Receive up to another random length, in order. */
+        xLength = 1U + ( prvRandom() % 24U );
+        xExpected = ( xLength < xStored ) ? xLength : xStored;
+        xDone = xStreamBufferReceive( xBuffer, ucData, xLength, 0 );
+        TEST_CHECK( xDone == xExpected );
+
+        for( xIndex = 0; xIndex < xDone; xIndex++ )
+        {
+            TEST_CHECK( ucData[ xIndex ] == ucNextOut );
+            ucNextOut++;
+        }
+
+        xStored -= xDone;
+        xTotal += xDone;
+    }
+
+    /* The bytes went round the buffer many times. */
+    TEST_CHECK( xTotal > ( 100U * testSTREAM_SIZE ) );
+    vStreamBufferDelete( xBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestMessageWrap( void )
+{
+    MessageBufferHandle_t xBuffer;
+    uint8_t ucData[ testMESSAGE_SIZE ];
+    uint8_t ucSent[ 32 ][ 20 ];
+    size_t xSentLength[ 32 ];
+    uint32_t ulRound, ulIn = 0, ulOut = 0;
+    size_t xLength, xDone, xSpace;
+
+    xBuffer = xMessageBufferCreate( testMESSAGE_SIZE );
+    TEST_CHECK( xBuffer != NULL );
+
+    for( ulRound = 0; ulRound < testWRAP_ROUNDS; ulRound++ )
+    {
+        /* A message goes in whole, with its length, or not at all. */
+        xLength = 1U + ( prvRandom() % 20U );
+        ( void ) memset( ucSent[ ulIn % 32U ], ( int ) ulRound, xLength );
+        xSpace = xMessageBufferSpacesAvailable( xBuffer );
+        xDone = xMessageBufferSend( xBuffer, ucSent[ ulIn % 32U ], xLength, 0 );
+
+        if( xSpace >= ( xLength + sizeof( configMESSAGE_BUFFER_LENGTH_TYPE ) ) )
+        {
+            TEST_CHECK( xDone == xLength );
+            xSentLength[ ulIn % 32U ] = xLength;
+            ulIn++;
+        }
+        else
+        {
+            TEST_CHECK( xDone == 0U );
+        }
+
+        if( ( ulIn != ulOut ) && ( ( prvRandom() % 3U ) != 0U ) )
+        {
+            /* A buffer too small for the next message leaves it there. */
+            if( xSentLength[ ulOut % 32U ] > 1U )
+            {
+                TEST_CHECK( xMessageBufferReceive( xBuffer, ucData, xSentLength[ ulOut % 32U ] - 1U, 0 ) == 0U );
+            }
+
+            xDone = xMessageBufferReceive( xBuffer, ucData, sizeof( ucData ), 0 );
+            TEST_CHECK( xDone == xSentLength[ ulOut % 32U ] );
+            TEST_CHECK( memcmp( ucData, ucSent[ ulOut % 32U ], xDone ) == 0 );
+            ulOut++;
+        }
+    }
+
+    TEST_CHECK( ulOut > ( testWRAP_ROUNDS / 2U ) );
+    vMessageBufferDelete( xBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTriggerLevel( void )
+{
+    static const size_t xLevels[] = { testTRIGGER_LEVEL, 3U, testTRIGGER_LEVEL + 5U };
+    const uint8_t ucByte = 0x5a;
+    uint32_t ulReceives, ulLevel;
+    size_t xLevel, xIndex;
+
+    for( ulLevel = 0; ulLevel < ( sizeof( xLevels ) / sizeof( xLevels[ 0 ] ) ); ulLevel++ )
+    {
+        xLevel = xLevels[ ulLevel ];
+        TEST_CHECK( xStreamBufferSetTriggerLevel( xTriggerReceiver.xBuffer, xLevel ) == pdPASS );
+        ulReceives = xTriggerReceiver.ulReceives;
+
+        /* The receiver stays blocked below the trigger level... */
+        for( xIndex = 1U; xIndex < xLevel; xIndex++ )
+        {
+            TEST_CHECK( xStreamBufferSend( xTriggerReceiver.xBuffer, &ucByte, 1, 0 ) == 1U );
+            TEST_CHECK( xTriggerReceiver.ulReceives == ulReceives );
+        }
+
+        /* ...and preempts the sender as soon as it is reached. */
+        TEST_CHECK( xStreamBufferSend( xTriggerReceiver.xBuffer, &ucByte, 1, 0 ) == 1U );
+        TEST_CHECK( xTriggerReceiver.ulReceives == ( ulReceives + 1U ) );
+        TEST_CHECK( xTriggerReceiver.xLastLength == xLevel );
+    }
+
+    /* A trigger level larger than the buffer is refused. */
+    TEST_CHECK( xStreamBufferSetTriggerLevel( xTriggerReceiver.xBuffer, testSTREAM_SIZE + 1U ) == pdFAIL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSendFromISR( void )
+{
+    xISRWoken = pdFALSE;
+    xISRSent = xStreamBufferSendFromISR( xISRReceiver.xBuffer, pucISRData, xISRLength, &xISRWoken );
+    portYIELD_FROM_ISR( xISRWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestSendFromISR( void )
+{
+    static const uint8_t ucData[ testSTREAM_SIZE + 8U ] = { 1, 2, 3, 4, 5, 6 };
+    uint32_t ulReceives = xISRReceiver.ulReceives;
+
+    pucISRData = ucData;
+
+    /* Below the trigger level the receiver is not woken. */
+    xISRLength = testISR_TRIGGER - 1U;
+    vPortRunInterrupt( prvSendFromISR );
+    TEST_CHECK( xISRSent == xISRLength );
+    TEST_CHECK( xISRWoken == pdFALSE );
+    TEST_CHECK( xISRReceiver.ulReceives == ulReceives );
+
+    /* Reaching it switches to the receiver when the handler returns, before
+     * this task runs again. */
+    pucISRData = &( ucData[ xISRLength ] );
+    xISRLength = 1U;
+    vPortRunInterrupt( prvSendFromISR );
+    TEST_CHECK( xISRWoken != pdFALSE );
+    TEST_CHECK( xISRReceiver.ulReceives == ( ulReceives + 1U ) );
+    TEST_CHECK( xISRReceiver.xLastLength == testISR_TRIGGER );
+    TEST_CHECK( memcmp( xISRReceiver.ucData, ucData, testISR_TRIGGER ) == 0 );
+
+    /* Into a full buffer only what fits is sent. */
+    vTaskSuspend( xISRReceiverTask );
+    pucISRData = ucData;
+    xISRLength = sizeof( ucData );
+    vPortRunInterrupt( prvSendFromISR );
+    TEST_CHECK( xISRSent == testSTREAM_SIZE );
+    TEST_CHECK( xStreamBufferIsFull( xISRReceiver.xBuffer ) != pdFALSE );
+
+    vPortRunInterrupt( prvSendFromISR );
+    TEST_CHECK( xISRSent == 0U );
+
+    /* The receiver empties it in testRECEIVE_LENGTH byte reads. */
+    vTaskResume( xISRReceiverTask );
+    TEST_CHECK( xStreamBufferIsEmpty( xISRReceiver.xBuffer ) != pdFALSE );
+    TEST_CHECK( xISRReceiver.ulReceives == ( ulReceives + 1U + ( testSTREAM_SIZE / testRECEIVE_LENGTH ) ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    prvTestStreamWrap();
+    prvTestMessageWrap();
+
+    xTriggerReceiver.xBuffer = xStreamBufferCreate( testSTREAM_SIZE, testTRIGGER_LEVEL );
+    xISRReceiver.xBuffer = xStreamBufferCreate( testSTREAM_SIZE, testISR_TRIGGER );
+    TEST_CHECK( ( xTriggerReceiver.xBuffer != NULL ) && ( xISRReceiver.xBuffer != NULL ) );
+
+    /* The receivers run at once and block on their empty buffer. */
+    TEST_CHECK( xTaskCreate( prvReceiverTask, "TriggerRx", configMINIMAL_STACK_SIZE, &xTriggerReceiver, tskIDLE_PRIORITY + 2, NULL ) == pdPASS );
+    TEST_CHECK( xTaskCreate( prvReceiverTask, "ISRRx", configMINIMAL_STACK_SIZE, &xISRReceiver, tskIDLE_PRIORITY + 2, &xISRReceiverTask ) == pdPASS );
+    TEST_CHECK( ( xTriggerReceiver.ulReceives == 0U ) && ( xISRReceiver.ulReceives == 0U ) );
+
+    prvTestTriggerLevel();
+    prvTestSendFromISR();
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    vTestRun( prvTestTask, tskIDLE_PRIORITY + 1 );
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Helpers shared by the host tests, see test_support.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "test_support.h"
+
+/*-----------------------------------------------------------*/
+
+void vTestFail( const char * pcFile,
+                unsigned long ulLine,
+                const char * pcCheck )
+{
+    ( void ) fflush( stdout );
+    ( void ) fprintf( stderr, "%s:%lu: check failed: %s\n", pcFile, ulLine, pcCheck );
+    exit( EXIT_FAILURE );
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char * pcFile,
+                    unsigned long ulLine )
+{
+    vTestFail( pcFile, ulLine, "configASSERT" );
+}
+/*-----------------------------------------------------------*/
+
+void vTestRun( TaskFunction_t pxTestTask,
+               UBaseType_t uxPriority )
+{
+    BaseType_t xStatus;
+
+    xStatus = xTaskCreate( pxTestTask, "Test", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+    TEST_CHECK( xStatus == pdPASS );
+
+    vTaskStartScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vTestEnd( void )
+{
+    vTaskEndScheduler();
+}
+/*-----------------------------------------------------------*/
+
+void vTestTicks( TickType_t xTicks )
+{
+    while( xTicks > 0U )
+    {
+        vPortRunInterrupt( xPortSysTickHandler );
+        xTicks--;
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* A test of the tickless idle moves the virtual clock from its own hook. */
+#if ( configUSE_TICKLESS_IDLE == 0 )
+
+    void vApplicationIdleHook( void )
+    {
+        /* Nothing is ready to run, the next tick comes at once. */
+        vPortRunInterrupt( xPortSysTickHandler );
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+/* The idle and timer tasks of the static allocation the tests enable. */
+void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer,
+                                    StackType_t ** ppxIdleTaskStackBuffer,
+                                    uint32_t * pulIdleTaskStackSize )
+{
+    static StaticTask_t xIdleTaskBuffer;
+    static StackType_t xIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+    *ppxIdleTaskTCBBuffer = &xIdleTaskBuffer;
+    *ppxIdleTaskStackBuffer = xIdleTaskStack;
+    *pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationGetTimerTaskMemory( StaticTask_t ** ppxTimerTaskTCBBuffer,
+                                     StackType_t ** ppxTimerTaskStackBuffer,
+                                     uint32_t * pulTimerTaskStackSize )
+{
+    static StaticTask_t xTimerTaskBuffer;
+    static StackType_t xTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+    *ppxTimerTaskTCBBuffer = &xTimerTaskBuffer;
+    *ppxTimerTaskStackBuffer = xTimerTaskStack;
+    *pulTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,38 @@
+/*
+ * Helpers shared by the host tests (tests/CMakeLists.txt).
+ *
+ * A test either calls the code under test from main(), or runs its checks
+ * from tasks with vTestRun().  A failed check or configASSERT() prints its
+ * location and ends the process with a failure status, so the first error
+ * fails the ctest case.
+ */
+
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Fails the test if x is 0. */
+#define TEST_CHECK( x )    do { if( ( x ) == 0 ) { vTestFail( __FILE__, __LINE__, #x ); } } while( 0 )
+
+void vTestFail( const char * pcFile,
+                unsigned long ulLine,
+                const char * pcCheck );
+
+/*
+ * Create the test task with the given priority, start the scheduler and
+ * return once the test called vTestEnd().
+ */
+void vTestRun( TaskFunction_t pxTestTask,
+               UBaseType_t uxPriority );
+void vTestEnd( void );
+
+/*
+ * Raise xTicks tick interrupts from the calling task, as if it was running
+ * for that long.  The tasks the ticks unblock preempt it as they would on the
+ * target.
+ */
+void vTestTicks( TickType_t xTicks );
+
+#endif /* TEST_SUPPORT_H */
@@ -0,0 +1,208 @@
+/*
+ * Drift check of the tickless idle.
+ *
+ * The kernel runs on the virtual clock of MCAL/SIM with the tickless idle of
+ * the host port, which stops the tick, sleeps on the WTimer1 one shot and steps
+ * the tick count by what WTimer1 measured, as the low power timer path of the
+ * CCS port does.  One task delays for random numbers of ticks, so most sleeps
+ * run to the WTimer1 time out.  Button edges scripted between the ticks wake
+ * the core in the middle of other sleeps and unblock a second task.  Analog
+ * input changes scripted on the ticks run the idle task before the tick of the
+ * same time, so some sleeps start with a tick that is due.  After every wake
+ * the tick count must be the number of tick periods of virtual time that
+ * passed, so an error of a single count in the arithmetic of the sleep adds up
+ * over the run and fails the test.
+ *
+ * The SysTick register arithmetic of the CCS port does not run on the host,
+ * its virtual clock counts the tick periods instead.
+ */
+
+#include <stdio.h>
+
+#include "test_support.h"
+#include "semphr.h"
+#include "sim_clock.h"
+#include "sim_hw.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Delays of the delay task, the longest, and the scripted button edges. */
+#define testDELAYS           200U
+#define testMAX_DELAY        50U
+#define testEDGES            100U
+
+/* Edges come every testEDGE_PERIOD_US, shifted off the tick boundaries, input
+ * changes every testINPUT_PERIOD_US, on a tick boundary. */
+#define testEDGE_PERIOD_US   123450ULL
+#define testEDGE_OFFSET_US   777ULL
+#define testINPUT_PERIOD_US  70000ULL
+#define testINPUTS           ( ( testEDGES * testEDGE_PERIOD_US ) / testINPUT_PERIOD_US )
+
+#define testTICK_PERIOD_US   ( 1000000ULL / configTICK_RATE_HZ )
+#define testCYCLES_PER_US    ( configCPU_CLOCK_HZ / 1000000ULL )
+
+static SimEvent_t xScript[ testEDGES + testINPUTS ];
+static uint64_t ullEdgeTimes[ testEDGES ];
+static SemaphoreHandle_t xEdgeSemaphore = NULL;
+static volatile uint32_t ulTicksRaised = 0;
+static uint32_t ulEdgesSeen = 0;
+
+/*-----------------------------------------------------------*/
+
+/* Tick handler of the virtual clock (SIM_CLOCK_TICK_HANDLER), counts the tick
+ * interrupts the tickless idle did not suppress. */
+void vTestTickHandler( void )
+{
+    ulTicksRaised++;
+    xPortSysTickHandler();
+}
+/*-----------------------------------------------------------*/
+
+/* Port F interrupt of the scripted edges. */
+void GPIOPortF_Handler( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    ( void ) xSemaphoreGiveFromISR( xEdgeSemaphore, &xHigherPriorityTaskWoken );
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStep( void )
+{
+    ( void ) SimClock_Step( 0xFFFFFFFFFFFFFFFFULL );
+}
+/*-----------------------------------------------------------*/
+
+/* Moves the virtual clock to the next event whenever the idle task runs, the
+ * tickless idle then sleeps if the next unblock time is far enough. */
+void vApplicationIdleHook( void )
+{
+    vPortRunInterrupt( prvStep );
+}
+/*-----------------------------------------------------------*/
+
+/* The tick count is the number of tick periods of virtual time. */
+static void prvCheckTickCount( void )
+{
+    TEST_CHECK( ( uint64_t ) xTaskGetTickCount() == ( SimClock_NowUs() / testTICK_PERIOD_US ) );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x2545F491UL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static void prvEdgeTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        ( void ) xSemaphoreTake( xEdgeSemaphore, portMAX_DELAY );
+
+        /* Woken at the time of the edge, not at the next tick. */
+        TEST_CHECK( ulEdgesSeen < testEDGES );
+        TEST_CHECK( SimClock_NowUs() == ullEdgeTimes[ ulEdgesSeen ] );
+        prvCheckTickCount();
+        ulEdgesSeen++;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayTask( void * pvParameters )
+{
+    uint32_t ulDelay;
+    uint32_t ulIndex;
+    TickType_t xExpected;
+
+    ( void ) pvParameters;
+
+    for( ulIndex = 0; ulIndex < testDELAYS; ulIndex++ )
+    {
+        ulDelay = 1U + ( prvRandom() % testMAX_DELAY );
+        xExpected = xTaskGetTickCount() + ( TickType_t ) ulDelay;
+
+        vTaskDelay( ( TickType_t ) ulDelay );
+
+        /* Woken by the tick the delay ends on, at its exact time. */
+        TEST_CHECK( xTaskGetTickCount() == xExpected );
+        TEST_CHECK( ( SimClock_NowUs() % testTICK_PERIOD_US ) == 0U );
+        prvCheckTickCount();
+    }
+
+    TEST_CHECK( ulEdgesSeen == testEDGES );
+
+    /* Most tick periods passed asleep, and the run time clock skipped the
+     * sleeps exactly. */
+    TEST_CHECK( ulTicksRaised < ( xTaskGetTickCount() / 2U ) );
+    TEST_CHECK( DWT_CycleCounterRead64() == ( SimClock_NowUs() * testCYCLES_PER_US ) );
+
+    ( void ) printf( "%lu ticks, %lu of them raised, %lu edges\n",
+                     ( unsigned long ) xTaskGetTickCount(), ( unsigned long ) ulTicksRaised, ( unsigned long ) ulEdgesSeen );
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+/* Merges the edges and the input changes in time order. */
+static void prvBuildScript( void )
+{
+    uint32_t ulEdge = 0, ulInput = 0, ulIndex;
+    uint64_t ullInputTime;
+    SimEvent_t * pxEvent;
+
+    for( ulIndex = 0; ulIndex < testEDGES; ulIndex++ )
+    {
+        ullEdgeTimes[ ulIndex ] = ( ( uint64_t ) ( ulIndex + 1U ) * testEDGE_PERIOD_US ) + testEDGE_OFFSET_US;
+    }
+
+    for( ulIndex = 0; ulIndex < ( testEDGES + testINPUTS ); ulIndex++ )
+    {
+        pxEvent = &( xScript[ ulIndex ] );
+        ullInputTime = ( uint64_t ) ( ulInput + 1U ) * testINPUT_PERIOD_US;
+
+        if( ( ulInput == testINPUTS ) || ( ( ulEdge < testEDGES ) && ( ullEdgeTimes[ ulEdge ] < ullInputTime ) ) )
+        {
+            pxEvent->uTimeUs = ullEdgeTimes[ ulEdge ];
+            pxEvent->eType = SIM_EVENT_BUTTON;
+            pxEvent->uTarget = SIM_HW_SW1_PIN;
+            pxEvent->uValue = ( uint16_t ) ( ( ulEdge + 1U ) % 2U );
+            ulEdge++;
+        }
+        else
+        {
+            pxEvent->uTimeUs = ullInputTime;
+            pxEvent->eType = SIM_EVENT_INPUT;
+            pxEvent->uTarget = 0;
+            pxEvent->uValue = ( uint16_t ) ulInput;
+            ulInput++;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    prvBuildScript();
+
+    SimHw_Init();
+    SimClock_Init( xScript, testEDGES + testINPUTS );
+    DWT_CycleCounterInit();
+    GPIO_PORTF_IM_REG = ( 1U << SIM_HW_SW1_PIN );
+
+    xEdgeSemaphore = xSemaphoreCreateCounting( testEDGES, 0 );
+    TEST_CHECK( xEdgeSemaphore != NULL );
+    TEST_CHECK( xTaskCreate( prvEdgeTask, "Edge", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, NULL ) == pdPASS );
+
+    vTestRun( prvDelayTask, tskIDLE_PRIORITY + 1 );
+
+    TEST_CHECK( SimHw_Overflowed() == FALSE );
+
+    return 0;
+}
@@ -0,0 +1,412 @@
+/*
+ * Software timers with the sorted active timer lists (test_timer_lists) and
+ * in the timing wheel (test_timer_wheel), configUSE_TIMER_TIMING_WHEEL, each
+ * also with the commands of interrupts passed through the command ring
+ * (test_timer_ring_lists, test_timer_ring_wheel),
+ * configUSE_TIMER_ISR_COMMAND_RING.
+ *
+ * A task sends random start, reset, stop and change period commands to one
+ * shot and auto-reload timers on every tick, from just before the tick count
+ * overflows to well after it, some from the task, some from interrupts.  The
+ * test keeps the time each active timer is due, as the timer API defines it,
+ * and every callback must come on that tick for an active timer.  At the end
+ * no active timer may be left overdue.  All builds print the same count and
+ * checksum of the callbacks, the timers due on the same tick may fire in
+ * another order.
+ *
+ * Every few ticks the task suspends the scheduler and mixes task commands with
+ * bursts of up to testMAX_BURST commands from interrupts, more than the ring
+ * holds, so the timer task takes them all at once and commands that find the
+ * ring full go on the queue.  They must be applied in the order they were
+ * sent: the state of every timer afterwards is the one the test expects.  The
+ * first burst is the case of an interrupt command that found the ring empty,
+ * then a task command, then an interrupt command behind it in the ring, all to
+ * the same timer.
+ *
+ * The cost part then keeps 100, 1000 and 4000 auto-reload timers active and
+ * resets one of them on every tick, and prints a CSV line for each:
+ *   active timers,timers,host ns per tick
+ * The time includes the context switches of the host port, compare the lines
+ * of the builds.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "test_support.h"
+#include "timers.h"
+
+/* Timers and ticks of the random commands, the longest period. */
+#define testTIMERS             200U
+#define testTICKS              12000U
+#define testCOMMANDS_PER_TICK  4U
+#define testMAX_PERIOD         300U
+
+/* Commands of the scheduler suspended sections, from interrupts and from the
+ * task, and the ticks between two sections. */
+#define testMAX_BURST          23U
+#define testMAX_TASK_COMMANDS  2U
+#define testBURST_INTERVAL     7U
+
+/* Ticks of each cost run, and the most timers. */
+#define testCOST_TICKS         1000U
+#define testCOST_RUNS          3U
+#define testCOST_MAX_TIMERS    4000U
+
+#if ( ( configUSE_TIMER_ISR_COMMAND_RING == 1 ) && ( configUSE_TIMER_TIMING_WHEEL == 1 ) )
+    #define testNAME    "timer_ring_wheel"
+#elif ( configUSE_TIMER_ISR_COMMAND_RING == 1 )
+    #define testNAME    "timer_ring_lists"
+#elif ( configUSE_TIMER_TIMING_WHEEL == 1 )
+    #define testNAME    "timer_wheel"
+#else
+    #define testNAME    "timer_lists"
+#endif
+
+/* The commands, in the order of the switch of prvSendCommand(). */
+#define testSTART              0U
+#define testRESET              1U
+#define testSTOP               2U
+#define testCHANGE_PERIOD      3U
+
+/* What the test expects of a timer. */
+typedef struct
+{
+    BaseType_t xActive;
+    TickType_t xExpiry;
+    TickType_t xPeriod;
+} Expected_t;
+
+static StaticTimer_t xTimerBuffers[ testCOST_MAX_TIMERS ];
+static TimerHandle_t xTimers[ testCOST_MAX_TIMERS ];
+static Expected_t xExpected[ testTIMERS ];
+static const uint32_t ulCostTimers[ testCOST_RUNS ] = { 100U, 1000U, 4000U };
+
+static uint32_t ulCallbacks = 0;
+static uint32_t ulChecksum = 0;
+static uint32_t ulISRCommands = 0;
+
+/* Command the next interrupt sends. */
+static uint32_t ulISRTimer;
+static uint32_t ulISRCommand;
+static TickType_t xISRPeriod;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x41C64E6DUL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNowNs( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/* Runs in the timer task, on the tick the timer is due. */
+static void prvCallback( TimerHandle_t xTimer )
+{
+    const uint32_t ulIndex = ( uint32_t ) ( uintptr_t ) pvTimerGetTimerID( xTimer );
+    Expected_t * const pxExpected = &( xExpected[ ulIndex ] );
+    const TickType_t xNow = xTaskGetTickCount();
+
+    TEST_CHECK( pxExpected->xActive != pdFALSE );
+    TEST_CHECK( xNow == pxExpected->xExpiry );
+
+    if( xTimerGetReloadMode( xTimer ) != pdFALSE )
+    {
+        pxExpected->xExpiry += pxExpected->xPeriod;
+    }
+    else
+    {
+        pxExpected->xActive = pdFALSE;
+    }
+
+    /* The timers due on the same tick may fire in another order in the
+     * wheel, the sum does not depend on it. */
+    ulCallbacks++;
+    ulChecksum += ( ( ulIndex + 1U ) * 2654435761UL ) ^ ( ( uint32_t ) xNow * 40503UL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCostCallback( TimerHandle_t xTimer )
+{
+    ( void ) xTimer;
+}
+/*-----------------------------------------------------------*/
+
+/* Sends a command and records its effect.  The command time is the tick
+ * count, the timer task applies the commands in the order they were sent. */
+static void prvSendCommand( uint32_t ulIndex,
+                            uint32_t ulCommand,
+                            TickType_t xPeriod,
+                            BaseType_t xFromISR )
+{
+    Expected_t * const pxExpected = &( xExpected[ ulIndex ] );
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    BaseType_t xResult;
+    TickType_t xNow;
+
+    if( xFromISR != pdFALSE )
+    {
+        xNow = xTaskGetTickCountFromISR();
+        ulISRCommands++;
+    }
+    else
+    {
+        xNow = xTaskGetTickCount();
+    }
+
+    switch( ulCommand )
+    {
+        case testSTART:
+            xResult = ( xFromISR != pdFALSE ) ? xTimerStartFromISR( xTimers[ ulIndex ], &xHigherPriorityTaskWoken ) :
+                      xTimerStart( xTimers[ ulIndex ], 0 );
+            pxExpected->xActive = pdTRUE;
+            pxExpected->xExpiry = xNow + pxExpected->xPeriod;
+            break;
+
+        case testRESET:
+            xResult = ( xFromISR != pdFALSE ) ? xTimerResetFromISR( xTimers[ ulIndex ], &xHigherPriorityTaskWoken ) :
+                      xTimerReset( xTimers[ ulIndex ], 0 );
+            pxExpected->xActive = pdTRUE;
+            pxExpected->xExpiry = xNow + pxExpected->xPeriod;
+            break;
+
+        case testSTOP:
+            xResult = ( xFromISR != pdFALSE ) ? xTimerStopFromISR( xTimers[ ulIndex ], &xHigherPriorityTaskWoken ) :
+                      xTimerStop( xTimers[ ulIndex ], 0 );
+            pxExpected->xActive = pdFALSE;
+            break;
+
+        default:
+            xResult = ( xFromISR != pdFALSE ) ? xTimerChangePeriodFromISR( xTimers[ ulIndex ], xPeriod, &xHigherPriorityTaskWoken ) :
+                      xTimerChangePeriod( xTimers[ ulIndex ], xPeriod, 0 );
+            pxExpected->xActive = pdTRUE;
+            pxExpected->xPeriod = xPeriod;
+            pxExpected->xExpiry = xNow + xPeriod;
+            break;
+    }
+
+    TEST_CHECK( xResult == pdPASS );
+
+    if( xFromISR != pdFALSE )
+    {
+        portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvISRCommand( void )
+{
+    prvSendCommand( ulISRTimer, ulISRCommand, xISRPeriod, pdTRUE );
+}
+/*-----------------------------------------------------------*/
+
+/* A random command, from the task or from an interrupt. */
+static void prvSendRandomCommand( uint32_t ulIndex,
+                                  BaseType_t xFromISR )
+{
+    const uint32_t ulCommand = prvRandom() % 4U;
+    const TickType_t xPeriod = 1U + ( prvRandom() % testMAX_PERIOD );
+
+    if( xFromISR != pdFALSE )
+    {
+        ulISRTimer = ulIndex;
+        ulISRCommand = ulCommand;
+        xISRPeriod = xPeriod;
+        vPortRunInterrupt( prvISRCommand );
+    }
+    else
+    {
+        prvSendCommand( ulIndex, ulCommand, xPeriod, pdFALSE );
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* The timer task has the highest priority, once it ran every command sent so
+ * far is applied. */
+static void prvCheckActive( void )
+{
+    uint32_t ulIndex;
+
+    for( ulIndex = 0; ulIndex < testTIMERS; ulIndex++ )
+    {
+        TEST_CHECK( xTimerIsTimerActive( xTimers[ ulIndex ] ) == xExpected[ ulIndex ].xActive );
+
+        if( xExpected[ ulIndex ].xActive != pdFALSE )
+        {
+            TEST_CHECK( xTimerGetExpiryTime( xTimers[ ulIndex ] ) == xExpected[ ulIndex ].xExpiry );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* Commands the timer task takes all at once, interrupt commands in bursts
+ * that can fill the ring, task commands in between. */
+static void prvSendBurst( void )
+{
+    uint32_t ulISRLeft = prvRandom() % ( testMAX_BURST + 1U );
+    uint32_t ulTaskLeft = prvRandom() % ( testMAX_TASK_COMMANDS + 1U );
+
+    vTaskSuspendAll();
+    {
+        while( ( ulISRLeft + ulTaskLeft ) > 0U )
+        {
+            if( ( prvRandom() % ( ulISRLeft + ulTaskLeft ) ) < ulISRLeft )
+            {
+                prvSendRandomCommand( prvRandom() % testTIMERS, pdTRUE );
+                ulISRLeft--;
+            }
+            else
+            {
+                prvSendRandomCommand( prvRandom() % testTIMERS, pdFALSE );
+                ulTaskLeft--;
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    prvCheckActive();
+}
+/*-----------------------------------------------------------*/
+
+/* Interrupt command A finds the ring empty and sends the message that wakes
+ * the timer task, task command B goes on the queue behind it, interrupt
+ * command C goes in the ring behind A.  The last command sent is C. */
+static void prvCheckSendOrder( void )
+{
+    vTaskSuspendAll();
+    {
+        ulISRTimer = 0;
+        ulISRCommand = testCHANGE_PERIOD;
+        xISRPeriod = 50;
+        vPortRunInterrupt( prvISRCommand );
+
+        prvSendCommand( 0, testSTOP, 0, pdFALSE );
+
+        xISRPeriod = 70;
+        vPortRunInterrupt( prvISRCommand );
+    }
+    ( void ) xTaskResumeAll();
+
+    TEST_CHECK( xTimerIsTimerActive( xTimers[ 0 ] ) != pdFALSE );
+    TEST_CHECK( xTimerGetPeriod( xTimers[ 0 ] ) == 70U );
+    prvCheckActive();
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureCost( uint32_t ulTimers )
+{
+    uint64_t ullStartNs;
+    uint32_t ulIndex;
+
+    for( ulIndex = 0; ulIndex < ulTimers; ulIndex++ )
+    {
+        xTimers[ ulIndex ] = xTimerCreateStatic( "Cost", testCOST_TICKS + ( prvRandom() % testCOST_TICKS ), pdTRUE, NULL,
+                                                 prvCostCallback, &( xTimerBuffers[ ulIndex ] ) );
+        TEST_CHECK( xTimers[ ulIndex ] != NULL );
+        TEST_CHECK( xTimerStart( xTimers[ ulIndex ], portMAX_DELAY ) == pdPASS );
+    }
+
+    ullStartNs = prvNowNs();
+
+    for( ulIndex = 0; ulIndex < testCOST_TICKS; ulIndex++ )
+    {
+        TEST_CHECK( xTimerReset( xTimers[ prvRandom() % ulTimers ], portMAX_DELAY ) == pdPASS );
+        vTaskDelay( 1 );
+    }
+
+    ( void ) printf( "%s,%lu,%lu\n", testNAME, ( unsigned long ) ulTimers,
+                     ( unsigned long ) ( ( prvNowNs() - ullStartNs ) / testCOST_TICKS ) );
+
+    for( ulIndex = 0; ulIndex < ulTimers; ulIndex++ )
+    {
+        TEST_CHECK( xTimerDelete( xTimers[ ulIndex ], portMAX_DELAY ) == pdPASS );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTask( void * pvParameters )
+{
+    uint32_t ulTick, ulIndex;
+    TickType_t xNow;
+    BaseType_t xWrapped = pdFALSE;
+
+    ( void ) pvParameters;
+
+    for( ulIndex = 0; ulIndex < testTIMERS; ulIndex++ )
+    {
+        xExpected[ ulIndex ].xPeriod = 1U + ( prvRandom() % testMAX_PERIOD );
+        xTimers[ ulIndex ] = xTimerCreateStatic( "Timer", xExpected[ ulIndex ].xPeriod, ( UBaseType_t ) ( ulIndex % 2U ),
+                                                 ( void * ) ( uintptr_t ) ulIndex, prvCallback, &( xTimerBuffers[ ulIndex ] ) );
+        TEST_CHECK( xTimers[ ulIndex ] != NULL );
+    }
+
+    prvCheckSendOrder();
+
+    for( ulTick = 0; ulTick < testTICKS; ulTick++ )
+    {
+        for( ulIndex = 0; ulIndex < testCOMMANDS_PER_TICK; ulIndex++ )
+        {
+            prvSendRandomCommand( prvRandom() % testTIMERS, ( BaseType_t ) ( prvRandom() % 2U ) );
+        }
+
+        prvCheckActive();
+
+        if( ( ulTick % testBURST_INTERVAL ) == 0U )
+        {
+            prvSendBurst();
+        }
+
+        xNow = xTaskGetTickCount();
+        vTaskDelay( 1 );
+
+        if( xTaskGetTickCount() < xNow )
+        {
+            xWrapped = pdTRUE;
+        }
+    }
+
+    /* No active timer was missed. */
+    xNow = xTaskGetTickCount();
+
+    for( ulIndex = 0; ulIndex < testTIMERS; ulIndex++ )
+    {
+        if( xExpected[ ulIndex ].xActive != pdFALSE )
+        {
+            TEST_CHECK( ( BaseType_t ) ( xExpected[ ulIndex ].xExpiry - xNow ) > 0 );
+        }
+
+        TEST_CHECK( xTimerDelete( xTimers[ ulIndex ], portMAX_DELAY ) == pdPASS );
+    }
+
+    TEST_CHECK( xWrapped != pdFALSE );
+    ( void ) printf( "%lu callbacks, checksum %08lx, %lu commands from interrupts\n",
+                     ( unsigned long ) ulCallbacks, ( unsigned long ) ulChecksum, ( unsigned long ) ulISRCommands );
+
+    for( ulIndex = 0; ulIndex < testCOST_RUNS; ulIndex++ )
+    {
+        prvMeasureCost( ulCostTimers[ ulIndex ] );
+    }
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    vTestRun( prvTestTask, tskIDLE_PRIORITY + 1 );
+
+    return 0;
+}
@@ -0,0 +1,314 @@
+/*
+ * Delayed tasks in the sorted delayed lists (test_delay_lists) and in the
+ * timing wheel (test_timing_wheel, test_timing_wheel_2 with 2 bit slots),
+ * configUSE_TASK_TIMING_WHEEL.
+ *
+ * The kernel runs tickless on the virtual clock of MCAL/SIM, as in
+ * test_tickless.c, so long delays pass in a few sleeps of vTaskStepTick() and
+ * the tick count starts just before its overflow.  Worker tasks delay for
+ * random numbers of ticks, from a single tick to millions of ticks, and each
+ * must wake on the exact tick its delay ends.  A sleep of the tickless idle
+ * that stepped over a wake time, or over a time the wheel moves tasks down one
+ * level, makes a worker wake late.  Meanwhile the test task suspends and
+ * resumes blocked workers, which takes them out of the wheel, checks the
+ * states eTaskGetState() and uxTaskGetSystemState() report, and ends with a
+ * delay of portMAX_DELAY - 1 ticks, so the tick count overflows again.
+ *
+ * The cost part then blocks 10, 100 and 500 tasks on delays of 1 to 100 ticks
+ * and prints a CSV line for each:
+ *   delayed tasks,tasks,host ns per tick
+ * The time includes the context switches of the host port, compare the lines
+ * of the builds.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#include "test_support.h"
+#include "sim_clock.h"
+#include "sim_hw.h"
+
+#define testWORKERS             16U
+#define testROUNDS              200U
+#define testDISTURBANCES        400U
+
+/* Tasks and virtual ticks of the cost part. */
+#define testCOST_TICKS          2000U
+#define testCOST_MAX_DELAY      100U
+#define testCOST_RUNS           3U
+
+#if ( ( configUSE_TASK_TIMING_WHEEL == 1 ) && ( configTIMING_WHEEL_SLOT_BITS == 2 ) )
+    #define testNAME    "timing_wheel_2"
+#elif ( configUSE_TASK_TIMING_WHEEL == 1 )
+    #define testNAME    "timing_wheel"
+#else
+    #define testNAME    "delay_lists"
+#endif
+
+typedef struct
+{
+    TaskHandle_t xHandle;
+    volatile TickType_t xWakeTime;
+    volatile BaseType_t xBlocked;
+    volatile BaseType_t xResumed;
+} Worker_t;
+
+static Worker_t xWorkers[ testWORKERS ];
+static volatile uint32_t ulWorkersDone = 0;
+static volatile uint32_t ulWakes = 0;
+static volatile uint32_t ulWraps = 0;
+static const uint32_t ulCostTasks[ testCOST_RUNS ] = { 10U, 100U, 500U };
+
+/*-----------------------------------------------------------*/
+
+/* Port F interrupt of MCAL/SIM, no edge is scripted. */
+void GPIOPortF_Handler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+static void prvStep( void )
+{
+    ( void ) SimClock_Step( 0xFFFFFFFFFFFFFFFFULL );
+}
+/*-----------------------------------------------------------*/
+
+/* Moves the virtual clock to the next event whenever the idle task runs, the
+ * tickless idle then sleeps until the next unblock time. */
+void vApplicationIdleHook( void )
+{
+    vPortRunInterrupt( prvStep );
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRandom( void )
+{
+    static uint32_t ulSeed = 0x6C078965UL;
+
+    ulSeed = ( ulSeed * 1664525UL ) + 1013904223UL;
+
+    return ulSeed >> 8;
+}
+/*-----------------------------------------------------------*/
+
+/* Mostly short delays, some long enough to go through every level. */
+static TickType_t prvRandomDelay( void )
+{
+    uint32_t ulClass = prvRandom() % 100U;
+    TickType_t xDelay;
+
+    if( ulClass < 50U )
+    {
+        xDelay = 1U + ( prvRandom() % 20U );
+    }
+    else if( ulClass < 80U )
+    {
+        xDelay = 1U + ( prvRandom() % 2000U );
+    }
+    else if( ulClass < 95U )
+    {
+        xDelay = 1U + ( prvRandom() % 100000U );
+    }
+    else
+    {
+        xDelay = 1U + ( prvRandom() % 3000000U );
+    }
+
+    return xDelay;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkerTask( void * pvParameters )
+{
+    Worker_t * pxWorker = ( Worker_t * ) pvParameters;
+    TickType_t xBefore, xNow;
+    uint32_t ulRound;
+
+    for( ulRound = 0; ulRound < testROUNDS; ulRound++ )
+    {
+        xBefore = xTaskGetTickCount();
+        pxWorker->xWakeTime = xBefore + prvRandomDelay();
+        pxWorker->xBlocked = pdTRUE;
+
+        vTaskDelay( pxWorker->xWakeTime - xBefore );
+
+        xNow = xTaskGetTickCount();
+        pxWorker->xBlocked = pdFALSE;
+
+        if( pxWorker->xResumed != pdFALSE )
+        {
+            /* Resumed before its wake time. */
+            TEST_CHECK( ( xNow - xBefore ) < ( pxWorker->xWakeTime - xBefore ) );
+            pxWorker->xResumed = pdFALSE;
+        }
+        else
+        {
+            TEST_CHECK( xNow == pxWorker->xWakeTime );
+            ulWakes++;
+        }
+
+        if( xNow < xBefore )
+        {
+            ulWraps++;
+        }
+    }
+
+    ulWorkersDone++;
+    vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+/* A worker whose wake time is now is ready, it runs after the test task. */
+static BaseType_t prvIsBlocked( const Worker_t * pxWorker )
+{
+    return ( ( pxWorker->xBlocked != pdFALSE ) && ( pxWorker->xWakeTime != xTaskGetTickCount() ) ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+/* Every worker the test knows to be blocked is reported blocked. */
+static void prvCheckStates( void )
+{
+    static TaskStatus_t xStatus[ testWORKERS + 4U ];
+    UBaseType_t uxTasks, uxIndex;
+    uint32_t ulWorker;
+
+    uxTasks = uxTaskGetSystemState( xStatus, testWORKERS + 4U, NULL );
+    TEST_CHECK( uxTasks == uxTaskGetNumberOfTasks() );
+
+    for( ulWorker = 0; ulWorker < testWORKERS; ulWorker++ )
+    {
+        if( prvIsBlocked( &( xWorkers[ ulWorker ] ) ) == pdFALSE )
+        {
+            continue;
+        }
+
+        TEST_CHECK( eTaskGetState( xWorkers[ ulWorker ].xHandle ) == eBlocked );
+
+        for( uxIndex = 0; uxIndex < uxTasks; uxIndex++ )
+        {
+            if( xStatus[ uxIndex ].xHandle == xWorkers[ ulWorker ].xHandle )
+            {
+                TEST_CHECK( xStatus[ uxIndex ].eCurrentState == eBlocked );
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvCostTask( void * pvParameters )
+{
+    ( void ) pvParameters;
+
+    for( ; ; )
+    {
+        vTaskDelay( 1U + ( prvRandom() % testCOST_MAX_DELAY ) );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNowNs( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMeasureCost( uint32_t ulTasks )
+{
+    static TaskHandle_t xCostTasks[ 500 ];
+    uint64_t ullStartNs;
+    uint32_t ulIndex;
+
+    for( ulIndex = 0; ulIndex < ulTasks; ulIndex++ )
+    {
+        TEST_CHECK( xTaskCreate( prvCostTask, "Cost", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, &( xCostTasks[ ulIndex ] ) ) == pdPASS );
+    }
+
+    /* Let every task block once before timing. */
+    vTaskDelay( testCOST_MAX_DELAY );
+
+    ullStartNs = prvNowNs();
+    vTaskDelay( testCOST_TICKS );
+
+    ( void ) printf( "%s,%lu,%lu\n", testNAME, ( unsigned long ) ulTasks,
+                     ( unsigned long ) ( ( prvNowNs() - ullStartNs ) / testCOST_TICKS ) );
+
+    for( ulIndex = 0; ulIndex < ulTasks; ulIndex++ )
+    {
+        vTaskDelete( xCostTasks[ ulIndex ] );
+    }
+
+    /* Let the idle task free the deleted tasks. */
+    vTaskDelay( 1 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTestTask( void * pvParameters )
+{
+    Worker_t * pxWorker;
+    TickType_t xBefore;
+    uint32_t ulIndex;
+
+    ( void ) pvParameters;
+
+    for( ulIndex = 0; ulIndex < testWORKERS; ulIndex++ )
+    {
+        TEST_CHECK( xTaskCreate( prvWorkerTask, "Worker", configMINIMAL_STACK_SIZE, &( xWorkers[ ulIndex ] ),
+                                 tskIDLE_PRIORITY + 1, &( xWorkers[ ulIndex ].xHandle ) ) == pdPASS );
+    }
+
+    for( ulIndex = 0; ulIndex < testDISTURBANCES; ulIndex++ )
+    {
+        vTaskDelay( 1U + ( prvRandom() % 5000U ) );
+        prvCheckStates();
+
+        /* A worker suspended while blocked leaves the wheel, and is made
+         * ready at once when resumed. */
+        pxWorker = &( xWorkers[ prvRandom() % testWORKERS ] );
+
+        if( ( prvIsBlocked( pxWorker ) != pdFALSE ) && ( ( prvRandom() % 4U ) == 0U ) )
+        {
+            vTaskSuspend( pxWorker->xHandle );
+            TEST_CHECK( eTaskGetState( pxWorker->xHandle ) == eSuspended );
+            pxWorker->xResumed = pdTRUE;
+            vTaskResume( pxWorker->xHandle );
+        }
+    }
+
+    /* The longest delay there is, the tick count overflows once more. */
+    xBefore = xTaskGetTickCount();
+    vTaskDelay( portMAX_DELAY - 1U );
+    TEST_CHECK( xTaskGetTickCount() == ( xBefore + portMAX_DELAY - 1U ) );
+
+    TEST_CHECK( ulWorkersDone == testWORKERS );
+    TEST_CHECK( ulWraps > 0U );
+
+    ( void ) printf( "%lu exact wakes, %lu of them across the overflow\n",
+                     ( unsigned long ) ulWakes, ( unsigned long ) ulWraps );
+
+    for( ulIndex = 0; ulIndex < testWORKERS; ulIndex++ )
+    {
+        vTaskDelete( xWorkers[ ulIndex ].xHandle );
+    }
+
+    for( ulIndex = 0; ulIndex < testCOST_RUNS; ulIndex++ )
+    {
+        prvMeasureCost( ulCostTasks[ ulIndex ] );
+    }
+
+    vTestEnd();
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    SimHw_Init();
+    SimClock_Init( NULL, 0 );
+
+    vTestRun( prvTestTask, tskIDLE_PRIORITY + 2 );
+
+    return 0;
+}
@@ -0,0 +1,228 @@
+/*
+ * Transmit ring buffer of the UART0 driver on the simulated UART.
+ *
+ * The Send functions only queue the bytes, the transmit interrupt drains the
+ * ring into the FIFO of MCAL/SIM, which is one byte deep and shifts each byte
+ * out to the standard output.  The test takes the standard output over and
+ * checks, from main() without a scheduler:
+ *   - strings of an odd length, sent and drained over and over, wrap the ring
+ *     many times and come out whole and in order,
+ *   - once the ring is full the Send functions drop the extra bytes without
+ *     blocking, UART0_GetTxDroppedBytes() counts them and the bytes queued
+ *     before still come out,
+ *   - every byte after the first of a burst goes out from UART0_Handler.
+ *
+ * It prints a CSV line of the host time UART0_SendString() takes to queue a
+ * string while the UART is busy:
+ *   uart0_send_string,bytes,mean ns,worst ns
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#include "test_support.h"
+#include "sim_hw.h"
+#include "uart0.h"
+
+/* Length of the strings of the wrap test, not a divisor of the ring size so
+ * the wrap falls in the middle of a string, and the number sent. */
+#define testWRAP_LENGTH       299U
+#define testWRAP_STRINGS      20U
+
+/* Bytes sent at once to overflow the ring.  The string is queued before the
+ * FIFO is primed, so the ring takes all it holds, one slot less than its size. */
+#define testBURST_LENGTH      ( UART0_TX_BUFFER_SIZE + 100U )
+#define testBURST_ACCEPTED    ( UART0_TX_BUFFER_SIZE - 1U )
+
+/* Strings of the latency measurement. */
+#define testTIMED_LENGTH      32U
+#define testTIMED_CALLS       10000U
+
+static uint8 ucString[ testBURST_LENGTH + 1U ];
+static char cOutput[ testBURST_LENGTH + 1U ];
+static FILE * pxCapture = NULL;
+static int iStdout = -1;
+static off_t xCaptureRead = 0;
+
+/*-----------------------------------------------------------*/
+
+/* Port F interrupt, no button is pressed. */
+void GPIOPortF_Handler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvNowNs( void )
+{
+    struct timespec xNow;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &xNow );
+
+    return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+/* Fills the string with a pattern that starts at ulFirst, no two neighbours
+ * and no two strings in a row alike. */
+static void prvMakeString( uint32_t ulFirst,
+                           uint32_t ulLength )
+{
+    uint32_t x;
+
+    for( x = 0; x < ulLength; x++ )
+    {
+        ucString[ x ] = ( uint8 ) ( 'A' + ( ( ulFirst + x ) % 26U ) );
+    }
+
+    ucString[ ulLength ] = '\0';
+}
+/*-----------------------------------------------------------*/
+
+/* Sends the FIFO byte out until the UART is idle, every send but the last
+ * runs UART0_Handler, which refills the FIFO from the ring.  Returns the
+ * number of bytes sent. */
+static uint32_t prvDrain( void )
+{
+    uint32_t ulSent = 0;
+
+    while( SimHw_UartTransmit() != FALSE )
+    {
+        ulSent++;
+    }
+
+    TEST_CHECK( SimHw_UartBusy() == FALSE );
+
+    return ulSent;
+}
+/*-----------------------------------------------------------*/
+
+/* The output since the last call, as a string. */
+static uint32_t prvTakeOutput( void )
+{
+    struct stat xStat;
+    ssize_t xRead;
+
+    ( void ) fflush( stdout );
+    TEST_CHECK( fstat( fileno( pxCapture ), &xStat ) == 0 );
+    TEST_CHECK( ( xStat.st_size - xCaptureRead ) <= ( off_t ) testBURST_LENGTH );
+
+    xRead = pread( fileno( pxCapture ), cOutput, ( size_t ) ( xStat.st_size - xCaptureRead ), xCaptureRead );
+    TEST_CHECK( xRead == ( ssize_t ) ( xStat.st_size - xCaptureRead ) );
+    xCaptureRead = xStat.st_size;
+    cOutput[ xRead ] = '\0';
+
+    return ( uint32_t ) xRead;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCaptureStart( void )
+{
+    ( void ) fflush( stdout );
+    pxCapture = tmpfile();
+    TEST_CHECK( pxCapture != NULL );
+    iStdout = dup( STDOUT_FILENO );
+    TEST_CHECK( iStdout >= 0 );
+    TEST_CHECK( dup2( fileno( pxCapture ), STDOUT_FILENO ) == STDOUT_FILENO );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCaptureEnd( void )
+{
+    ( void ) fflush( stdout );
+    TEST_CHECK( dup2( iStdout, STDOUT_FILENO ) == STDOUT_FILENO );
+    ( void ) close( iStdout );
+    ( void ) fclose( pxCapture );
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    uint32_t ulString, ulCall, ulDropped;
+    uint64_t ullStartNs, ullNs, ullTotalNs = 0, ullWorstNs = 0;
+
+    SimHw_Init();
+    UART0_Init();
+    prvCaptureStart();
+
+    /* Wrap: each string is queued whole, its first byte goes to the FIFO at
+     * once and the handler moves the rest. */
+    for( ulString = 0; ulString < testWRAP_STRINGS; ulString++ )
+    {
+        prvMakeString( ulString, testWRAP_LENGTH );
+        UART0_SendString( ucString );
+        TEST_CHECK( SimHw_UartBusy() != FALSE );
+        TEST_CHECK( prvDrain() == testWRAP_LENGTH );
+        TEST_CHECK( prvTakeOutput() == testWRAP_LENGTH );
+        TEST_CHECK( strcmp( cOutput, ( const char * ) ucString ) == 0 );
+    }
+
+    TEST_CHECK( ( testWRAP_STRINGS * testWRAP_LENGTH ) > ( 2U * UART0_TX_BUFFER_SIZE ) );
+    TEST_CHECK( UART0_GetTxDroppedBytes() == 0U );
+
+    /* Full ring: nothing is sent while the burst is queued, the ring takes
+     * what it holds and the rest is dropped and counted. */
+    prvMakeString( 7U, testBURST_LENGTH );
+    UART0_SendString( ucString );
+    ulDropped = UART0_GetTxDroppedBytes();
+    TEST_CHECK( ulDropped == ( testBURST_LENGTH - testBURST_ACCEPTED ) );
+
+    /* Priming the FIFO freed one slot, the next byte takes it and the ring
+     * is full again: the digits after it are dropped one by one. */
+    UART0_SendByte( '!' );
+    TEST_CHECK( UART0_GetTxDroppedBytes() == ulDropped );
+    UART0_SendInteger( -12345 );
+    ulDropped += 6U;
+    TEST_CHECK( UART0_GetTxDroppedBytes() == ulDropped );
+
+    TEST_CHECK( prvDrain() == ( testBURST_ACCEPTED + 1U ) );
+    TEST_CHECK( prvTakeOutput() == ( testBURST_ACCEPTED + 1U ) );
+    TEST_CHECK( memcmp( cOutput, ucString, testBURST_ACCEPTED ) == 0 );
+    TEST_CHECK( cOutput[ testBURST_ACCEPTED ] == '!' );
+
+    /* Drained, the ring takes bytes again and the count stays. */
+    UART0_SendInteger( -12345 );
+    UART0_SendByte( '!' );
+    TEST_CHECK( prvDrain() == 7U );
+    TEST_CHECK( prvTakeOutput() == 7U );
+    TEST_CHECK( strcmp( cOutput, "-12345!" ) == 0 );
+    TEST_CHECK( UART0_GetTxDroppedBytes() == ulDropped );
+
+    /* Latency: the UART stays busy with the first byte, so every call only
+     * copies its string into the ring, as a task does while a report goes
+     * out.  The ring is drained between the calls, outside the timing. */
+    prvMakeString( 0U, testTIMED_LENGTH );
+
+    for( ulCall = 0; ulCall < testTIMED_CALLS; ulCall++ )
+    {
+        UART0_SendByte( '.' );
+
+        ullStartNs = prvNowNs();
+        UART0_SendString( ucString );
+        ullNs = prvNowNs() - ullStartNs;
+
+        ullTotalNs += ullNs;
+
+        if( ullNs > ullWorstNs )
+        {
+            ullWorstNs = ullNs;
+        }
+
+        TEST_CHECK( prvDrain() == ( testTIMED_LENGTH + 1U ) );
+        ( void ) prvTakeOutput();
+    }
+
+    TEST_CHECK( UART0_GetTxDroppedBytes() == ulDropped );
+    TEST_CHECK( SimHw_Overflowed() == FALSE );
+
+    prvCaptureEnd();
+
+    ( void ) printf( "uart0_send_string,%lu,%lu,%lu\n",
+                     ( unsigned long ) testTIMED_LENGTH,
+                     ( unsigned long ) ( ullTotalNs / testTIMED_CALLS ),
+                     ( unsigned long ) ullWorstNs );
+
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * WTimer0 timestamp and compare of the GPTM driver across the 2^32 us wrap
+ * of the hardware count, on the virtual clock of MCAL/SIM.
+ *
+ * The clock runs from main() with the kernel tick stopped, so it jumps
+ * straight to just before the wrap, about 71 minutes of virtual time, and
+ * then moves in small steps.  The test checks:
+ *   - GPTM_WTimer0ReadUs() follows the virtual time and never goes back
+ *     across the wrap, with the time out interrupt taken at once and with it
+ *     held off while the count already wrapped,
+ *   - a compare past the wrap fires in the second epoch, also when its low
+ *     half matches in the first epoch already,
+ *   - a deadline already passed, or reached, makes GPTM_WTimer0SetCompare()
+ *     return FALSE and its callback is never called,
+ *   - a cancelled compare does not fire.
+ */
+
+#include <stdio.h>
+
+#include "test_support.h"
+#include "sim_clock.h"
+#include "sim_hw.h"
+#include "GPTM.h"
+#include "tm4c123gh6pm_registers.h"
+
+#define testWRAP_US      0x100000000ULL
+#define testSTEP_US      7ULL
+
+static volatile uint32_t ulCallbacks = 0;
+static volatile uint64_t ullCallbackUs = 0;
+static uint64_t ullLastReadUs = 0;
+
+/*-----------------------------------------------------------*/
+
+/* Port F interrupt of MCAL/SIM, no edge is scripted. */
+void GPIOPortF_Handler( void )
+{
+}
+/*-----------------------------------------------------------*/
+
+static void prvCompareCallback( void )
+{
+    ulCallbacks++;
+    ullCallbackUs = GPTM_WTimer0ReadUs();
+}
+/*-----------------------------------------------------------*/
+
+/* Reads the timestamp, which must be the virtual time and never go back. */
+static void prvCheckRead( void )
+{
+    uint64_t ullNowUs = GPTM_WTimer0ReadUs();
+
+    TEST_CHECK( ullNowUs >= ullLastReadUs );
+    TEST_CHECK( ullNowUs == SimClock_NowUs() );
+    ullLastReadUs = ullNowUs;
+}
+/*-----------------------------------------------------------*/
+
+/* Raises every event up to ullUntilUs, reading the timestamp every
+ * ullStepUs and after every event. */
+static void prvRunTo( uint64_t ullUntilUs,
+                      uint64_t ullStepUs )
+{
+    uint64_t ullLimitUs;
+
+    while( SimClock_NowUs() < ullUntilUs )
+    {
+        ullLimitUs = SimClock_NowUs() + ullStepUs;
+
+        if( ullLimitUs > ullUntilUs )
+        {
+            ullLimitUs = ullUntilUs;
+        }
+
+        ( void ) SimClock_Step( ullLimitUs );
+        prvCheckRead();
+    }
+}
+/*-----------------------------------------------------------*/
+
+int main( void )
+{
+    uint64_t ullDeadlineUs;
+
+    SimHw_Init();
+    SimClock_Init( NULL, 0 );
+    ( void ) SimClock_TickStop();
+    GPTM_WTimer0Init();
+
+    /* To just before the wrap in one step, nothing is due on the way. */
+    TEST_CHECK( SimClock_Step( testWRAP_US - 1000ULL ) == SIM_EVENT_NONE );
+    prvCheckRead();
+
+    /* A deadline in the past, or now, is refused and never called back. */
+    TEST_CHECK( GPTM_WTimer0SetCompare( SimClock_NowUs() - 1ULL, prvCompareCallback ) == FALSE );
+    TEST_CHECK( GPTM_WTimer0SetCompare( SimClock_NowUs(), prvCompareCallback ) == FALSE );
+    TEST_CHECK( GPTM_WTimer0SetCompare( 0ULL, prvCompareCallback ) == FALSE );
+
+    /* Past the wrap: the low half of 500 was passed in the first epoch, the
+     * match comes after the time out of the second. */
+    ullDeadlineUs = testWRAP_US + 500ULL;
+    TEST_CHECK( GPTM_WTimer0SetCompare( ullDeadlineUs, prvCompareCallback ) == TRUE );
+    prvRunTo( ullDeadlineUs - 1ULL, testSTEP_US );
+    TEST_CHECK( ulCallbacks == 0U );
+    prvRunTo( ullDeadlineUs + 1000ULL, testSTEP_US );
+    TEST_CHECK( ulCallbacks == 1U );
+    TEST_CHECK( ullCallbackUs == ullDeadlineUs );
+
+    /* A whole epoch ahead: the low half matches one epoch too early, the
+     * driver waits for the full deadline. */
+    ullDeadlineUs = SimClock_NowUs() + testWRAP_US + 300ULL;
+    TEST_CHECK( GPTM_WTimer0SetCompare( ullDeadlineUs, prvCompareCallback ) == TRUE );
+    prvRunTo( ullDeadlineUs - testWRAP_US + 1000ULL, testSTEP_US );
+    TEST_CHECK( ulCallbacks == 1U );
+    TEST_CHECK( SimClock_Step( ullDeadlineUs + 1000ULL ) == SIM_EVENT_TIMER );
+    prvCheckRead();
+    prvRunTo( ullDeadlineUs + 1000ULL, testSTEP_US );
+    TEST_CHECK( ulCallbacks == 2U );
+    TEST_CHECK( ullCallbackUs == ullDeadlineUs );
+
+    /* A compare fires once, its match is disarmed after the callback. */
+    prvRunTo( ( 3ULL * testWRAP_US ) + 1000ULL, testWRAP_US );
+    TEST_CHECK( ulCallbacks == 2U );
+
+    /* A cancelled compare does not fire. */
+    ullDeadlineUs = SimClock_NowUs() + 100ULL;
+    TEST_CHECK( GPTM_WTimer0SetCompare( ullDeadlineUs, prvCompareCallback ) == TRUE );
+    GPTM_WTimer0CancelCompare();
+    prvRunTo( ullDeadlineUs + 1000ULL, testSTEP_US );
+    TEST_CHECK( ulCallbacks == 2U );
+
+    /* The time out held off, by a critical section or by a reader of the same
+     * priority: the count wraps with TATORIS pending and the reads must still
+     * go on from the upper half plus one. */
+    prvRunTo( ( 4ULL * testWRAP_US ) - 1000ULL, testWRAP_US );
+    WTIMER0_IMR_REG &= ~GPTM_IMR_TATOIM_MASK;
+    prvRunTo( ( 4ULL * testWRAP_US ) - 1ULL, testSTEP_US );
+    TEST_CHECK( SimClock_Step( 4ULL * testWRAP_US ) == SIM_EVENT_NONE );
+    WTIMER0_RIS_REG |= GPTM_RIS_TATORIS_MASK;
+    prvCheckRead();
+    prvRunTo( ( 4ULL * testWRAP_US ) + 1000ULL, testSTEP_US );
+
+    /* The interrupt is taken at last, the reads go on the same. */
+    WTIMER0_IMR_REG |= GPTM_IMR_TATOIM_MASK;
+    SimHw_WTimer0Interrupt( GPTM_RIS_TATORIS_MASK );
+    WTIMER0_RIS_REG &= ~GPTM_RIS_TATORIS_MASK;
+    prvCheckRead();
+    prvRunTo( ( 5ULL * testWRAP_US ) + 1000ULL, testWRAP_US );
+
+    ( void ) printf( "wtimer0,%lu,%lu\n",
+                     ( unsigned long ) ( SimClock_NowUs() / testWRAP_US ),
+                     ( unsigned long ) ulCallbacks );
+
+    return 0;
+}